@@ -0,0 +1,5567 @@
+#include "data.hh"
+
+using namespace std;
+
+/* sine */
+const Buffer<s1_15, 257> Data::sine = {{{
+  s1_15::inclusive(f(0.000000)),
+  s1_15::inclusive(f(0.024541)),
+  s1_15::inclusive(f(0.049068)),
+  s1_15::inclusive(f(0.073565)),
+  s1_15::inclusive(f(0.098017)),
+  s1_15::inclusive(f(0.122411)),
+  s1_15::inclusive(f(0.146730)),
+  s1_15::inclusive(f(0.170962)),
+  s1_15::inclusive(f(0.195090)),
+  s1_15::inclusive(f(0.219101)),
+  s1_15::inclusive(f(0.242980)),
+  s1_15::inclusive(f(0.266713)),
+  s1_15::inclusive(f(0.290285)),
+  s1_15::inclusive(f(0.313682)),
+  s1_15::inclusive(f(0.336890)),
+  s1_15::inclusive(f(0.359895)),
+  s1_15::inclusive(f(0.382683)),
+  s1_15::inclusive(f(0.405241)),
+  s1_15::inclusive(f(0.427555)),
+  s1_15::inclusive(f(0.449611)),
+  s1_15::inclusive(f(0.471397)),
+  s1_15::inclusive(f(0.492898)),
+  s1_15::inclusive(f(0.514103)),
+  s1_15::inclusive(f(0.534998)),
+  s1_15::inclusive(f(0.555570)),
+  s1_15::inclusive(f(0.575808)),
+  s1_15::inclusive(f(0.595699)),
+  s1_15::inclusive(f(0.615232)),
+  s1_15::inclusive(f(0.634393)),
+  s1_15::inclusive(f(0.653173)),
+  s1_15::inclusive(f(0.671559)),
+  s1_15::inclusive(f(0.689541)),
+  s1_15::inclusive(f(0.707107)),
+  s1_15::inclusive(f(0.724247)),
+  s1_15::inclusive(f(0.740951)),
+  s1_15::inclusive(f(0.757209)),
+  s1_15::inclusive(f(0.773010)),
+  s1_15::inclusive(f(0.788346)),
+  s1_15::inclusive(f(0.803208)),
+  s1_15::inclusive(f(0.817585)),
+  s1_15::inclusive(f(0.831470)),
+  s1_15::inclusive(f(0.844854)),
+  s1_15::inclusive(f(0.857729)),
+  s1_15::inclusive(f(0.870087)),
+  s1_15::inclusive(f(0.881921)),
+  s1_15::inclusive(f(0.893224)),
+  s1_15::inclusive(f(0.903989)),
+  s1_15::inclusive(f(0.914210)),
+  s1_15::inclusive(f(0.923880)),
+  s1_15::inclusive(f(0.932993)),
+  s1_15::inclusive(f(0.941544)),
+  s1_15::inclusive(f(0.949528)),
+  s1_15::inclusive(f(0.956940)),
+  s1_15::inclusive(f(0.963776)),
+  s1_15::inclusive(f(0.970031)),
+  s1_15::inclusive(f(0.975702)),
+  s1_15::inclusive(f(0.980785)),
+  s1_15::inclusive(f(0.985278)),
+  s1_15::inclusive(f(0.989177)),
+  s1_15::inclusive(f(0.992480)),
+  s1_15::inclusive(f(0.995185)),
+  s1_15::inclusive(f(0.997290)),
+  s1_15::inclusive(f(0.998795)),
+  s1_15::inclusive(f(0.999699)),
+  s1_15::inclusive(f(1.000000)),
+  s1_15::inclusive(f(0.999699)),
+  s1_15::inclusive(f(0.998795)),
+  s1_15::inclusive(f(0.997290)),
+  s1_15::inclusive(f(0.995185)),
+  s1_15::inclusive(f(0.992480)),
+  s1_15::inclusive(f(0.989177)),
+  s1_15::inclusive(f(0.985278)),
+  s1_15::inclusive(f(0.980785)),
+  s1_15::inclusive(f(0.975702)),
+  s1_15::inclusive(f(0.970031)),
+  s1_15::inclusive(f(0.963776)),
+  s1_15::inclusive(f(0.956940)),
+  s1_15::inclusive(f(0.949528)),
+  s1_15::inclusive(f(0.941544)),
+  s1_15::inclusive(f(0.932993)),
+  s1_15::inclusive(f(0.923880)),
+  s1_15::inclusive(f(0.914210)),
+  s1_15::inclusive(f(0.903989)),
+  s1_15::inclusive(f(0.893224)),
+  s1_15::inclusive(f(0.881921)),
+  s1_15::inclusive(f(0.870087)),
+  s1_15::inclusive(f(0.857729)),
+  s1_15::inclusive(f(0.844854)),
+  s1_15::inclusive(f(0.831470)),
+  s1_15::inclusive(f(0.817585)),
+  s1_15::inclusive(f(0.803208)),
+  s1_15::inclusive(f(0.788346)),
+  s1_15::inclusive(f(0.773010)),
+  s1_15::inclusive(f(0.757209)),
+  s1_15::inclusive(f(0.740951)),
+  s1_15::inclusive(f(0.724247)),
+  s1_15::inclusive(f(0.707107)),
+  s1_15::inclusive(f(0.689541)),
+  s1_15::inclusive(f(0.671559)),
+  s1_15::inclusive(f(0.653173)),
+  s1_15::inclusive(f(0.634393)),
+  s1_15::inclusive(f(0.615232)),
+  s1_15::inclusive(f(0.595699)),
+  s1_15::inclusive(f(0.575808)),
+  s1_15::inclusive(f(0.555570)),
+  s1_15::inclusive(f(0.534998)),
+  s1_15::inclusive(f(0.514103)),
+  s1_15::inclusive(f(0.492898)),
+  s1_15::inclusive(f(0.471397)),
+  s1_15::inclusive(f(0.449611)),
+  s1_15::inclusive(f(0.427555)),
+  s1_15::inclusive(f(0.405241)),
+  s1_15::inclusive(f(0.382683)),
+  s1_15::inclusive(f(0.359895)),
+  s1_15::inclusive(f(0.336890)),
+  s1_15::inclusive(f(0.313682)),
+  s1_15::inclusive(f(0.290285)),
+  s1_15::inclusive(f(0.266713)),
+  s1_15::inclusive(f(0.242980)),
+  s1_15::inclusive(f(0.219101)),
+  s1_15::inclusive(f(0.195090)),
+  s1_15::inclusive(f(0.170962)),
+  s1_15::inclusive(f(0.146730)),
+  s1_15::inclusive(f(0.122411)),
+  s1_15::inclusive(f(0.098017)),
+  s1_15::inclusive(f(0.073565)),
+  s1_15::inclusive(f(0.049068)),
+  s1_15::inclusive(f(0.024541)),
+  s1_15::inclusive(f(0.000000)),
+  s1_15::inclusive(f(-0.024541)),
+  s1_15::inclusive(f(-0.049068)),
+  s1_15::inclusive(f(-0.073565)),
+  s1_15::inclusive(f(-0.098017)),
+  s1_15::inclusive(f(-0.122411)),
+  s1_15::inclusive(f(-0.146730)),
+  s1_15::inclusive(f(-0.170962)),
+  s1_15::inclusive(f(-0.195090)),
+  s1_15::inclusive(f(-0.219101)),
+  s1_15::inclusive(f(-0.242980)),
+  s1_15::inclusive(f(-0.266713)),
+  s1_15::inclusive(f(-0.290285)),
+  s1_15::inclusive(f(-0.313682)),
+  s1_15::inclusive(f(-0.336890)),
+  s1_15::inclusive(f(-0.359895)),
+  s1_15::inclusive(f(-0.382683)),
+  s1_15::inclusive(f(-0.405241)),
+  s1_15::inclusive(f(-0.427555)),
+  s1_15::inclusive(f(-0.449611)),
+  s1_15::inclusive(f(-0.471397)),
+  s1_15::inclusive(f(-0.492898)),
+  s1_15::inclusive(f(-0.514103)),
+  s1_15::inclusive(f(-0.534998)),
+  s1_15::inclusive(f(-0.555570)),
+  s1_15::inclusive(f(-0.575808)),
+  s1_15::inclusive(f(-0.595699)),
+  s1_15::inclusive(f(-0.615232)),
+  s1_15::inclusive(f(-0.634393)),
+  s1_15::inclusive(f(-0.653173)),
+  s1_15::inclusive(f(-0.671559)),
+  s1_15::inclusive(f(-0.689541)),
+  s1_15::inclusive(f(-0.707107)),
+  s1_15::inclusive(f(-0.724247)),
+  s1_15::inclusive(f(-0.740951)),
+  s1_15::inclusive(f(-0.757209)),
+  s1_15::inclusive(f(-0.773010)),
+  s1_15::inclusive(f(-0.788346)),
+  s1_15::inclusive(f(-0.803208)),
+  s1_15::inclusive(f(-0.817585)),
+  s1_15::inclusive(f(-0.831470)),
+  s1_15::inclusive(f(-0.844854)),
+  s1_15::inclusive(f(-0.857729)),
+  s1_15::inclusive(f(-0.870087)),
+  s1_15::inclusive(f(-0.881921)),
+  s1_15::inclusive(f(-0.893224)),
+  s1_15::inclusive(f(-0.903989)),
+  s1_15::inclusive(f(-0.914210)),
+  s1_15::inclusive(f(-0.923880)),
+  s1_15::inclusive(f(-0.932993)),
+  s1_15::inclusive(f(-0.941544)),
+  s1_15::inclusive(f(-0.949528)),
+  s1_15::inclusive(f(-0.956940)),
+  s1_15::inclusive(f(-0.963776)),
+  s1_15::inclusive(f(-0.970031)),
+  s1_15::inclusive(f(-0.975702)),
+  s1_15::inclusive(f(-0.980785)),
+  s1_15::inclusive(f(-0.985278)),
+  s1_15::inclusive(f(-0.989177)),
+  s1_15::inclusive(f(-0.992480)),
+  s1_15::inclusive(f(-0.995185)),
+  s1_15::inclusive(f(-0.997290)),
+  s1_15::inclusive(f(-0.998795)),
+  s1_15::inclusive(f(-0.999699)),
+  s1_15::inclusive(f(-1.000000)),
+  s1_15::inclusive(f(-0.999699)),
+  s1_15::inclusive(f(-0.998795)),
+  s1_15::inclusive(f(-0.997290)),
+  s1_15::inclusive(f(-0.995185)),
+  s1_15::inclusive(f(-0.992480)),
+  s1_15::inclusive(f(-0.989177)),
+  s1_15::inclusive(f(-0.985278)),
+  s1_15::inclusive(f(-0.980785)),
+  s1_15::inclusive(f(-0.975702)),
+  s1_15::inclusive(f(-0.970031)),
+  s1_15::inclusive(f(-0.963776)),
+  s1_15::inclusive(f(-0.956940)),
+  s1_15::inclusive(f(-0.949528)),
+  s1_15::inclusive(f(-0.941544)),
+  s1_15::inclusive(f(-0.932993)),
+  s1_15::inclusive(f(-0.923880)),
+  s1_15::inclusive(f(-0.914210)),
+  s1_15::inclusive(f(-0.903989)),
+  s1_15::inclusive(f(-0.893224)),
+  s1_15::inclusive(f(-0.881921)),
+  s1_15::inclusive(f(-0.870087)),
+  s1_15::inclusive(f(-0.857729)),
+  s1_15::inclusive(f(-0.844854)),
+  s1_15::inclusive(f(-0.831470)),
+  s1_15::inclusive(f(-0.817585)),
+  s1_15::inclusive(f(-0.803208)),
+  s1_15::inclusive(f(-0.788346)),
+  s1_15::inclusive(f(-0.773010)),
+  s1_15::inclusive(f(-0.757209)),
+  s1_15::inclusive(f(-0.740951)),
+  s1_15::inclusive(f(-0.724247)),
+  s1_15::inclusive(f(-0.707107)),
+  s1_15::inclusive(f(-0.689541)),
+  s1_15::inclusive(f(-0.671559)),
+  s1_15::inclusive(f(-0.653173)),
+  s1_15::inclusive(f(-0.634393)),
+  s1_15::inclusive(f(-0.615232)),
+  s1_15::inclusive(f(-0.595699)),
+  s1_15::inclusive(f(-0.575808)),
+  s1_15::inclusive(f(-0.555570)),
+  s1_15::inclusive(f(-0.534998)),
+  s1_15::inclusive(f(-0.514103)),
+  s1_15::inclusive(f(-0.492898)),
+  s1_15::inclusive(f(-0.471397)),
+  s1_15::inclusive(f(-0.449611)),
+  s1_15::inclusive(f(-0.427555)),
+  s1_15::inclusive(f(-0.405241)),
+  s1_15::inclusive(f(-0.382683)),
+  s1_15::inclusive(f(-0.359895)),
+  s1_15::inclusive(f(-0.336890)),
+  s1_15::inclusive(f(-0.313682)),
+  s1_15::inclusive(f(-0.290285)),
+  s1_15::inclusive(f(-0.266713)),
+  s1_15::inclusive(f(-0.242980)),
+  s1_15::inclusive(f(-0.219101)),
+  s1_15::inclusive(f(-0.195090)),
+  s1_15::inclusive(f(-0.170962)),
+  s1_15::inclusive(f(-0.146730)),
+  s1_15::inclusive(f(-0.122411)),
+  s1_15::inclusive(f(-0.098017)),
+  s1_15::inclusive(f(-0.073565)),
+  s1_15::inclusive(f(-0.049068)),
+  s1_15::inclusive(f(-0.024541)),
+  s1_15::inclusive(f(-0.000000)),
+}}};
+
+/* exp2_u0_23 */
+const Buffer<uint32_t, 1024> Data::exp2_u0_23 = {{{
+  8388608,
+  8394288,
+  8399972,
+  8405660,
+  8411351,
+  8417047,
+  8422746,
+  8428450,
+  8434157,
+  8439868,
+  8445583,
+  8451301,
+  8457024,
+  8462751,
+  8468481,
+  8474215,
+  8479953,
+  8485695,
+  8491441,
+  8497191,
+  8502945,
+  8508703,
+  8514464,
+  8520229,
+  8525999,
+  8531772,
+  8537549,
+  8543330,
+  8549115,
+  8554904,
+  8560697,
+  8566493,
+  8572294,
+  8578099,
+  8583907,
+  8589720,
+  8595536,
+  8601356,
+  8607180,
+  8613009,
+  8618841,
+  8624677,
+  8630517,
+  8636361,
+  8642209,
+  8648061,
+  8653917,
+  8659776,
+  8665640,
+  8671508,
+  8677380,
+  8683256,
+  8689135,
+  8695019,
+  8700907,
+  8706798,
+  8712694,
+  8718593,
+  8724497,
+  8730405,
+  8736316,
+  8742232,
+  8748152,
+  8754075,
+  8760003,
+  8765935,
+  8771870,
+  8777810,
+  8783754,
+  8789701,
+  8795653,
+  8801609,
+  8807569,
+  8813533,
+  8819501,
+  8825473,
+  8831449,
+  8837429,
+  8843413,
+  8849401,
+  8855393,
+  8861389,
+  8867390,
+  8873394,
+  8879402,
+  8885415,
+  8891432,
+  8897452,
+  8903477,
+  8909506,
+  8915539,
+  8921576,
+  8927617,
+  8933662,
+  8939711,
+  8945765,
+  8951822,
+  8957884,
+  8963949,
+  8970019,
+  8976093,
+  8982171,
+  8988253,
+  8994339,
+  9000430,
+  9006524,
+  9012623,
+  9018725,
+  9024832,
+  9030943,
+  9037058,
+  9043178,
+  9049301,
+  9055429,
+  9061560,
+  9067696,
+  9073836,
+  9079980,
+  9086129,
+  9092281,
+  9098438,
+  9104599,
+  9110764,
+  9116933,
+  9123106,
+  9129284,
+  9135465,
+  9141651,
+  9147841,
+  9154036,
+  9160234,
+  9166437,
+  9172644,
+  9178855,
+  9185070,
+  9191290,
+  9197513,
+  9203741,
+  9209973,
+  9216210,
+  9222450,
+  9228695,
+  9234944,
+  9241197,
+  9247455,
+  9253717,
+  9259983,
+  9266253,
+  9272527,
+  9278806,
+  9285089,
+  9291376,
+  9297668,
+  9303963,
+  9310263,
+  9316568,
+  9322876,
+  9329189,
+  9335506,
+  9341827,
+  9348153,
+  9354483,
+  9360817,
+  9367156,
+  9373498,
+  9379846,
+  9386197,
+  9392553,
+  9398913,
+  9405277,
+  9411645,
+  9418018,
+  9424396,
+  9430777,
+  9437163,
+  9443553,
+  9449948,
+  9456347,
+  9462750,
+  9469157,
+  9475569,
+  9481985,
+  9488406,
+  9494831,
+  9501260,
+  9507694,
+  9514132,
+  9520574,
+  9527021,
+  9533472,
+  9539927,
+  9546387,
+  9552851,
+  9559319,
+  9565792,
+  9572270,
+  9578751,
+  9585237,
+  9591728,
+  9598223,
+  9604722,
+  9611226,
+  9617734,
+  9624246,
+  9630763,
+  9637284,
+  9643810,
+  9650340,
+  9656875,
+  9663414,
+  9669957,
+  9676505,
+  9683057,
+  9689614,
+  9696175,
+  9702741,
+  9709311,
+  9715885,
+  9722464,
+  9729047,
+  9735635,
+  9742227,
+  9748824,
+  9755425,
+  9762031,
+  9768641,
+  9775256,
+  9781875,
+  9788499,
+  9795127,
+  9801759,
+  9808396,
+  9815038,
+  9821684,
+  9828335,
+  9834990,
+  9841649,
+  9848313,
+  9854982,
+  9861655,
+  9868333,
+  9875015,
+  9881702,
+  9888393,
+  9895088,
+  9901789,
+  9908494,
+  9915203,
+  9921917,
+  9928635,
+  9935358,
+  9942086,
+  9948818,
+  9955554,
+  9962296,
+  9969041,
+  9975792,
+  9982547,
+  9989306,
+  9996070,
+  10002839,
+  10009612,
+  10016390,
+  10023172,
+  10029959,
+  10036751,
+  10043547,
+  10050348,
+  10057153,
+  10063963,
+  10070778,
+  10077597,
+  10084421,
+  10091250,
+  10098083,
+  10104920,
+  10111763,
+  10118610,
+  10125461,
+  10132318,
+  10139178,
+  10146044,
+  10152914,
+  10159789,
+  10166669,
+  10173553,
+  10180442,
+  10187335,
+  10194233,
+  10201136,
+  10208044,
+  10214956,
+  10221873,
+  10228794,
+  10235720,
+  10242651,
+  10249587,
+  10256527,
+  10263472,
+  10270422,
+  10277376,
+  10284335,
+  10291299,
+  10298268,
+  10305241,
+  10312219,
+  10319202,
+  10326189,
+  10333181,
+  10340178,
+  10347180,
+  10354186,
+  10361198,
+  10368213,
+  10375234,
+  10382260,
+  10389290,
+  10396325,
+  10403364,
+  10410409,
+  10417458,
+  10424512,
+  10431571,
+  10438634,
+  10445702,
+  10452776,
+  10459853,
+  10466936,
+  10474024,
+  10481116,
+  10488213,
+  10495315,
+  10502422,
+  10509533,
+  10516649,
+  10523771,
+  10530897,
+  10538027,
+  10545163,
+  10552303,
+  10559449,
+  10566599,
+  10573754,
+  10580914,
+  10588078,
+  10595248,
+  10602422,
+  10609601,
+  10616785,
+  10623974,
+  10631168,
+  10638367,
+  10645571,
+  10652779,
+  10659992,
+  10667210,
+  10674434,
+  10681662,
+  10688894,
+  10696132,
+  10703375,
+  10710622,
+  10717875,
+  10725132,
+  10732395,
+  10739662,
+  10746934,
+  10754211,
+  10761493,
+  10768780,
+  10776072,
+  10783369,
+  10790671,
+  10797977,
+  10805289,
+  10812605,
+  10819927,
+  10827254,
+  10834585,
+  10841921,
+  10849263,
+  10856609,
+  10863961,
+  10871317,
+  10878678,
+  10886044,
+  10893416,
+  10900792,
+  10908173,
+  10915560,
+  10922951,
+  10930347,
+  10937748,
+  10945155,
+  10952566,
+  10959982,
+  10967404,
+  10974830,
+  10982261,
+  10989698,
+  10997139,
+  11004586,
+  11012037,
+  11019494,
+  11026955,
+  11034422,
+  11041894,
+  11049371,
+  11056853,
+  11064340,
+  11071832,
+  11079329,
+  11086831,
+  11094338,
+  11101850,
+  11109368,
+  11116890,
+  11124418,
+  11131950,
+  11139488,
+  11147031,
+  11154579,
+  11162132,
+  11169690,
+  11177254,
+  11184822,
+  11192396,
+  11199975,
+  11207558,
+  11215147,
+  11222742,
+  11230341,
+  11237945,
+  11245555,
+  11253169,
+  11260789,
+  11268414,
+  11276045,
+  11283680,
+  11291320,
+  11298966,
+  11306617,
+  11314273,
+  11321934,
+  11329601,
+  11337272,
+  11344949,
+  11352631,
+  11360318,
+  11368011,
+  11375708,
+  11383411,
+  11391119,
+  11398833,
+  11406551,
+  11414275,
+  11422004,
+  11429738,
+  11437477,
+  11445222,
+  11452972,
+  11460727,
+  11468488,
+  11476253,
+  11484024,
+  11491800,
+  11499582,
+  11507369,
+  11515161,
+  11522958,
+  11530760,
+  11538568,
+  11546381,
+  11554200,
+  11562023,
+  11569852,
+  11577687,
+  11585526,
+  11593371,
+  11601221,
+  11609077,
+  11616938,
+  11624804,
+  11632676,
+  11640552,
+  11648435,
+  11656322,
+  11664215,
+  11672113,
+  11680017,
+  11687926,
+  11695840,
+  11703759,
+  11711684,
+  11719615,
+  11727550,
+  11735492,
+  11743438,
+  11751390,
+  11759347,
+  11767310,
+  11775278,
+  11783251,
+  11791230,
+  11799214,
+  11807204,
+  11815199,
+  11823199,
+  11831205,
+  11839216,
+  11847233,
+  11855255,
+  11863283,
+  11871316,
+  11879354,
+  11887398,
+  11895447,
+  11903502,
+  11911562,
+  11919628,
+  11927699,
+  11935776,
+  11943858,
+  11951945,
+  11960038,
+  11968137,
+  11976241,
+  11984350,
+  11992465,
+  12000586,
+  12008712,
+  12016843,
+  12024980,
+  12033123,
+  12041271,
+  12049424,
+  12057583,
+  12065748,
+  12073918,
+  12082094,
+  12090275,
+  12098461,
+  12106654,
+  12114851,
+  12123055,
+  12131264,
+  12139478,
+  12147698,
+  12155924,
+  12164155,
+  12172392,
+  12180634,
+  12188882,
+  12197135,
+  12205394,
+  12213659,
+  12221929,
+  12230205,
+  12238486,
+  12246774,
+  12255066,
+  12263364,
+  12271668,
+  12279978,
+  12288293,
+  12296614,
+  12304940,
+  12313272,
+  12321610,
+  12329953,
+  12338302,
+  12346657,
+  12355017,
+  12363383,
+  12371755,
+  12380132,
+  12388515,
+  12396904,
+  12405298,
+  12413698,
+  12422104,
+  12430515,
+  12438932,
+  12447355,
+  12455784,
+  12464218,
+  12472658,
+  12481103,
+  12489555,
+  12498012,
+  12506474,
+  12514943,
+  12523417,
+  12531897,
+  12540383,
+  12548874,
+  12557372,
+  12565875,
+  12574383,
+  12582898,
+  12591418,
+  12599944,
+  12608476,
+  12617014,
+  12625557,
+  12634106,
+  12642661,
+  12651222,
+  12659788,
+  12668361,
+  12676939,
+  12685523,
+  12694112,
+  12702708,
+  12711309,
+  12719917,
+  12728530,
+  12737149,
+  12745773,
+  12754404,
+  12763040,
+  12771682,
+  12780331,
+  12788985,
+  12797644,
+  12806310,
+  12814982,
+  12823659,
+  12832342,
+  12841031,
+  12849727,
+  12858427,
+  12867134,
+  12875847,
+  12884566,
+  12893290,
+  12902021,
+  12910757,
+  12919499,
+  12928247,
+  12937002,
+  12945762,
+  12954528,
+  12963299,
+  12972077,
+  12980861,
+  12989651,
+  12998447,
+  13007248,
+  13016056,
+  13024869,
+  13033689,
+  13042514,
+  13051346,
+  13060183,
+  13069027,
+  13077876,
+  13086732,
+  13095593,
+  13104461,
+  13113334,
+  13122213,
+  13131099,
+  13139990,
+  13148888,
+  13157791,
+  13166701,
+  13175616,
+  13184538,
+  13193466,
+  13202399,
+  13211339,
+  13220285,
+  13229237,
+  13238195,
+  13247159,
+  13256129,
+  13265105,
+  13274087,
+  13283075,
+  13292070,
+  13301070,
+  13310077,
+  13319090,
+  13328108,
+  13337133,
+  13346164,
+  13355201,
+  13364244,
+  13373294,
+  13382349,
+  13391411,
+  13400479,
+  13409553,
+  13418633,
+  13427719,
+  13436811,
+  13445910,
+  13455014,
+  13464125,
+  13473242,
+  13482365,
+  13491494,
+  13500630,
+  13509772,
+  13518919,
+  13528074,
+  13537234,
+  13546400,
+  13555573,
+  13564752,
+  13573937,
+  13583128,
+  13592326,
+  13601530,
+  13610740,
+  13619956,
+  13629178,
+  13638407,
+  13647642,
+  13656883,
+  13666131,
+  13675385,
+  13684645,
+  13693911,
+  13703183,
+  13712462,
+  13721747,
+  13731039,
+  13740337,
+  13749641,
+  13758951,
+  13768268,
+  13777590,
+  13786920,
+  13796255,
+  13805597,
+  13814945,
+  13824300,
+  13833661,
+  13843028,
+  13852401,
+  13861781,
+  13871168,
+  13880560,
+  13889959,
+  13899364,
+  13908776,
+  13918194,
+  13927619,
+  13937049,
+  13946487,
+  13955930,
+  13965380,
+  13974837,
+  13984299,
+  13993769,
+  14003244,
+  14012726,
+  14022215,
+  14031709,
+  14041211,
+  14050719,
+  14060233,
+  14069753,
+  14079280,
+  14088814,
+  14098354,
+  14107900,
+  14117453,
+  14127013,
+  14136578,
+  14146151,
+  14155729,
+  14165315,
+  14174907,
+  14184505,
+  14194110,
+  14203721,
+  14213339,
+  14222963,
+  14232594,
+  14242231,
+  14251875,
+  14261525,
+  14271182,
+  14280846,
+  14290516,
+  14300192,
+  14309875,
+  14319565,
+  14329261,
+  14338964,
+  14348673,
+  14358389,
+  14368112,
+  14377841,
+  14387576,
+  14397319,
+  14407068,
+  14416823,
+  14426585,
+  14436354,
+  14446129,
+  14455911,
+  14465700,
+  14475495,
+  14485297,
+  14495105,
+  14504920,
+  14514742,
+  14524570,
+  14534405,
+  14544247,
+  14554095,
+  14563950,
+  14573812,
+  14583680,
+  14593555,
+  14603437,
+  14613326,
+  14623221,
+  14633123,
+  14643031,
+  14652946,
+  14662868,
+  14672797,
+  14682732,
+  14692675,
+  14702623,
+  14712579,
+  14722541,
+  14732510,
+  14742486,
+  14752469,
+  14762458,
+  14772454,
+  14782457,
+  14792467,
+  14802483,
+  14812506,
+  14822537,
+  14832573,
+  14842617,
+  14852667,
+  14862724,
+  14872788,
+  14882859,
+  14892937,
+  14903021,
+  14913113,
+  14923211,
+  14933316,
+  14943428,
+  14953546,
+  14963672,
+  14973804,
+  14983943,
+  14994089,
+  15004242,
+  15014402,
+  15024569,
+  15034743,
+  15044923,
+  15055110,
+  15065305,
+  15075506,
+  15085714,
+  15095929,
+  15106151,
+  15116380,
+  15126615,
+  15136858,
+  15147108,
+  15157364,
+  15167628,
+  15177898,
+  15188176,
+  15198460,
+  15208752,
+  15219050,
+  15229355,
+  15239667,
+  15249987,
+  15260313,
+  15270646,
+  15280986,
+  15291334,
+  15301688,
+  15312049,
+  15322417,
+  15332793,
+  15343175,
+  15353564,
+  15363961,
+  15374364,
+  15384774,
+  15395192,
+  15405616,
+  15416048,
+  15426487,
+  15436933,
+  15447385,
+  15457845,
+  15468312,
+  15478786,
+  15489267,
+  15499756,
+  15510251,
+  15520754,
+  15531263,
+  15541780,
+  15552304,
+  15562835,
+  15573373,
+  15583918,
+  15594470,
+  15605030,
+  15615596,
+  15626170,
+  15636751,
+  15647339,
+  15657935,
+  15668537,
+  15679147,
+  15689763,
+  15700387,
+  15711019,
+  15721657,
+  15732303,
+  15742956,
+  15753616,
+  15764283,
+  15774957,
+  15785639,
+  15796328,
+  15807024,
+  15817728,
+  15828438,
+  15839156,
+  15849881,
+  15860614,
+  15871353,
+  15882100,
+  15892855,
+  15903616,
+  15914385,
+  15925161,
+  15935945,
+  15946735,
+  15957533,
+  15968339,
+  15979151,
+  15989971,
+  16000799,
+  16011633,
+  16022475,
+  16033325,
+  16044181,
+  16055045,
+  16065917,
+  16076795,
+  16087681,
+  16098575,
+  16109476,
+  16120384,
+  16131300,
+  16142223,
+  16153153,
+  16164091,
+  16175036,
+  16185989,
+  16196949,
+  16207916,
+  16218891,
+  16229873,
+  16240863,
+  16251860,
+  16262865,
+  16273877,
+  16284896,
+  16295923,
+  16306958,
+  16318000,
+  16329049,
+  16340106,
+  16351171,
+  16362242,
+  16373322,
+  16384409,
+  16395503,
+  16406605,
+  16417714,
+  16428831,
+  16439956,
+  16451088,
+  16462227,
+  16473374,
+  16484529,
+  16495691,
+  16506861,
+  16518038,
+  16529223,
+  16540416,
+  16551616,
+  16562823,
+  16574038,
+  16585261,
+  16596492,
+  16607730,
+  16618975,
+  16630228,
+  16641489,
+  16652758,
+  16664034,
+  16675317,
+  16686609,
+  16697908,
+  16709215,
+  16720529,
+  16731851,
+  16743180,
+  16754518,
+  16765863,
+}}};
+
+/* normalization_factors */
+const Buffer<f, 17> Data::normalization_factors = {{{
+  0.00000000000000000000000000000000_f,
+  -0.40000000000000002220446049250313_f,
+  0.00130378096479777383365217247047_f,
+  0.00097751710654936374567114398815_f,
+  0.00313479623824441944179852725938_f,
+  0.00787401574803148207593039842322_f,
+  0.01818181818181807685164130816702_f,
+  0.03121852970795568893436211510561_f,
+  0.04774897680763978691231841366971_f,
+  0.06666666666666665186369300499791_f,
+  0.08767864040169959238824048952665_f,
+  0.10942578548212367195446859113872_f,
+  0.13274336283185839135967398760840_f,
+  0.15650209745079046719240523088956_f,
+  0.18081180811808117425698583247140_f,
+  0.20541494997057085925007413607091_f,
+  0.23007348784624070958670927211642_f,
+}}};
+
+/* cheby */
+const Buffer<Buffer<f, 257>, 12> Data::cheby = {{{
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.99218750000000000000000000000000_f,
+    -0.98437500000000000000000000000000_f,
+    -0.97656250000000000000000000000000_f,
+    -0.96875000000000000000000000000000_f,
+    -0.96093750000000000000000000000000_f,
+    -0.95312500000000000000000000000000_f,
+    -0.94531250000000000000000000000000_f,
+    -0.93750000000000000000000000000000_f,
+    -0.92968750000000000000000000000000_f,
+    -0.92187500000000000000000000000000_f,
+    -0.91406250000000000000000000000000_f,
+    -0.90625000000000000000000000000000_f,
+    -0.89843750000000000000000000000000_f,
+    -0.89062500000000000000000000000000_f,
+    -0.88281250000000000000000000000000_f,
+    -0.87500000000000000000000000000000_f,
+    -0.86718750000000000000000000000000_f,
+    -0.85937500000000000000000000000000_f,
+    -0.85156250000000000000000000000000_f,
+    -0.84375000000000000000000000000000_f,
+    -0.83593750000000000000000000000000_f,
+    -0.82812500000000000000000000000000_f,
+    -0.82031250000000000000000000000000_f,
+    -0.81250000000000000000000000000000_f,
+    -0.80468750000000000000000000000000_f,
+    -0.79687500000000000000000000000000_f,
+    -0.78906250000000000000000000000000_f,
+    -0.78125000000000000000000000000000_f,
+    -0.77343750000000000000000000000000_f,
+    -0.76562500000000000000000000000000_f,
+    -0.75781250000000000000000000000000_f,
+    -0.75000000000000000000000000000000_f,
+    -0.74218750000000000000000000000000_f,
+    -0.73437500000000000000000000000000_f,
+    -0.72656250000000000000000000000000_f,
+    -0.71875000000000000000000000000000_f,
+    -0.71093750000000000000000000000000_f,
+    -0.70312500000000000000000000000000_f,
+    -0.69531250000000000000000000000000_f,
+    -0.68750000000000000000000000000000_f,
+    -0.67968750000000000000000000000000_f,
+    -0.67187500000000000000000000000000_f,
+    -0.66406250000000000000000000000000_f,
+    -0.65625000000000000000000000000000_f,
+    -0.64843750000000000000000000000000_f,
+    -0.64062500000000000000000000000000_f,
+    -0.63281250000000000000000000000000_f,
+    -0.62500000000000000000000000000000_f,
+    -0.61718750000000000000000000000000_f,
+    -0.60937500000000000000000000000000_f,
+    -0.60156250000000000000000000000000_f,
+    -0.59375000000000000000000000000000_f,
+    -0.58593750000000000000000000000000_f,
+    -0.57812500000000000000000000000000_f,
+    -0.57031250000000000000000000000000_f,
+    -0.56250000000000000000000000000000_f,
+    -0.55468750000000000000000000000000_f,
+    -0.54687500000000000000000000000000_f,
+    -0.53906250000000000000000000000000_f,
+    -0.53125000000000000000000000000000_f,
+    -0.52343750000000000000000000000000_f,
+    -0.51562500000000000000000000000000_f,
+    -0.50781250000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.49218750000000000000000000000000_f,
+    -0.48437500000000000000000000000000_f,
+    -0.47656250000000000000000000000000_f,
+    -0.46875000000000000000000000000000_f,
+    -0.46093750000000000000000000000000_f,
+    -0.45312500000000000000000000000000_f,
+    -0.44531250000000000000000000000000_f,
+    -0.43750000000000000000000000000000_f,
+    -0.42968750000000000000000000000000_f,
+    -0.42187500000000000000000000000000_f,
+    -0.41406250000000000000000000000000_f,
+    -0.40625000000000000000000000000000_f,
+    -0.39843750000000000000000000000000_f,
+    -0.39062500000000000000000000000000_f,
+    -0.38281250000000000000000000000000_f,
+    -0.37500000000000000000000000000000_f,
+    -0.36718750000000000000000000000000_f,
+    -0.35937500000000000000000000000000_f,
+    -0.35156250000000000000000000000000_f,
+    -0.34375000000000000000000000000000_f,
+    -0.33593750000000000000000000000000_f,
+    -0.32812500000000000000000000000000_f,
+    -0.32031250000000000000000000000000_f,
+    -0.31250000000000000000000000000000_f,
+    -0.30468750000000000000000000000000_f,
+    -0.29687500000000000000000000000000_f,
+    -0.28906250000000000000000000000000_f,
+    -0.28125000000000000000000000000000_f,
+    -0.27343750000000000000000000000000_f,
+    -0.26562500000000000000000000000000_f,
+    -0.25781250000000000000000000000000_f,
+    -0.25000000000000000000000000000000_f,
+    -0.24218750000000000000000000000000_f,
+    -0.23437500000000000000000000000000_f,
+    -0.22656250000000000000000000000000_f,
+    -0.21875000000000000000000000000000_f,
+    -0.21093750000000000000000000000000_f,
+    -0.20312500000000000000000000000000_f,
+    -0.19531250000000000000000000000000_f,
+    -0.18750000000000000000000000000000_f,
+    -0.17968750000000000000000000000000_f,
+    -0.17187500000000000000000000000000_f,
+    -0.16406250000000000000000000000000_f,
+    -0.15625000000000000000000000000000_f,
+    -0.14843750000000000000000000000000_f,
+    -0.14062500000000000000000000000000_f,
+    -0.13281250000000000000000000000000_f,
+    -0.12500000000000000000000000000000_f,
+    -0.11718750000000000000000000000000_f,
+    -0.10937500000000000000000000000000_f,
+    -0.10156250000000000000000000000000_f,
+    -0.09375000000000000000000000000000_f,
+    -0.08593750000000000000000000000000_f,
+    -0.07812500000000000000000000000000_f,
+    -0.07031250000000000000000000000000_f,
+    -0.06250000000000000000000000000000_f,
+    -0.05468750000000000000000000000000_f,
+    -0.04687500000000000000000000000000_f,
+    -0.03906250000000000000000000000000_f,
+    -0.03125000000000000000000000000000_f,
+    -0.02343750000000000000000000000000_f,
+    -0.01562500000000000000000000000000_f,
+    -0.00781250000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    0.00781250000000000000000000000000_f,
+    0.01562500000000000000000000000000_f,
+    0.02343750000000000000000000000000_f,
+    0.03125000000000000000000000000000_f,
+    0.03906250000000000000000000000000_f,
+    0.04687500000000000000000000000000_f,
+    0.05468750000000000000000000000000_f,
+    0.06250000000000000000000000000000_f,
+    0.07031250000000000000000000000000_f,
+    0.07812500000000000000000000000000_f,
+    0.08593750000000000000000000000000_f,
+    0.09375000000000000000000000000000_f,
+    0.10156250000000000000000000000000_f,
+    0.10937500000000000000000000000000_f,
+    0.11718750000000000000000000000000_f,
+    0.12500000000000000000000000000000_f,
+    0.13281250000000000000000000000000_f,
+    0.14062500000000000000000000000000_f,
+    0.14843750000000000000000000000000_f,
+    0.15625000000000000000000000000000_f,
+    0.16406250000000000000000000000000_f,
+    0.17187500000000000000000000000000_f,
+    0.17968750000000000000000000000000_f,
+    0.18750000000000000000000000000000_f,
+    0.19531250000000000000000000000000_f,
+    0.20312500000000000000000000000000_f,
+    0.21093750000000000000000000000000_f,
+    0.21875000000000000000000000000000_f,
+    0.22656250000000000000000000000000_f,
+    0.23437500000000000000000000000000_f,
+    0.24218750000000000000000000000000_f,
+    0.25000000000000000000000000000000_f,
+    0.25781250000000000000000000000000_f,
+    0.26562500000000000000000000000000_f,
+    0.27343750000000000000000000000000_f,
+    0.28125000000000000000000000000000_f,
+    0.28906250000000000000000000000000_f,
+    0.29687500000000000000000000000000_f,
+    0.30468750000000000000000000000000_f,
+    0.31250000000000000000000000000000_f,
+    0.32031250000000000000000000000000_f,
+    0.32812500000000000000000000000000_f,
+    0.33593750000000000000000000000000_f,
+    0.34375000000000000000000000000000_f,
+    0.35156250000000000000000000000000_f,
+    0.35937500000000000000000000000000_f,
+    0.36718750000000000000000000000000_f,
+    0.37500000000000000000000000000000_f,
+    0.38281250000000000000000000000000_f,
+    0.39062500000000000000000000000000_f,
+    0.39843750000000000000000000000000_f,
+    0.40625000000000000000000000000000_f,
+    0.41406250000000000000000000000000_f,
+    0.42187500000000000000000000000000_f,
+    0.42968750000000000000000000000000_f,
+    0.43750000000000000000000000000000_f,
+    0.44531250000000000000000000000000_f,
+    0.45312500000000000000000000000000_f,
+    0.46093750000000000000000000000000_f,
+    0.46875000000000000000000000000000_f,
+    0.47656250000000000000000000000000_f,
+    0.48437500000000000000000000000000_f,
+    0.49218750000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    0.50781250000000000000000000000000_f,
+    0.51562500000000000000000000000000_f,
+    0.52343750000000000000000000000000_f,
+    0.53125000000000000000000000000000_f,
+    0.53906250000000000000000000000000_f,
+    0.54687500000000000000000000000000_f,
+    0.55468750000000000000000000000000_f,
+    0.56250000000000000000000000000000_f,
+    0.57031250000000000000000000000000_f,
+    0.57812500000000000000000000000000_f,
+    0.58593750000000000000000000000000_f,
+    0.59375000000000000000000000000000_f,
+    0.60156250000000000000000000000000_f,
+    0.60937500000000000000000000000000_f,
+    0.61718750000000000000000000000000_f,
+    0.62500000000000000000000000000000_f,
+    0.63281250000000000000000000000000_f,
+    0.64062500000000000000000000000000_f,
+    0.64843750000000000000000000000000_f,
+    0.65625000000000000000000000000000_f,
+    0.66406250000000000000000000000000_f,
+    0.67187500000000000000000000000000_f,
+    0.67968750000000000000000000000000_f,
+    0.68750000000000000000000000000000_f,
+    0.69531250000000000000000000000000_f,
+    0.70312500000000000000000000000000_f,
+    0.71093750000000000000000000000000_f,
+    0.71875000000000000000000000000000_f,
+    0.72656250000000000000000000000000_f,
+    0.73437500000000000000000000000000_f,
+    0.74218750000000000000000000000000_f,
+    0.75000000000000000000000000000000_f,
+    0.75781250000000000000000000000000_f,
+    0.76562500000000000000000000000000_f,
+    0.77343750000000000000000000000000_f,
+    0.78125000000000000000000000000000_f,
+    0.78906250000000000000000000000000_f,
+    0.79687500000000000000000000000000_f,
+    0.80468750000000000000000000000000_f,
+    0.81250000000000000000000000000000_f,
+    0.82031250000000000000000000000000_f,
+    0.82812500000000000000000000000000_f,
+    0.83593750000000000000000000000000_f,
+    0.84375000000000000000000000000000_f,
+    0.85156250000000000000000000000000_f,
+    0.85937500000000000000000000000000_f,
+    0.86718750000000000000000000000000_f,
+    0.87500000000000000000000000000000_f,
+    0.88281250000000000000000000000000_f,
+    0.89062500000000000000000000000000_f,
+    0.89843750000000000000000000000000_f,
+    0.90625000000000000000000000000000_f,
+    0.91406250000000000000000000000000_f,
+    0.92187500000000000000000000000000_f,
+    0.92968750000000000000000000000000_f,
+    0.93750000000000000000000000000000_f,
+    0.94531250000000000000000000000000_f,
+    0.95312500000000000000000000000000_f,
+    0.96093750000000000000000000000000_f,
+    0.96875000000000000000000000000000_f,
+    0.97656250000000000000000000000000_f,
+    0.98437500000000000000000000000000_f,
+    0.99218750000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.96887207031250000000000000000000_f,
+    0.93798828125000000000000000000000_f,
+    0.90734863281250000000000000000000_f,
+    0.87695312500000000000000000000000_f,
+    0.84680175781250000000000000000000_f,
+    0.81689453125000000000000000000000_f,
+    0.78723144531250000000000000000000_f,
+    0.75781250000000000000000000000000_f,
+    0.72863769531250000000000000000000_f,
+    0.69970703125000000000000000000000_f,
+    0.67102050781250000000000000000000_f,
+    0.64257812500000000000000000000000_f,
+    0.61437988281250000000000000000000_f,
+    0.58642578125000000000000000000000_f,
+    0.55871582031250000000000000000000_f,
+    0.53125000000000000000000000000000_f,
+    0.50402832031250000000000000000000_f,
+    0.47705078125000000000000000000000_f,
+    0.45031738281250000000000000000000_f,
+    0.42382812500000000000000000000000_f,
+    0.39758300781250000000000000000000_f,
+    0.37158203125000000000000000000000_f,
+    0.34582519531250000000000000000000_f,
+    0.32031250000000000000000000000000_f,
+    0.29504394531250000000000000000000_f,
+    0.27001953125000000000000000000000_f,
+    0.24523925781250000000000000000000_f,
+    0.22070312500000000000000000000000_f,
+    0.19641113281250000000000000000000_f,
+    0.17236328125000000000000000000000_f,
+    0.14855957031250000000000000000000_f,
+    0.12500000000000000000000000000000_f,
+    0.10168457031250000000000000000000_f,
+    0.07861328125000000000000000000000_f,
+    0.05578613281250000000000000000000_f,
+    0.03320312500000000000000000000000_f,
+    0.01086425781250000000000000000000_f,
+    -0.01123046875000000000000000000000_f,
+    -0.03308105468750000000000000000000_f,
+    -0.05468750000000000000000000000000_f,
+    -0.07604980468750000000000000000000_f,
+    -0.09716796875000000000000000000000_f,
+    -0.11804199218750000000000000000000_f,
+    -0.13867187500000000000000000000000_f,
+    -0.15905761718750000000000000000000_f,
+    -0.17919921875000000000000000000000_f,
+    -0.19909667968750000000000000000000_f,
+    -0.21875000000000000000000000000000_f,
+    -0.23815917968750000000000000000000_f,
+    -0.25732421875000000000000000000000_f,
+    -0.27624511718750000000000000000000_f,
+    -0.29492187500000000000000000000000_f,
+    -0.31335449218750000000000000000000_f,
+    -0.33154296875000000000000000000000_f,
+    -0.34948730468750000000000000000000_f,
+    -0.36718750000000000000000000000000_f,
+    -0.38464355468750000000000000000000_f,
+    -0.40185546875000000000000000000000_f,
+    -0.41882324218750000000000000000000_f,
+    -0.43554687500000000000000000000000_f,
+    -0.45202636718750000000000000000000_f,
+    -0.46826171875000000000000000000000_f,
+    -0.48425292968750000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.51550292968750000000000000000000_f,
+    -0.53076171875000000000000000000000_f,
+    -0.54577636718750000000000000000000_f,
+    -0.56054687500000000000000000000000_f,
+    -0.57507324218750000000000000000000_f,
+    -0.58935546875000000000000000000000_f,
+    -0.60339355468750000000000000000000_f,
+    -0.61718750000000000000000000000000_f,
+    -0.63073730468750000000000000000000_f,
+    -0.64404296875000000000000000000000_f,
+    -0.65710449218750000000000000000000_f,
+    -0.66992187500000000000000000000000_f,
+    -0.68249511718750000000000000000000_f,
+    -0.69482421875000000000000000000000_f,
+    -0.70690917968750000000000000000000_f,
+    -0.71875000000000000000000000000000_f,
+    -0.73034667968750000000000000000000_f,
+    -0.74169921875000000000000000000000_f,
+    -0.75280761718750000000000000000000_f,
+    -0.76367187500000000000000000000000_f,
+    -0.77429199218750000000000000000000_f,
+    -0.78466796875000000000000000000000_f,
+    -0.79479980468750000000000000000000_f,
+    -0.80468750000000000000000000000000_f,
+    -0.81433105468750000000000000000000_f,
+    -0.82373046875000000000000000000000_f,
+    -0.83288574218750000000000000000000_f,
+    -0.84179687500000000000000000000000_f,
+    -0.85046386718750000000000000000000_f,
+    -0.85888671875000000000000000000000_f,
+    -0.86706542968750000000000000000000_f,
+    -0.87500000000000000000000000000000_f,
+    -0.88269042968750000000000000000000_f,
+    -0.89013671875000000000000000000000_f,
+    -0.89733886718750000000000000000000_f,
+    -0.90429687500000000000000000000000_f,
+    -0.91101074218750000000000000000000_f,
+    -0.91748046875000000000000000000000_f,
+    -0.92370605468750000000000000000000_f,
+    -0.92968750000000000000000000000000_f,
+    -0.93542480468750000000000000000000_f,
+    -0.94091796875000000000000000000000_f,
+    -0.94616699218750000000000000000000_f,
+    -0.95117187500000000000000000000000_f,
+    -0.95593261718750000000000000000000_f,
+    -0.96044921875000000000000000000000_f,
+    -0.96472167968750000000000000000000_f,
+    -0.96875000000000000000000000000000_f,
+    -0.97253417968750000000000000000000_f,
+    -0.97607421875000000000000000000000_f,
+    -0.97937011718750000000000000000000_f,
+    -0.98242187500000000000000000000000_f,
+    -0.98522949218750000000000000000000_f,
+    -0.98779296875000000000000000000000_f,
+    -0.99011230468750000000000000000000_f,
+    -0.99218750000000000000000000000000_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99560546875000000000000000000000_f,
+    -0.99694824218750000000000000000000_f,
+    -0.99804687500000000000000000000000_f,
+    -0.99890136718750000000000000000000_f,
+    -0.99951171875000000000000000000000_f,
+    -0.99987792968750000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -0.99987792968750000000000000000000_f,
+    -0.99951171875000000000000000000000_f,
+    -0.99890136718750000000000000000000_f,
+    -0.99804687500000000000000000000000_f,
+    -0.99694824218750000000000000000000_f,
+    -0.99560546875000000000000000000000_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99218750000000000000000000000000_f,
+    -0.99011230468750000000000000000000_f,
+    -0.98779296875000000000000000000000_f,
+    -0.98522949218750000000000000000000_f,
+    -0.98242187500000000000000000000000_f,
+    -0.97937011718750000000000000000000_f,
+    -0.97607421875000000000000000000000_f,
+    -0.97253417968750000000000000000000_f,
+    -0.96875000000000000000000000000000_f,
+    -0.96472167968750000000000000000000_f,
+    -0.96044921875000000000000000000000_f,
+    -0.95593261718750000000000000000000_f,
+    -0.95117187500000000000000000000000_f,
+    -0.94616699218750000000000000000000_f,
+    -0.94091796875000000000000000000000_f,
+    -0.93542480468750000000000000000000_f,
+    -0.92968750000000000000000000000000_f,
+    -0.92370605468750000000000000000000_f,
+    -0.91748046875000000000000000000000_f,
+    -0.91101074218750000000000000000000_f,
+    -0.90429687500000000000000000000000_f,
+    -0.89733886718750000000000000000000_f,
+    -0.89013671875000000000000000000000_f,
+    -0.88269042968750000000000000000000_f,
+    -0.87500000000000000000000000000000_f,
+    -0.86706542968750000000000000000000_f,
+    -0.85888671875000000000000000000000_f,
+    -0.85046386718750000000000000000000_f,
+    -0.84179687500000000000000000000000_f,
+    -0.83288574218750000000000000000000_f,
+    -0.82373046875000000000000000000000_f,
+    -0.81433105468750000000000000000000_f,
+    -0.80468750000000000000000000000000_f,
+    -0.79479980468750000000000000000000_f,
+    -0.78466796875000000000000000000000_f,
+    -0.77429199218750000000000000000000_f,
+    -0.76367187500000000000000000000000_f,
+    -0.75280761718750000000000000000000_f,
+    -0.74169921875000000000000000000000_f,
+    -0.73034667968750000000000000000000_f,
+    -0.71875000000000000000000000000000_f,
+    -0.70690917968750000000000000000000_f,
+    -0.69482421875000000000000000000000_f,
+    -0.68249511718750000000000000000000_f,
+    -0.66992187500000000000000000000000_f,
+    -0.65710449218750000000000000000000_f,
+    -0.64404296875000000000000000000000_f,
+    -0.63073730468750000000000000000000_f,
+    -0.61718750000000000000000000000000_f,
+    -0.60339355468750000000000000000000_f,
+    -0.58935546875000000000000000000000_f,
+    -0.57507324218750000000000000000000_f,
+    -0.56054687500000000000000000000000_f,
+    -0.54577636718750000000000000000000_f,
+    -0.53076171875000000000000000000000_f,
+    -0.51550292968750000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.48425292968750000000000000000000_f,
+    -0.46826171875000000000000000000000_f,
+    -0.45202636718750000000000000000000_f,
+    -0.43554687500000000000000000000000_f,
+    -0.41882324218750000000000000000000_f,
+    -0.40185546875000000000000000000000_f,
+    -0.38464355468750000000000000000000_f,
+    -0.36718750000000000000000000000000_f,
+    -0.34948730468750000000000000000000_f,
+    -0.33154296875000000000000000000000_f,
+    -0.31335449218750000000000000000000_f,
+    -0.29492187500000000000000000000000_f,
+    -0.27624511718750000000000000000000_f,
+    -0.25732421875000000000000000000000_f,
+    -0.23815917968750000000000000000000_f,
+    -0.21875000000000000000000000000000_f,
+    -0.19909667968750000000000000000000_f,
+    -0.17919921875000000000000000000000_f,
+    -0.15905761718750000000000000000000_f,
+    -0.13867187500000000000000000000000_f,
+    -0.11804199218750000000000000000000_f,
+    -0.09716796875000000000000000000000_f,
+    -0.07604980468750000000000000000000_f,
+    -0.05468750000000000000000000000000_f,
+    -0.03308105468750000000000000000000_f,
+    -0.01123046875000000000000000000000_f,
+    0.01086425781250000000000000000000_f,
+    0.03320312500000000000000000000000_f,
+    0.05578613281250000000000000000000_f,
+    0.07861328125000000000000000000000_f,
+    0.10168457031250000000000000000000_f,
+    0.12500000000000000000000000000000_f,
+    0.14855957031250000000000000000000_f,
+    0.17236328125000000000000000000000_f,
+    0.19641113281250000000000000000000_f,
+    0.22070312500000000000000000000000_f,
+    0.24523925781250000000000000000000_f,
+    0.27001953125000000000000000000000_f,
+    0.29504394531250000000000000000000_f,
+    0.32031250000000000000000000000000_f,
+    0.34582519531250000000000000000000_f,
+    0.37158203125000000000000000000000_f,
+    0.39758300781250000000000000000000_f,
+    0.42382812500000000000000000000000_f,
+    0.45031738281250000000000000000000_f,
+    0.47705078125000000000000000000000_f,
+    0.50402832031250000000000000000000_f,
+    0.53125000000000000000000000000000_f,
+    0.55871582031250000000000000000000_f,
+    0.58642578125000000000000000000000_f,
+    0.61437988281250000000000000000000_f,
+    0.64257812500000000000000000000000_f,
+    0.67102050781250000000000000000000_f,
+    0.69970703125000000000000000000000_f,
+    0.72863769531250000000000000000000_f,
+    0.75781250000000000000000000000000_f,
+    0.78723144531250000000000000000000_f,
+    0.81689453125000000000000000000000_f,
+    0.84680175781250000000000000000000_f,
+    0.87695312500000000000000000000000_f,
+    0.90734863281250000000000000000000_f,
+    0.93798828125000000000000000000000_f,
+    0.96887207031250000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.93041801452636718750000000000000_f,
+    -0.86228942871093750000000000000000_f,
+    -0.79560279846191406250000000000000_f,
+    -0.73034667968750000000000000000000_f,
+    -0.66650962829589843750000000000000_f,
+    -0.60408020019531250000000000000000_f,
+    -0.54304695129394531250000000000000_f,
+    -0.48339843750000000000000000000000_f,
+    -0.42512321472167968750000000000000_f,
+    -0.36820983886718750000000000000000_f,
+    -0.31264686584472656250000000000000_f,
+    -0.25842285156250000000000000000000_f,
+    -0.20552635192871093750000000000000_f,
+    -0.15394592285156250000000000000000_f,
+    -0.10367012023925781250000000000000_f,
+    -0.05468750000000000000000000000000_f,
+    -0.00698661804199218750000000000000_f,
+    0.03944396972656250000000000000000_f,
+    0.08461570739746093750000000000000_f,
+    0.12854003906250000000000000000000_f,
+    0.17122840881347656250000000000000_f,
+    0.21269226074218750000000000000000_f,
+    0.25294303894042968750000000000000_f,
+    0.29199218750000000000000000000000_f,
+    0.32985115051269531250000000000000_f,
+    0.36653137207031250000000000000000_f,
+    0.40204429626464843750000000000000_f,
+    0.43640136718750000000000000000000_f,
+    0.46961402893066406250000000000000_f,
+    0.50169372558593750000000000000000_f,
+    0.53265190124511718750000000000000_f,
+    0.56250000000000000000000000000000_f,
+    0.59124946594238281250000000000000_f,
+    0.61891174316406250000000000000000_f,
+    0.64549827575683593750000000000000_f,
+    0.67102050781250000000000000000000_f,
+    0.69548988342285156250000000000000_f,
+    0.71891784667968750000000000000000_f,
+    0.74131584167480468750000000000000_f,
+    0.76269531250000000000000000000000_f,
+    0.78306770324707031250000000000000_f,
+    0.80244445800781250000000000000000_f,
+    0.82083702087402343750000000000000_f,
+    0.83825683593750000000000000000000_f,
+    0.85471534729003906250000000000000_f,
+    0.87022399902343750000000000000000_f,
+    0.88479423522949218750000000000000_f,
+    0.89843750000000000000000000000000_f,
+    0.91116523742675781250000000000000_f,
+    0.92298889160156250000000000000000_f,
+    0.93391990661621093750000000000000_f,
+    0.94396972656250000000000000000000_f,
+    0.95314979553222656250000000000000_f,
+    0.96147155761718750000000000000000_f,
+    0.96894645690917968750000000000000_f,
+    0.97558593750000000000000000000000_f,
+    0.98140144348144531250000000000000_f,
+    0.98640441894531250000000000000000_f,
+    0.99060630798339843750000000000000_f,
+    0.99401855468750000000000000000000_f,
+    0.99665260314941406250000000000000_f,
+    0.99851989746093750000000000000000_f,
+    0.99963188171386718750000000000000_f,
+    1.00000000000000000000000000000000_f,
+    0.99963569641113281250000000000000_f,
+    0.99855041503906250000000000000000_f,
+    0.99675559997558593750000000000000_f,
+    0.99426269531250000000000000000000_f,
+    0.99108314514160156250000000000000_f,
+    0.98722839355468750000000000000000_f,
+    0.98270988464355468750000000000000_f,
+    0.97753906250000000000000000000000_f,
+    0.97172737121582031250000000000000_f,
+    0.96528625488281250000000000000000_f,
+    0.95822715759277343750000000000000_f,
+    0.95056152343750000000000000000000_f,
+    0.94230079650878906250000000000000_f,
+    0.93345642089843750000000000000000_f,
+    0.92403984069824218750000000000000_f,
+    0.91406250000000000000000000000000_f,
+    0.90353584289550781250000000000000_f,
+    0.89247131347656250000000000000000_f,
+    0.88088035583496093750000000000000_f,
+    0.86877441406250000000000000000000_f,
+    0.85616493225097656250000000000000_f,
+    0.84306335449218750000000000000000_f,
+    0.82948112487792968750000000000000_f,
+    0.81542968750000000000000000000000_f,
+    0.80092048645019531250000000000000_f,
+    0.78596496582031250000000000000000_f,
+    0.77057456970214843750000000000000_f,
+    0.75476074218750000000000000000000_f,
+    0.73853492736816406250000000000000_f,
+    0.72190856933593750000000000000000_f,
+    0.70489311218261718750000000000000_f,
+    0.68750000000000000000000000000000_f,
+    0.66974067687988281250000000000000_f,
+    0.65162658691406250000000000000000_f,
+    0.63316917419433593750000000000000_f,
+    0.61437988281250000000000000000000_f,
+    0.59527015686035156250000000000000_f,
+    0.57585144042968750000000000000000_f,
+    0.55613517761230468750000000000000_f,
+    0.53613281250000000000000000000000_f,
+    0.51585578918457031250000000000000_f,
+    0.49531555175781250000000000000000_f,
+    0.47452354431152343750000000000000_f,
+    0.45349121093750000000000000000000_f,
+    0.43222999572753906250000000000000_f,
+    0.41075134277343750000000000000000_f,
+    0.38906669616699218750000000000000_f,
+    0.36718750000000000000000000000000_f,
+    0.34512519836425781250000000000000_f,
+    0.32289123535156250000000000000000_f,
+    0.30049705505371093750000000000000_f,
+    0.27795410156250000000000000000000_f,
+    0.25527381896972656250000000000000_f,
+    0.23246765136718750000000000000000_f,
+    0.20954704284667968750000000000000_f,
+    0.18652343750000000000000000000000_f,
+    0.16340827941894531250000000000000_f,
+    0.14021301269531250000000000000000_f,
+    0.11694908142089843750000000000000_f,
+    0.09362792968750000000000000000000_f,
+    0.07026100158691406250000000000000_f,
+    0.04685974121093750000000000000000_f,
+    0.02343559265136718750000000000000_f,
+    -0.00000000000000000000000000000000_f,
+    -0.02343559265136718750000000000000_f,
+    -0.04685974121093750000000000000000_f,
+    -0.07026100158691406250000000000000_f,
+    -0.09362792968750000000000000000000_f,
+    -0.11694908142089843750000000000000_f,
+    -0.14021301269531250000000000000000_f,
+    -0.16340827941894531250000000000000_f,
+    -0.18652343750000000000000000000000_f,
+    -0.20954704284667968750000000000000_f,
+    -0.23246765136718750000000000000000_f,
+    -0.25527381896972656250000000000000_f,
+    -0.27795410156250000000000000000000_f,
+    -0.30049705505371093750000000000000_f,
+    -0.32289123535156250000000000000000_f,
+    -0.34512519836425781250000000000000_f,
+    -0.36718750000000000000000000000000_f,
+    -0.38906669616699218750000000000000_f,
+    -0.41075134277343750000000000000000_f,
+    -0.43222999572753906250000000000000_f,
+    -0.45349121093750000000000000000000_f,
+    -0.47452354431152343750000000000000_f,
+    -0.49531555175781250000000000000000_f,
+    -0.51585578918457031250000000000000_f,
+    -0.53613281250000000000000000000000_f,
+    -0.55613517761230468750000000000000_f,
+    -0.57585144042968750000000000000000_f,
+    -0.59527015686035156250000000000000_f,
+    -0.61437988281250000000000000000000_f,
+    -0.63316917419433593750000000000000_f,
+    -0.65162658691406250000000000000000_f,
+    -0.66974067687988281250000000000000_f,
+    -0.68750000000000000000000000000000_f,
+    -0.70489311218261718750000000000000_f,
+    -0.72190856933593750000000000000000_f,
+    -0.73853492736816406250000000000000_f,
+    -0.75476074218750000000000000000000_f,
+    -0.77057456970214843750000000000000_f,
+    -0.78596496582031250000000000000000_f,
+    -0.80092048645019531250000000000000_f,
+    -0.81542968750000000000000000000000_f,
+    -0.82948112487792968750000000000000_f,
+    -0.84306335449218750000000000000000_f,
+    -0.85616493225097656250000000000000_f,
+    -0.86877441406250000000000000000000_f,
+    -0.88088035583496093750000000000000_f,
+    -0.89247131347656250000000000000000_f,
+    -0.90353584289550781250000000000000_f,
+    -0.91406250000000000000000000000000_f,
+    -0.92403984069824218750000000000000_f,
+    -0.93345642089843750000000000000000_f,
+    -0.94230079650878906250000000000000_f,
+    -0.95056152343750000000000000000000_f,
+    -0.95822715759277343750000000000000_f,
+    -0.96528625488281250000000000000000_f,
+    -0.97172737121582031250000000000000_f,
+    -0.97753906250000000000000000000000_f,
+    -0.98270988464355468750000000000000_f,
+    -0.98722839355468750000000000000000_f,
+    -0.99108314514160156250000000000000_f,
+    -0.99426269531250000000000000000000_f,
+    -0.99675559997558593750000000000000_f,
+    -0.99855041503906250000000000000000_f,
+    -0.99963569641113281250000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -0.99963188171386718750000000000000_f,
+    -0.99851989746093750000000000000000_f,
+    -0.99665260314941406250000000000000_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99060630798339843750000000000000_f,
+    -0.98640441894531250000000000000000_f,
+    -0.98140144348144531250000000000000_f,
+    -0.97558593750000000000000000000000_f,
+    -0.96894645690917968750000000000000_f,
+    -0.96147155761718750000000000000000_f,
+    -0.95314979553222656250000000000000_f,
+    -0.94396972656250000000000000000000_f,
+    -0.93391990661621093750000000000000_f,
+    -0.92298889160156250000000000000000_f,
+    -0.91116523742675781250000000000000_f,
+    -0.89843750000000000000000000000000_f,
+    -0.88479423522949218750000000000000_f,
+    -0.87022399902343750000000000000000_f,
+    -0.85471534729003906250000000000000_f,
+    -0.83825683593750000000000000000000_f,
+    -0.82083702087402343750000000000000_f,
+    -0.80244445800781250000000000000000_f,
+    -0.78306770324707031250000000000000_f,
+    -0.76269531250000000000000000000000_f,
+    -0.74131584167480468750000000000000_f,
+    -0.71891784667968750000000000000000_f,
+    -0.69548988342285156250000000000000_f,
+    -0.67102050781250000000000000000000_f,
+    -0.64549827575683593750000000000000_f,
+    -0.61891174316406250000000000000000_f,
+    -0.59124946594238281250000000000000_f,
+    -0.56250000000000000000000000000000_f,
+    -0.53265190124511718750000000000000_f,
+    -0.50169372558593750000000000000000_f,
+    -0.46961402893066406250000000000000_f,
+    -0.43640136718750000000000000000000_f,
+    -0.40204429626464843750000000000000_f,
+    -0.36653137207031250000000000000000_f,
+    -0.32985115051269531250000000000000_f,
+    -0.29199218750000000000000000000000_f,
+    -0.25294303894042968750000000000000_f,
+    -0.21269226074218750000000000000000_f,
+    -0.17122840881347656250000000000000_f,
+    -0.12854003906250000000000000000000_f,
+    -0.08461570739746093750000000000000_f,
+    -0.03944396972656250000000000000000_f,
+    0.00698661804199218750000000000000_f,
+    0.05468750000000000000000000000000_f,
+    0.10367012023925781250000000000000_f,
+    0.15394592285156250000000000000000_f,
+    0.20552635192871093750000000000000_f,
+    0.25842285156250000000000000000000_f,
+    0.31264686584472656250000000000000_f,
+    0.36820983886718750000000000000000_f,
+    0.42512321472167968750000000000000_f,
+    0.48339843750000000000000000000000_f,
+    0.54304695129394531250000000000000_f,
+    0.60408020019531250000000000000000_f,
+    0.66650962829589843750000000000000_f,
+    0.73034667968750000000000000000000_f,
+    0.79560279846191406250000000000000_f,
+    0.86228942871093750000000000000000_f,
+    0.93041801452636718750000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.87742617726325988769531250000000_f,
+    0.75964403152465820312500000000000_f,
+    0.64656308293342590332031250000000_f,
+    0.53809356689453125000000000000000_f,
+    0.43414643406867980957031250000000_f,
+    0.33463335037231445312500000000000_f,
+    0.23946669697761535644531250000000_f,
+    0.14855957031250000000000000000000_f,
+    0.06182578206062316894531250000000_f,
+    -0.02082014083862304687500000000000_f,
+    -0.09946295619010925292968750000000_f,
+    -0.17418670654296875000000000000000_f,
+    -0.24507471919059753417968750000000_f,
+    -0.31220960617065429687500000000000_f,
+    -0.37567326426506042480468750000000_f,
+    -0.43554687500000000000000000000000_f,
+    -0.49191090464591979980468750000000_f,
+    -0.54484510421752929687500000000000_f,
+    -0.59442850947380065917968750000000_f,
+    -0.64073944091796875000000000000000_f,
+    -0.68385550379753112792968750000000_f,
+    -0.72385358810424804687500000000000_f,
+    -0.76080986857414245605468750000000_f,
+    -0.79479980468750000000000000000000_f,
+    -0.82589814066886901855468750000000_f,
+    -0.85417890548706054687500000000000_f,
+    -0.87971541285514831542968750000000_f,
+    -0.90258026123046875000000000000000_f,
+    -0.92284533381462097167968750000000_f,
+    -0.94058179855346679687500000000000_f,
+    -0.95586010813713073730468750000000_f,
+    -0.96875000000000000000000000000000_f,
+    -0.97932049632072448730468750000000_f,
+    -0.98763990402221679687500000000000_f,
+    -0.99377581477165222167968750000000_f,
+    -0.99779510498046875000000000000000_f,
+    -0.99976393580436706542968750000000_f,
+    -0.99974775314331054687500000000000_f,
+    -0.99781128764152526855468750000000_f,
+    -0.99401855468750000000000000000000_f,
+    -0.98843285441398620605468750000000_f,
+    -0.98111677169799804687500000000000_f,
+    -0.97213217616081237792968750000000_f,
+    -0.96154022216796875000000000000000_f,
+    -0.94940134882926940917968750000000_f,
+    -0.93577527999877929687500000000000_f,
+    -0.92072102427482604980468750000000_f,
+    -0.90429687500000000000000000000000_f,
+    -0.88656041026115417480468750000000_f,
+    -0.86756849288940429687500000000000_f,
+    -0.84737727046012878417968750000000_f,
+    -0.82604217529296875000000000000000_f,
+    -0.80361792445182800292968750000000_f,
+    -0.78015851974487304687500000000000_f,
+    -0.75571724772453308105468750000000_f,
+    -0.73034667968750000000000000000000_f,
+    -0.70409867167472839355468750000000_f,
+    -0.67702436447143554687500000000000_f,
+    -0.64917418360710144042968750000000_f,
+    -0.62059783935546875000000000000000_f,
+    -0.59134432673454284667968750000000_f,
+    -0.56146192550659179687500000000000_f,
+    -0.53099820017814636230468750000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.46851345896720886230468750000000_f,
+    -0.43658399581909179687500000000000_f,
+    -0.40425631403923034667968750000000_f,
+    -0.37157440185546875000000000000000_f,
+    -0.33858153223991394042968750000000_f,
+    -0.30532026290893554687500000000000_f,
+    -0.27183243632316589355468750000000_f,
+    -0.23815917968750000000000000000000_f,
+    -0.20434090495109558105468750000000_f,
+    -0.17041730880737304687500000000000_f,
+    -0.13642737269401550292968750000000_f,
+    -0.10240936279296875000000000000000_f,
+    -0.06840083003044128417968750000000_f,
+    -0.03443861007690429687500000000000_f,
+    -0.00055882334709167480468750000000_f,
+    0.03320312500000000000000000000000_f,
+    0.06681254506111145019531250000000_f,
+    0.10023546218872070312500000000000_f,
+    0.13343861699104309082031250000000_f,
+    0.16638946533203125000000000000000_f,
+    0.19905617833137512207031250000000_f,
+    0.23140764236450195312500000000000_f,
+    0.26341345906257629394531250000000_f,
+    0.29504394531250000000000000000000_f,
+    0.32627013325691223144531250000000_f,
+    0.35706377029418945312500000000000_f,
+    0.38739731907844543457031250000000_f,
+    0.41724395751953125000000000000000_f,
+    0.44657757878303527832031250000000_f,
+    0.47537279129028320312500000000000_f,
+    0.50360491871833801269531250000000_f,
+    0.53125000000000000000000000000000_f,
+    0.55828478932380676269531250000000_f,
+    0.58468675613403320312500000000000_f,
+    0.61043408513069152832031250000000_f,
+    0.63550567626953125000000000000000_f,
+    0.65988114476203918457031250000000_f,
+    0.68354082107543945312500000000000_f,
+    0.70646575093269348144531250000000_f,
+    0.72863769531250000000000000000000_f,
+    0.75003913044929504394531250000000_f,
+    0.77065324783325195312500000000000_f,
+    0.79046395421028137207031250000000_f,
+    0.80945587158203125000000000000000_f,
+    0.82761433720588684082031250000000_f,
+    0.84492540359497070312500000000000_f,
+    0.86137583851814270019531250000000_f,
+    0.87695312500000000000000000000000_f,
+    0.89164546132087707519531250000000_f,
+    0.90544176101684570312500000000000_f,
+    0.91833165287971496582031250000000_f,
+    0.93030548095703125000000000000000_f,
+    0.94135430455207824707031250000000_f,
+    0.95146989822387695312500000000000_f,
+    0.96064475178718566894531250000000_f,
+    0.96887207031250000000000000000000_f,
+    0.97614577412605285644531250000000_f,
+    0.98246049880981445312500000000000_f,
+    0.98781159520149230957031250000000_f,
+    0.99219512939453125000000000000000_f,
+    0.99560788273811340332031250000000_f,
+    0.99804735183715820312500000000000_f,
+    0.99951174855232238769531250000000_f,
+    1.00000000000000000000000000000000_f,
+    0.99951174855232238769531250000000_f,
+    0.99804735183715820312500000000000_f,
+    0.99560788273811340332031250000000_f,
+    0.99219512939453125000000000000000_f,
+    0.98781159520149230957031250000000_f,
+    0.98246049880981445312500000000000_f,
+    0.97614577412605285644531250000000_f,
+    0.96887207031250000000000000000000_f,
+    0.96064475178718566894531250000000_f,
+    0.95146989822387695312500000000000_f,
+    0.94135430455207824707031250000000_f,
+    0.93030548095703125000000000000000_f,
+    0.91833165287971496582031250000000_f,
+    0.90544176101684570312500000000000_f,
+    0.89164546132087707519531250000000_f,
+    0.87695312500000000000000000000000_f,
+    0.86137583851814270019531250000000_f,
+    0.84492540359497070312500000000000_f,
+    0.82761433720588684082031250000000_f,
+    0.80945587158203125000000000000000_f,
+    0.79046395421028137207031250000000_f,
+    0.77065324783325195312500000000000_f,
+    0.75003913044929504394531250000000_f,
+    0.72863769531250000000000000000000_f,
+    0.70646575093269348144531250000000_f,
+    0.68354082107543945312500000000000_f,
+    0.65988114476203918457031250000000_f,
+    0.63550567626953125000000000000000_f,
+    0.61043408513069152832031250000000_f,
+    0.58468675613403320312500000000000_f,
+    0.55828478932380676269531250000000_f,
+    0.53125000000000000000000000000000_f,
+    0.50360491871833801269531250000000_f,
+    0.47537279129028320312500000000000_f,
+    0.44657757878303527832031250000000_f,
+    0.41724395751953125000000000000000_f,
+    0.38739731907844543457031250000000_f,
+    0.35706377029418945312500000000000_f,
+    0.32627013325691223144531250000000_f,
+    0.29504394531250000000000000000000_f,
+    0.26341345906257629394531250000000_f,
+    0.23140764236450195312500000000000_f,
+    0.19905617833137512207031250000000_f,
+    0.16638946533203125000000000000000_f,
+    0.13343861699104309082031250000000_f,
+    0.10023546218872070312500000000000_f,
+    0.06681254506111145019531250000000_f,
+    0.03320312500000000000000000000000_f,
+    -0.00055882334709167480468750000000_f,
+    -0.03443861007690429687500000000000_f,
+    -0.06840083003044128417968750000000_f,
+    -0.10240936279296875000000000000000_f,
+    -0.13642737269401550292968750000000_f,
+    -0.17041730880737304687500000000000_f,
+    -0.20434090495109558105468750000000_f,
+    -0.23815917968750000000000000000000_f,
+    -0.27183243632316589355468750000000_f,
+    -0.30532026290893554687500000000000_f,
+    -0.33858153223991394042968750000000_f,
+    -0.37157440185546875000000000000000_f,
+    -0.40425631403923034667968750000000_f,
+    -0.43658399581909179687500000000000_f,
+    -0.46851345896720886230468750000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.53099820017814636230468750000000_f,
+    -0.56146192550659179687500000000000_f,
+    -0.59134432673454284667968750000000_f,
+    -0.62059783935546875000000000000000_f,
+    -0.64917418360710144042968750000000_f,
+    -0.67702436447143554687500000000000_f,
+    -0.70409867167472839355468750000000_f,
+    -0.73034667968750000000000000000000_f,
+    -0.75571724772453308105468750000000_f,
+    -0.78015851974487304687500000000000_f,
+    -0.80361792445182800292968750000000_f,
+    -0.82604217529296875000000000000000_f,
+    -0.84737727046012878417968750000000_f,
+    -0.86756849288940429687500000000000_f,
+    -0.88656041026115417480468750000000_f,
+    -0.90429687500000000000000000000000_f,
+    -0.92072102427482604980468750000000_f,
+    -0.93577527999877929687500000000000_f,
+    -0.94940134882926940917968750000000_f,
+    -0.96154022216796875000000000000000_f,
+    -0.97213217616081237792968750000000_f,
+    -0.98111677169799804687500000000000_f,
+    -0.98843285441398620605468750000000_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99781128764152526855468750000000_f,
+    -0.99974775314331054687500000000000_f,
+    -0.99976393580436706542968750000000_f,
+    -0.99779510498046875000000000000000_f,
+    -0.99377581477165222167968750000000_f,
+    -0.98763990402221679687500000000000_f,
+    -0.97932049632072448730468750000000_f,
+    -0.96875000000000000000000000000000_f,
+    -0.95586010813713073730468750000000_f,
+    -0.94058179855346679687500000000000_f,
+    -0.92284533381462097167968750000000_f,
+    -0.90258026123046875000000000000000_f,
+    -0.87971541285514831542968750000000_f,
+    -0.85417890548706054687500000000000_f,
+    -0.82589814066886901855468750000000_f,
+    -0.79479980468750000000000000000000_f,
+    -0.76080986857414245605468750000000_f,
+    -0.72385358810424804687500000000000_f,
+    -0.68385550379753112792968750000000_f,
+    -0.64073944091796875000000000000000_f,
+    -0.59442850947380065917968750000000_f,
+    -0.54484510421752929687500000000000_f,
+    -0.49191090464591979980468750000000_f,
+    -0.43554687500000000000000000000000_f,
+    -0.37567326426506042480468750000000_f,
+    -0.31220960617065429687500000000000_f,
+    -0.24507471919059753417968750000000_f,
+    -0.17418670654296875000000000000000_f,
+    -0.09946295619010925292968750000000_f,
+    -0.02082014083862304687500000000000_f,
+    0.06182578206062316894531250000000_f,
+    0.14855957031250000000000000000000_f,
+    0.23946669697761535644531250000000_f,
+    0.33463335037231445312500000000000_f,
+    0.43414643406867980957031250000000_f,
+    0.53809356689453125000000000000000_f,
+    0.64656308293342590332031250000000_f,
+    0.75964403152465820312500000000000_f,
+    0.87742617726325988769531250000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.81072455598041415214538574218750_f,
+    -0.63325975835323333740234375000000_f,
+    -0.46721572289243340492248535156250_f,
+    -0.31220960617065429687500000000000_f,
+    -0.16786554967984557151794433593750_f,
+    -0.03381462395191192626953125000000_f,
+    0.09030522732064127922058105468750_f,
+    0.20484924316406250000000000000000_f,
+    0.31016590120270848274230957031250_f,
+    0.40659697353839874267578125000000_f,
+    0.49447758262977004051208496093750_f,
+    0.57413625717163085937500000000000_f,
+    0.64589498797431588172912597656250_f,
+    0.71006928384304046630859375000000_f,
+    0.76696822745725512504577636718750_f,
+    0.81689453125000000000000000000000_f,
+    0.86014459328725934028625488281250_f,
+    0.89700855314731597900390625000000_f,
+    0.92777034780010581016540527343750_f,
+    0.95270776748657226562500000000000_f,
+    0.97209251159802079200744628906250_f,
+    0.98619024455547332763671875000000_f,
+    0.99526065168902277946472167968750_f,
+    0.99955749511718750000000000000000_f,
+    0.99932866962626576423645019531250_f,
+    0.99481625854969024658203125000000_f,
+    0.98625658964738249778747558593750_f,
+    0.97388029098510742187500000000000_f,
+    0.95791234681382775306701660156250_f,
+    0.93857215344905853271484375000000_f,
+    0.91607357515022158622741699218750_f,
+    0.89062500000000000000000000000000_f,
+    0.86242939578369259834289550781250_f,
+    0.83168436586856842041015625000000_f,
+    0.79858220508322119712829589843750_f,
+    0.76330995559692382812500000000000_f,
+    0.72604946279898285865783691406250_f,
+    0.68697743117809295654296875000000_f,
+    0.64626548020169138908386230468750_f,
+    0.60408020019531250000000000000000_f,
+    0.56058320822194218635559082031250_f,
+    0.51593120396137237548828125000000_f,
+    0.47027602558955550193786621093750_f,
+    0.42376470565795898437500000000000_f,
+    0.37653952697291970252990722656250_f,
+    0.32873807847499847412109375000000_f,
+    0.28049331111833453178405761718750_f,
+    0.23193359375000000000000000000000_f,
+    0.18318276898935437202453613281250_f,
+    0.13436020910739898681640625000000_f,
+    0.08558087190613150596618652343750_f,
+    0.03695535659790039062500000000000_f,
+    -0.01141004031524062156677246093750_f,
+    -0.05941326916217803955078125000000_f,
+    -0.10695647122338414192199707031250_f,
+    -0.15394592285156250000000000000000_f,
+    -0.20029197959229350090026855468750_f,
+    -0.24590902030467987060546875000000_f,
+    -0.29071539128199219703674316406250_f,
+    -0.33463335037231445312500000000000_f,
+    -0.37758901109918951988220214843750_f,
+    -0.41951228678226470947265625000000_f,
+    -0.46033683465793728828430175781250_f,
+    -0.50000000000000000000000000000000_f,
+    -0.53844276024028658866882324218750_f,
+    -0.57560966908931732177734375000000_f,
+    -0.61144880065694451332092285156250_f,
+    -0.64591169357299804687500000000000_f,
+    -0.67895329510793089866638183593750_f,
+    -0.71053190529346466064453125000000_f,
+    -0.74060912104323506355285644531250_f,
+    -0.76914978027343750000000000000000_f,
+    -0.79612190602347254753112792968750_f,
+    -0.82149665057659149169921875000000_f,
+    -0.84524823958054184913635253906250_f,
+    -0.86735391616821289062500000000000_f,
+    -0.88779388507828116416931152343750_f,
+    -0.90655125677585601806640625000000_f,
+    -0.92361199157312512397766113281250_f,
+    -0.93896484375000000000000000000000_f,
+    -0.95260130567476153373718261718750_f,
+    -0.96451555192470550537109375000000_f,
+    -0.97470438340678811073303222656250_f,
+    -0.98316717147827148437500000000000_f,
+    -0.98990580206736922264099121093750_f,
+    -0.99492461979389190673828125000000_f,
+    -0.99823037208989262580871582031250_f,
+    -0.99983215332031250000000000000000_f,
+    -0.99974134890362620353698730468750_f,
+    -0.99797157943248748779296875000000_f,
+    -0.99453864479437470436096191406250_f,
+    -0.98946046829223632812500000000000_f,
+    -0.98275704076513648033142089843750_f,
+    -0.97445036470890045166015625000000_f,
+    -0.96456439839676022529602050781250_f,
+    -0.95312500000000000000000000000000_f,
+    -0.94015987170860171318054199218750_f,
+    -0.92569850385189056396484375000000_f,
+    -0.90977211901918053627014160156250_f,
+    -0.89241361618041992187500000000000_f,
+    -0.87365751480683684349060058593750_f,
+    -0.85353989899158477783203125000000_f,
+    -0.83209836157038807868957519531250_f,
+    -0.80937194824218750000000000000000_f,
+    -0.78540110168978571891784667968750_f,
+    -0.76022760570049285888671875000000_f,
+    -0.73389452928677201271057128906250_f,
+    -0.70644617080688476562500000000000_f,
+    -0.67792800208553671836853027343750_f,
+    -0.64838661253452301025390625000000_f,
+    -0.61786965327337384223937988281250_f,
+    -0.58642578125000000000000000000000_f,
+    -0.55410460336133837699890136718750_f,
+    -0.52095662057399749755859375000000_f,
+    -0.48703317204490303993225097656250_f,
+    -0.45238637924194335937500000000000_f,
+    -0.41706909006461501121520996093750_f,
+    -0.38113482296466827392578125000000_f,
+    -0.34463771106675267219543457031250_f,
+    -0.30763244628906250000000000000000_f,
+    -0.27017422346398234367370605468750_f,
+    -0.23231868445873260498046875000000_f,
+    -0.19412186229601502418518066406250_f,
+    -0.15564012527465820312500000000000_f,
+    -0.11693012109026312828063964843750_f,
+    -0.07804872095584869384765625000000_f,
+    -0.03905296372249722480773925781250_f,
+    0.00000000000000000000000000000000_f,
+    0.03905296372249722480773925781250_f,
+    0.07804872095584869384765625000000_f,
+    0.11693012109026312828063964843750_f,
+    0.15564012527465820312500000000000_f,
+    0.19412186229601502418518066406250_f,
+    0.23231868445873260498046875000000_f,
+    0.27017422346398234367370605468750_f,
+    0.30763244628906250000000000000000_f,
+    0.34463771106675267219543457031250_f,
+    0.38113482296466827392578125000000_f,
+    0.41706909006461501121520996093750_f,
+    0.45238637924194335937500000000000_f,
+    0.48703317204490303993225097656250_f,
+    0.52095662057399749755859375000000_f,
+    0.55410460336133837699890136718750_f,
+    0.58642578125000000000000000000000_f,
+    0.61786965327337384223937988281250_f,
+    0.64838661253452301025390625000000_f,
+    0.67792800208553671836853027343750_f,
+    0.70644617080688476562500000000000_f,
+    0.73389452928677201271057128906250_f,
+    0.76022760570049285888671875000000_f,
+    0.78540110168978571891784667968750_f,
+    0.80937194824218750000000000000000_f,
+    0.83209836157038807868957519531250_f,
+    0.85353989899158477783203125000000_f,
+    0.87365751480683684349060058593750_f,
+    0.89241361618041992187500000000000_f,
+    0.90977211901918053627014160156250_f,
+    0.92569850385189056396484375000000_f,
+    0.94015987170860171318054199218750_f,
+    0.95312500000000000000000000000000_f,
+    0.96456439839676022529602050781250_f,
+    0.97445036470890045166015625000000_f,
+    0.98275704076513648033142089843750_f,
+    0.98946046829223632812500000000000_f,
+    0.99453864479437470436096191406250_f,
+    0.99797157943248748779296875000000_f,
+    0.99974134890362620353698730468750_f,
+    0.99983215332031250000000000000000_f,
+    0.99823037208989262580871582031250_f,
+    0.99492461979389190673828125000000_f,
+    0.98990580206736922264099121093750_f,
+    0.98316717147827148437500000000000_f,
+    0.97470438340678811073303222656250_f,
+    0.96451555192470550537109375000000_f,
+    0.95260130567476153373718261718750_f,
+    0.93896484375000000000000000000000_f,
+    0.92361199157312512397766113281250_f,
+    0.90655125677585601806640625000000_f,
+    0.88779388507828116416931152343750_f,
+    0.86735391616821289062500000000000_f,
+    0.84524823958054184913635253906250_f,
+    0.82149665057659149169921875000000_f,
+    0.79612190602347254753112792968750_f,
+    0.76914978027343750000000000000000_f,
+    0.74060912104323506355285644531250_f,
+    0.71053190529346466064453125000000_f,
+    0.67895329510793089866638183593750_f,
+    0.64591169357299804687500000000000_f,
+    0.61144880065694451332092285156250_f,
+    0.57560966908931732177734375000000_f,
+    0.53844276024028658866882324218750_f,
+    0.50000000000000000000000000000000_f,
+    0.46033683465793728828430175781250_f,
+    0.41951228678226470947265625000000_f,
+    0.37758901109918951988220214843750_f,
+    0.33463335037231445312500000000000_f,
+    0.29071539128199219703674316406250_f,
+    0.24590902030467987060546875000000_f,
+    0.20029197959229350090026855468750_f,
+    0.15394592285156250000000000000000_f,
+    0.10695647122338414192199707031250_f,
+    0.05941326916217803955078125000000_f,
+    0.01141004031524062156677246093750_f,
+    -0.03695535659790039062500000000000_f,
+    -0.08558087190613150596618652343750_f,
+    -0.13436020910739898681640625000000_f,
+    -0.18318276898935437202453613281250_f,
+    -0.23193359375000000000000000000000_f,
+    -0.28049331111833453178405761718750_f,
+    -0.32873807847499847412109375000000_f,
+    -0.37653952697291970252990722656250_f,
+    -0.42376470565795898437500000000000_f,
+    -0.47027602558955550193786621093750_f,
+    -0.51593120396137237548828125000000_f,
+    -0.56058320822194218635559082031250_f,
+    -0.60408020019531250000000000000000_f,
+    -0.64626548020169138908386230468750_f,
+    -0.68697743117809295654296875000000_f,
+    -0.72604946279898285865783691406250_f,
+    -0.76330995559692382812500000000000_f,
+    -0.79858220508322119712829589843750_f,
+    -0.83168436586856842041015625000000_f,
+    -0.86242939578369259834289550781250_f,
+    -0.89062500000000000000000000000000_f,
+    -0.91607357515022158622741699218750_f,
+    -0.93857215344905853271484375000000_f,
+    -0.95791234681382775306701660156250_f,
+    -0.97388029098510742187500000000000_f,
+    -0.98625658964738249778747558593750_f,
+    -0.99481625854969024658203125000000_f,
+    -0.99932866962626576423645019531250_f,
+    -0.99955749511718750000000000000000_f,
+    -0.99526065168902277946472167968750_f,
+    -0.98619024455547332763671875000000_f,
+    -0.97209251159802079200744628906250_f,
+    -0.95270776748657226562500000000000_f,
+    -0.92777034780010581016540527343750_f,
+    -0.89700855314731597900390625000000_f,
+    -0.86014459328725934028625488281250_f,
+    -0.81689453125000000000000000000000_f,
+    -0.76696822745725512504577636718750_f,
+    -0.71006928384304046630859375000000_f,
+    -0.64589498797431588172912597656250_f,
+    -0.57413625717163085937500000000000_f,
+    -0.49447758262977004051208496093750_f,
+    -0.40659697353839874267578125000000_f,
+    -0.31016590120270848274230957031250_f,
+    -0.20484924316406250000000000000000_f,
+    -0.09030522732064127922058105468750_f,
+    0.03381462395191192626953125000000_f,
+    0.16786554967984557151794433593750_f,
+    0.31220960617065429687500000000000_f,
+    0.46721572289243340492248535156250_f,
+    0.63325975835323333740234375000000_f,
+    0.81072455598041415214538574218750_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.73135536351037444546818733215332_f,
+    0.48708611773326992988586425781250_f,
+    0.26596762584085809066891670227051_f,
+    0.06681254506111145019531250000000_f,
+    -0.11152983077772660180926322937012_f,
+    -0.27017422346398234367370605468750_f,
+    -0.41020001738070277497172355651855_f,
+    -0.53265190124511718750000000000000_f,
+    -0.63854050460940925404429435729980_f,
+    -0.72884302912279963493347167968750_f,
+    -0.80450387455493910238146781921387_f,
+    -0.86643525958061218261718750000000_f,
+    -0.91551783732575131580233573913574_f,
+    -0.95260130567476153373718261718750_f,
+    -0.97850501233915565535426139831543_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99990237433667061850428581237793_f,
+    -0.99688834650442004203796386718750_f,
+    -0.98568036412325454875826835632324_f,
+    -0.96695491671562194824218750000000_f,
+    -0.94136166403040988370776176452637_f,
+    -0.90952400444075465202331542968750_f,
+    -0.87203963810316054150462150573730_f,
+    -0.82948112487792968750000000000000_f,
+    -0.78239643701090244576334953308105_f,
+    -0.73130950657650828361511230468750_f,
+    -0.67672076768212718889117240905762_f,
+    -0.61910769343376159667968750000000_f,
+    -0.55892532766301883384585380554199_f,
+    -0.49660681141540408134460449218750_f,
+    -0.43256390419992385432124137878418_f,
+    -0.36718750000000000000000000000000_f,
+    -0.30084813804569421336054801940918_f,
+    -0.23389650834724307060241699218750_f,
+    -0.16666395198990358039736747741699_f,
+    -0.09946295619010925292968750000000_f,
+    -0.03258764411293668672442436218262_f,
+    0.03368574054911732673645019531250_f,
+    0.09909835423604818060994148254395_f,
+    0.16340827941894531250000000000000_f,
+    0.22639005573728354647755622863770_f,
+    0.28783421637490391731262207031250_f,
+    0.34754682967468397691845893859863_f,
+    0.40534904599189758300781250000000_f,
+    0.46107664978626416996121406555176_f,
+    0.51457961695268750190734863281250_f,
+    0.56572167739068390801548957824707_f,
+    0.61437988281250000000000000000000_f,
+    0.66044417978991987183690071105957_f,
+    0.70381698803976178169250488281250_f,
+    0.74441278394806431606411933898926_f,
+    0.78215768933296203613281250000000_f,
+    0.81698906544625060632824897766113_f,
+    0.84885511221364140510559082031250_f,
+    0.87771447271370561793446540832520_f,
+    0.90353584289550781250000000000000_f,
+    0.92629758653492899611592292785645_f,
+    0.94598735542967915534973144531250_f,
+    0.96260171483299927785992622375488_f,
+    0.97614577412605285644531250000000_f,
+    0.98663282272900687530636787414551_f,
+    0.99408397125080227851867675781250_f,
+    0.99852779787761392071843147277832_f,
+    1.00000000000000000000000000000000_f,
+    0.99854305107874097302556037902832_f,
+    0.99420586274936795234680175781250_f,
+    0.98704345216538058593869209289551_f,
+    0.97711661458015441894531250000000_f,
+    0.96449160116753773763775825500488_f,
+    0.94923980208113789558410644531250_f,
+    0.93143743475229712203145027160645_f,
+    0.91116523742675781250000000000000_f,
+    0.88850816794001730158925056457520_f,
+    0.86355510773137211799621582031250_f,
+    0.83639857109665172174572944641113_f,
+    0.80713441967964172363281250000000_f,
+    0.77586158220219658687710762023926_f,
+    0.74268177943304181098937988281250_f,
+    0.70769925439526559785008430480957_f,
+    0.67102050781250000000000000000000_f,
+    0.63275403879379155114293098449707_f,
+    0.59301009075716137886047363281250_f,
+    0.55190040259185479953885078430176_f,
+    0.50953796505928039550781250000000_f,
+    0.46603678243263857439160346984863_f,
+    0.42151163937523961067199707031250_f,
+    0.37607787305751116946339607238770_f,
+    0.32985115051269531250000000000000_f,
+    0.28294725123123498633503913879395_f,
+    0.23548185499384999275207519531250_f,
+    0.18757033494330244138836860656738_f,
+    0.13932755589485168457031250000000_f,
+    0.09086767788539873436093330383301_f,
+    0.04230396496132016181945800781250_f,
+    -0.00625140079500852152705192565918_f,
+    -0.05468750000000000000000000000000_f,
+    -0.10289485146495280787348747253418_f,
+    -0.15076558245345950126647949218750_f,
+    -0.19819359370012534782290458679199_f,
+    -0.24507471919059753417968750000000_f,
+    -0.29130688070290489122271537780762_f,
+    -0.33679023711010813713073730468750_f,
+    -0.38142732844426063820719718933105_f,
+    -0.42512321472167968750000000000000_f,
+    -0.46778560952952830120921134948730_f,
+    -0.50932500837370753288269042968750_f,
+    -0.54965481178805930539965629577637_f,
+    -0.58869144320487976074218750000000_f,
+    -0.62635446158674312755465507507324_f,
+    -0.66256666881963610649108886718750_f,
+    -0.69725421186740277335047721862793_f,
+    -0.73034667968750000000000000000000_f,
+    -0.76177719490806339308619499206543_f,
+    -0.79148250026628375053405761718750_f,
+    -0.81940303980809403583407402038574_f,
+    -0.84548303484916687011718750000000_f,
+    -0.86967055469722254201769828796387_f,
+    -0.89191758213564753532409667968750_f,
+    -0.91218007366842357441782951354980_f,
+    -0.93041801452636718750000000000000_f,
+    -0.94659546843467978760600090026855_f,
+    -0.96068062214180827140808105468750_f,
+    -0.97264582470961613580584526062012_f,
+    -0.98246762156486511230468750000000_f,
+    -0.99012678331200731918215751647949_f,
+    -0.99560832930728793144226074218750_f,
+    -0.99890154599415836855769157409668_f,
+    -1.00000000000000000000000000000000_f,
+    -0.99890154599415836855769157409668_f,
+    -0.99560832930728793144226074218750_f,
+    -0.99012678331200731918215751647949_f,
+    -0.98246762156486511230468750000000_f,
+    -0.97264582470961613580584526062012_f,
+    -0.96068062214180827140808105468750_f,
+    -0.94659546843467978760600090026855_f,
+    -0.93041801452636718750000000000000_f,
+    -0.91218007366842357441782951354980_f,
+    -0.89191758213564753532409667968750_f,
+    -0.86967055469722254201769828796387_f,
+    -0.84548303484916687011718750000000_f,
+    -0.81940303980809403583407402038574_f,
+    -0.79148250026628375053405761718750_f,
+    -0.76177719490806339308619499206543_f,
+    -0.73034667968750000000000000000000_f,
+    -0.69725421186740277335047721862793_f,
+    -0.66256666881963610649108886718750_f,
+    -0.62635446158674312755465507507324_f,
+    -0.58869144320487976074218750000000_f,
+    -0.54965481178805930539965629577637_f,
+    -0.50932500837370753288269042968750_f,
+    -0.46778560952952830120921134948730_f,
+    -0.42512321472167968750000000000000_f,
+    -0.38142732844426063820719718933105_f,
+    -0.33679023711010813713073730468750_f,
+    -0.29130688070290489122271537780762_f,
+    -0.24507471919059753417968750000000_f,
+    -0.19819359370012534782290458679199_f,
+    -0.15076558245345950126647949218750_f,
+    -0.10289485146495280787348747253418_f,
+    -0.05468750000000000000000000000000_f,
+    -0.00625140079500852152705192565918_f,
+    0.04230396496132016181945800781250_f,
+    0.09086767788539873436093330383301_f,
+    0.13932755589485168457031250000000_f,
+    0.18757033494330244138836860656738_f,
+    0.23548185499384999275207519531250_f,
+    0.28294725123123498633503913879395_f,
+    0.32985115051269531250000000000000_f,
+    0.37607787305751116946339607238770_f,
+    0.42151163937523961067199707031250_f,
+    0.46603678243263857439160346984863_f,
+    0.50953796505928039550781250000000_f,
+    0.55190040259185479953885078430176_f,
+    0.59301009075716137886047363281250_f,
+    0.63275403879379155114293098449707_f,
+    0.67102050781250000000000000000000_f,
+    0.70769925439526559785008430480957_f,
+    0.74268177943304181098937988281250_f,
+    0.77586158220219658687710762023926_f,
+    0.80713441967964172363281250000000_f,
+    0.83639857109665172174572944641113_f,
+    0.86355510773137211799621582031250_f,
+    0.88850816794001730158925056457520_f,
+    0.91116523742675781250000000000000_f,
+    0.93143743475229712203145027160645_f,
+    0.94923980208113789558410644531250_f,
+    0.96449160116753773763775825500488_f,
+    0.97711661458015441894531250000000_f,
+    0.98704345216538058593869209289551_f,
+    0.99420586274936795234680175781250_f,
+    0.99854305107874097302556037902832_f,
+    1.00000000000000000000000000000000_f,
+    0.99852779787761392071843147277832_f,
+    0.99408397125080227851867675781250_f,
+    0.98663282272900687530636787414551_f,
+    0.97614577412605285644531250000000_f,
+    0.96260171483299927785992622375488_f,
+    0.94598735542967915534973144531250_f,
+    0.92629758653492899611592292785645_f,
+    0.90353584289550781250000000000000_f,
+    0.87771447271370561793446540832520_f,
+    0.84885511221364140510559082031250_f,
+    0.81698906544625060632824897766113_f,
+    0.78215768933296203613281250000000_f,
+    0.74441278394806431606411933898926_f,
+    0.70381698803976178169250488281250_f,
+    0.66044417978991987183690071105957_f,
+    0.61437988281250000000000000000000_f,
+    0.56572167739068390801548957824707_f,
+    0.51457961695268750190734863281250_f,
+    0.46107664978626416996121406555176_f,
+    0.40534904599189758300781250000000_f,
+    0.34754682967468397691845893859863_f,
+    0.28783421637490391731262207031250_f,
+    0.22639005573728354647755622863770_f,
+    0.16340827941894531250000000000000_f,
+    0.09909835423604818060994148254395_f,
+    0.03368574054911732673645019531250_f,
+    -0.03258764411293668672442436218262_f,
+    -0.09946295619010925292968750000000_f,
+    -0.16666395198990358039736747741699_f,
+    -0.23389650834724307060241699218750_f,
+    -0.30084813804569421336054801940918_f,
+    -0.36718750000000000000000000000000_f,
+    -0.43256390419992385432124137878418_f,
+    -0.49660681141540408134460449218750_f,
+    -0.55892532766301883384585380554199_f,
+    -0.61910769343376159667968750000000_f,
+    -0.67672076768212718889117240905762_f,
+    -0.73130950657650828361511230468750_f,
+    -0.78239643701090244576334953308105_f,
+    -0.82948112487792968750000000000000_f,
+    -0.87203963810316054150462150573730_f,
+    -0.90952400444075465202331542968750_f,
+    -0.94136166403040988370776176452637_f,
+    -0.96695491671562194824218750000000_f,
+    -0.98568036412325454875826835632324_f,
+    -0.99688834650442004203796386718750_f,
+    -0.99990237433667061850428581237793_f,
+    -0.99401855468750000000000000000000_f,
+    -0.97850501233915565535426139831543_f,
+    -0.95260130567476153373718261718750_f,
+    -0.91551783732575131580233573913574_f,
+    -0.86643525958061218261718750000000_f,
+    -0.80450387455493910238146781921387_f,
+    -0.72884302912279963493347167968750_f,
+    -0.63854050460940925404429435729980_f,
+    -0.53265190124511718750000000000000_f,
+    -0.41020001738070277497172355651855_f,
+    -0.27017422346398234367370605468750_f,
+    -0.11152983077772660180926322937012_f,
+    0.06681254506111145019531250000000_f,
+    0.26596762584085809066891670227051_f,
+    0.48708611773326992988586425781250_f,
+    0.73135536351037444546818733215332_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.64055874348548513808054849505424_f,
+    -0.32569103593414183706045150756836_f,
+    -0.05225229632799255341524258255959_f,
+    0.18276030011475086212158203125000_f,
+    0.38221194320578888437012210488319_f,
+    0.54883423743012826889753341674805_f,
+    0.68522918053974990471033379435539_f,
+    0.79387307167053222656250000000000_f,
+    0.87712034955541184899630025029182_f,
+    0.93720736140676308423280715942383_f,
+    0.97625606304097800602903589606285_f,
+    0.99627765081822872161865234375000_f,
+    0.99917612597039351385319605469704_f,
+    0.98675179189012851566076278686523_f,
+    0.96070468495406657893909141421318_f,
+    0.92263793945312500000000000000000_f,
+    0.87406108720290376368211582303047_f,
+    0.81639329240715596824884414672852_f,
+    0.75096652234731209318852052092552_f,
+    0.67902865447103977203369140625000_f,
+    0.60174652045282073231646791100502_f,
+    0.52020888779952656477689743041992_f,
+    0.43542937957397498394129797816277_f,
+    0.34834933280944824218750000000000_f,
+    0.25984059618815535941394045948982_f,
+    0.17070826755661983042955398559570_f,
+    0.08169337185097447218140587210655_f,
+    -0.00652451999485492706298828125000_f,
+    -0.09332473058509549446171149611473_f,
+    -0.17814297346922103315591812133789_f,
+    -0.26046890784721199452178552746773_f,
+    -0.33984375000000000000000000000000_f,
+    -0.41585794087211525038583204150200_f,
+    -0.48814886923355516046285629272461_f,
+    -0.55639864984789255686337128281593_f,
+    -0.62033195607364177703857421875000_f,
+    -0.67971390632590100722154602408409_f,
+    -0.73434800382528919726610183715820_f,
+    -0.78407412906119589024456217885017_f,
+    -0.82876658439636230468750000000000_f,
+    -0.86833219023981200734851881861687_f,
+    -0.90270843221514951437711715698242_f,
+    -0.93186165875124515878269448876381_f,
+    -0.95578532852232456207275390625000_f,
+    -0.97449830716448104794835671782494_f,
+    -0.98804321269562933593988418579102_f,
+    -0.99648480906591885286616161465645_f,
+    -0.99990844726562500000000000000000_f,
+    -0.99841855341753671382321044802666_f,
+    -0.99213716328085865825414657592773_f,
+    -0.98120250259364638623083010315895_f,
+    -0.96576761268079280853271484375000_f,
+    -0.94599902075458430772414430975914_f,
+    -0.92207545433484483510255813598633_f,
+    -0.89418659921568632853450253605843_f,
+    -0.86253190040588378906250000000000_f,
+    -0.82731940546989335416583344340324_f,
+    -0.78876464969653170555830001831055_f,
+    -0.74708958252233514940598979592323_f,
+    -0.70252153463661670684814453125000_f,
+    -0.65529222519523955270415171980858_f,
+    -0.60563680857012514024972915649414_f,
+    -0.55379296006151434994535520672798_f,
+    -0.50000000000000000000000000000000_f,
+    -0.44449805566534905665321275591850_f,
+    -0.38752726044913288205862045288086_f,
+    -0.32932698968818385765189304947853_f,
+    -0.27013513259589672088623046875000_f,
+    -0.21018739971839295321842655539513_f,
+    -0.14971666534256655722856521606445_f,
+    -0.08895234428302956075640395283699_f,
+    -0.02811980247497558593750000000000_f,
+    0.03256019920002017897786572575569_f,
+    0.09287202842824626713991165161133_f,
+    0.15260567289112714206567034125328_f,
+    0.21155720017850399017333984375000_f,
+    0.26952918676090575900161638855934_f,
+    0.32633111659379210323095321655273_f,
+    0.38177974992674990062369033694267_f,
+    0.43569946289062500000000000000000_f,
+    0.48792255843557086336659267544746_f,
+    0.53828954919299576431512832641602_f,
+    0.58664941283439020480727776885033_f,
+    0.63285982050001621246337890625000_f,
+    0.67678733887044018047163262963295_f,
+    0.71830760645389091223478317260742_f,
+    0.75730548466242453287122771143913_f,
+    0.79367518424987792968750000000000_f,
+    0.82732036768459238373907282948494_f,
+    0.85815422802988905459642410278320_f,
+    0.88609954490527798043331131339073_f,
+    0.91108871810138225555419921875000_f,
+    0.93306377942155904747778549790382_f,
+    0.95197638332319911569356918334961_f,
+    0.96778777693168649420840665698051_f,
+    0.98046875000000000000000000000000_f,
+    0.98999956538693822949426248669624_f,
+    0.99636987062694970518350601196289_f,
+    0.99957859116454983450239524245262_f,
+    0.99963380582630634307861328125000_f,
+    0.99655260510337484447518363595009_f,
+    0.99036093281756620854139328002930_f,
+    0.98109341174392739048926159739494_f,
+    0.96879315376281738281250000000000_f,
+    0.95351155511445995216490700840950_f,
+    0.93530807732895482331514358520508_f,
+    0.91425001440472897229483351111412_f,
+    0.89041224680840969085693359375000_f,
+    0.86387698286910108436131849884987_f,
+    0.83473348814004566520452499389648_f,
+    0.80307780330065270391060039401054_f,
+    0.76901245117187500000000000000000_f,
+    0.73264613341791573475347831845284_f,
+    0.69409341750724706798791885375977_f,
+    0.65347441450592214096104726195335_f,
+    0.61091444827616214752197265625000_f,
+    0.56654371665320013562450185418129_f,
+    0.52049694517336320132017135620117_f,
+    0.47291303392637473734794184565544_f,
+    0.42393469810485839843750000000000_f,
+    0.37370810282402544544311240315437_f,
+    0.32238249278452713042497634887695_f,
+    0.27010981735145378479501232504845_f,
+    0.21704435162246227264404296875000_f,
+    0.16334231405801347136730328202248_f,
+    0.10916148124670144170522689819336_f,
+    0.05466080037865594931645318865776_f,
+    -0.00000000000000000000000000000000_f,
+    -0.05466080037865594931645318865776_f,
+    -0.10916148124670144170522689819336_f,
+    -0.16334231405801347136730328202248_f,
+    -0.21704435162246227264404296875000_f,
+    -0.27010981735145378479501232504845_f,
+    -0.32238249278452713042497634887695_f,
+    -0.37370810282402544544311240315437_f,
+    -0.42393469810485839843750000000000_f,
+    -0.47291303392637473734794184565544_f,
+    -0.52049694517336320132017135620117_f,
+    -0.56654371665320013562450185418129_f,
+    -0.61091444827616214752197265625000_f,
+    -0.65347441450592214096104726195335_f,
+    -0.69409341750724706798791885375977_f,
+    -0.73264613341791573475347831845284_f,
+    -0.76901245117187500000000000000000_f,
+    -0.80307780330065270391060039401054_f,
+    -0.83473348814004566520452499389648_f,
+    -0.86387698286910108436131849884987_f,
+    -0.89041224680840969085693359375000_f,
+    -0.91425001440472897229483351111412_f,
+    -0.93530807732895482331514358520508_f,
+    -0.95351155511445995216490700840950_f,
+    -0.96879315376281738281250000000000_f,
+    -0.98109341174392739048926159739494_f,
+    -0.99036093281756620854139328002930_f,
+    -0.99655260510337484447518363595009_f,
+    -0.99963380582630634307861328125000_f,
+    -0.99957859116454983450239524245262_f,
+    -0.99636987062694970518350601196289_f,
+    -0.98999956538693822949426248669624_f,
+    -0.98046875000000000000000000000000_f,
+    -0.96778777693168649420840665698051_f,
+    -0.95197638332319911569356918334961_f,
+    -0.93306377942155904747778549790382_f,
+    -0.91108871810138225555419921875000_f,
+    -0.88609954490527798043331131339073_f,
+    -0.85815422802988905459642410278320_f,
+    -0.82732036768459238373907282948494_f,
+    -0.79367518424987792968750000000000_f,
+    -0.75730548466242453287122771143913_f,
+    -0.71830760645389091223478317260742_f,
+    -0.67678733887044018047163262963295_f,
+    -0.63285982050001621246337890625000_f,
+    -0.58664941283439020480727776885033_f,
+    -0.53828954919299576431512832641602_f,
+    -0.48792255843557086336659267544746_f,
+    -0.43569946289062500000000000000000_f,
+    -0.38177974992674990062369033694267_f,
+    -0.32633111659379210323095321655273_f,
+    -0.26952918676090575900161638855934_f,
+    -0.21155720017850399017333984375000_f,
+    -0.15260567289112714206567034125328_f,
+    -0.09287202842824626713991165161133_f,
+    -0.03256019920002017897786572575569_f,
+    0.02811980247497558593750000000000_f,
+    0.08895234428302956075640395283699_f,
+    0.14971666534256655722856521606445_f,
+    0.21018739971839295321842655539513_f,
+    0.27013513259589672088623046875000_f,
+    0.32932698968818385765189304947853_f,
+    0.38752726044913288205862045288086_f,
+    0.44449805566534905665321275591850_f,
+    0.50000000000000000000000000000000_f,
+    0.55379296006151434994535520672798_f,
+    0.60563680857012514024972915649414_f,
+    0.65529222519523955270415171980858_f,
+    0.70252153463661670684814453125000_f,
+    0.74708958252233514940598979592323_f,
+    0.78876464969653170555830001831055_f,
+    0.82731940546989335416583344340324_f,
+    0.86253190040588378906250000000000_f,
+    0.89418659921568632853450253605843_f,
+    0.92207545433484483510255813598633_f,
+    0.94599902075458430772414430975914_f,
+    0.96576761268079280853271484375000_f,
+    0.98120250259364638623083010315895_f,
+    0.99213716328085865825414657592773_f,
+    0.99841855341753671382321044802666_f,
+    0.99990844726562500000000000000000_f,
+    0.99648480906591885286616161465645_f,
+    0.98804321269562933593988418579102_f,
+    0.97449830716448104794835671782494_f,
+    0.95578532852232456207275390625000_f,
+    0.93186165875124515878269448876381_f,
+    0.90270843221514951437711715698242_f,
+    0.86833219023981200734851881861687_f,
+    0.82876658439636230468750000000000_f,
+    0.78407412906119589024456217885017_f,
+    0.73434800382528919726610183715820_f,
+    0.67971390632590100722154602408409_f,
+    0.62033195607364177703857421875000_f,
+    0.55639864984789255686337128281593_f,
+    0.48814886923355516046285629272461_f,
+    0.41585794087211525038583204150200_f,
+    0.33984375000000000000000000000000_f,
+    0.26046890784721199452178552746773_f,
+    0.17814297346922103315591812133789_f,
+    0.09332473058509549446171149611473_f,
+    0.00652451999485492706298828125000_f,
+    -0.08169337185097447218140587210655_f,
+    -0.17070826755661983042955398559570_f,
+    -0.25984059618815535941394045948982_f,
+    -0.34834933280944824218750000000000_f,
+    -0.43542937957397498394129797816277_f,
+    -0.52020888779952656477689743041992_f,
+    -0.60174652045282073231646791100502_f,
+    -0.67902865447103977203369140625000_f,
+    -0.75096652234731209318852052092552_f,
+    -0.81639329240715596824884414672852_f,
+    -0.87406108720290376368211582303047_f,
+    -0.92263793945312500000000000000000_f,
+    -0.96070468495406657893909141421318_f,
+    -0.98675179189012851566076278686523_f,
+    -0.99917612597039351385319605469704_f,
+    -0.99627765081822872161865234375000_f,
+    -0.97625606304097800602903589606285_f,
+    -0.93720736140676308423280715942383_f,
+    -0.87712034955541184899630025029182_f,
+    -0.79387307167053222656250000000000_f,
+    -0.68522918053974990471033379435539_f,
+    -0.54883423743012826889753341674805_f,
+    -0.38221194320578888437012210488319_f,
+    -0.18276030011475086212158203125000_f,
+    0.05225229632799255341524258255959_f,
+    0.32569103593414183706045150756836_f,
+    0.64055874348548513808054849505424_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.53975339309363512541040108771995_f,
+    0.15411810926207181182689964771271_f,
+    -0.16391235957524763477977103320882_f,
+    -0.42091062653344124555587768554688_f,
+    -0.62303374757089891033956519095227_f,
+    -0.77604104163719966891221702098846_f,
+    -0.88531140207726188862125127343461_f,
+    -0.95586010813713073730468750000000_f,
+    -0.99235514534518465268320142058656_f,
+    -0.99913304347091980162076652050018_f,
+    -0.98021424069184881489036342827603_f,
+    -0.93931798252742737531661987304688_f,
+    -0.87987676402729952940262592164800_f,
+    -0.80505032362952988478355109691620_f,
+    -0.71773919703286814808507187990472_f,
+    -0.62059783935546875000000000000000_f,
+    -0.51604732378086559663188381819054_f,
+    -0.40628762482037927838973701000214_f,
+    -0.29330949424951135995343065587804_f,
+    -0.17890593770425766706466674804688_f,
+    -0.06468329985164977813383302418515_f,
+    0.04792803402278877911157906055450_f,
+    0.15766331223960783347592951031402_f,
+    0.26341345906257629394531250000000_f,
+    0.36421547752058991420653910608962_f,
+    0.45924320515814542886801064014435_f,
+    0.54779841522980809997989126713946_f,
+    0.62930225592572242021560668945312_f,
+    0.70328702028683842684131377609447_f,
+    0.76938823954014878836460411548615_f,
+    0.82733709265585453351832256885245_f,
+    0.87695312500000000000000000000000_f,
+    0.91813726902774028815201745601371_f,
+    0.95086516003402721253223717212677_f,
+    0.97518074005012245208945387275890_f,
+    0.99119014304596930742263793945312_f,
+    0.99905585467007718136756011517718_f,
+    0.99899113983019560691900551319122_f,
+    0.99125473148967735426140279741958_f,
+    0.97614577412605285644531250000000_f,
+    0.95399901536996090101183654041961_f,
+    0.92518023941420324263162910938263_f,
+    0.89008193585431349958980717929080_f,
+    0.84911919769365340471267700195312_f,
+    0.80272584231767218909681105287746_f,
+    0.75135074931358758476562798023224_f,
+    0.69545440908336964014324621530250_f,
+    0.63550567626953125000000000000000_f,
+    0.57197872208485200928862468572333_f,
+    0.50535017970878470805473625659943_f,
+    0.43609647698491649236984812887385_f,
+    0.36469135072547942399978637695312_f,
+    0.29160353700052787928598263533786_f,
+    0.21729463186102293548174202442169_f,
+    0.14221711701668660055020154686645_f,
+    0.06681254506111145019531250000000_f,
+    -0.00849012109176605633820145158097_f,
+    -0.08327601982409760239534080028534_f,
+    -0.15714575867610669490659347502515_f,
+    -0.22971664357464760541915893554688_f,
+    -0.30062377447774046856920904247090_f,
+    -0.36952101241286072763614356517792_f,
+    -0.43608182281513840905518009094521_f,
+    -0.50000000000000000000000000000000_f,
+    -0.56099027753316299538255407242104_f,
+    -0.61878882918927047285251319408417_f,
+    -0.67315366511883034661423153011128_f,
+    -0.72386492777150124311447143554688_f,
+    -0.77072509205214423388952127425000_f,
+    -0.81355907411443695309571921825409_f,
+    -0.85221425312522391948277800111100_f,
+    -0.88656041026115417480468750000000_f,
+    -0.91648958912753464289835392264649_f,
+    -0.94191588171770490589551627635956_f,
+    -0.96277514395961638626886269776151_f,
+    -0.97902464482467621564865112304688_f,
+    -0.99064265290229336358152067987248_f,
+    -0.99762796427194189163856208324432_f,
+    -0.99999937543293349051509721903130_f,
+    -0.99779510498046875000000000000000_f,
+    -0.99107216764491390392777248052880_f,
+    -0.97990570423962708446197211742401_f,
+    -0.96438827099103541229396796552464_f,
+    -0.94462909165304154157638549804688_f,
+    -0.92075327573621557064598164288327_f,
+    -0.89290100611060552182607352733612_f,
+    -0.86122669916937688583402632502839_f,
+    -0.82589814066886901855468750000000_f,
+    -0.78709560028903347017603664426133_f,
+    -0.74501092788659661891870200634003_f,
+    -0.69984663434166627382637670962140_f,
+    -0.65181495982687920331954956054688_f,
+    -0.60113693225656383845034724799916_f,
+    -0.54804141860176969203166663646698_f,
+    -0.49276417168539232704915775684640_f,
+    -0.43554687500000000000000000000000_f,
+    -0.37663618801934539703779591945931_f,
+    -0.31628279440292317303828895092010_f,
+    -0.25474045542131129593599325744435_f,
+    -0.19226507085841149091720581054688_f,
+    -0.12911374957508137129025271860883_f,
+    -0.06554389184702813508920371532440_f,
+    -0.00181228551821099870267062215135_f,
+    0.06182578206062316894531250000000_f,
+    0.12511739441026925589994789334014_f,
+    0.18781285679187931236810982227325_f,
+    0.24966652581150761136541404994205_f,
+    0.31043761607725173234939575195312_f,
+    0.36989098229747874313488864572719_f,
+    0.42779787528024826315231621265411_f,
+    0.48393667036566689887422398896888_f,
+    0.53809356689453125000000000000000_f,
+    0.59006325738823939275334851117805_f,
+    0.63964956518657345441170036792755_f,
+    0.68666604936157860095136129530147_f,
+    0.73093657579738646745681762695312_f,
+    0.77229585339745376870723703177646_f,
+    0.81058993445230953511781990528107_f,
+    0.84567667827252712697827519150451_f,
+    0.87742617726325988769531250000000_f,
+    0.90572114468830200451066048117355_f,
+    0.93045726344325885293073952198029_f,
+    0.95154349522903380886873492272571_f,
+    0.96890234958846122026443481445312_f,
+    0.98247011234053793771181517513469_f,
+    0.99219703301832851138897240161896_f,
+    0.99804747098824186934962199302390_f,
+    1.00000000000000000000000000000000_f,
+    0.99804747098824186934962199302390_f,
+    0.99219703301832851138897240161896_f,
+    0.98247011234053793771181517513469_f,
+    0.96890234958846122026443481445312_f,
+    0.95154349522903380886873492272571_f,
+    0.93045726344325885293073952198029_f,
+    0.90572114468830200451066048117355_f,
+    0.87742617726325988769531250000000_f,
+    0.84567667827252712697827519150451_f,
+    0.81058993445230953511781990528107_f,
+    0.77229585339745376870723703177646_f,
+    0.73093657579738646745681762695312_f,
+    0.68666604936157860095136129530147_f,
+    0.63964956518657345441170036792755_f,
+    0.59006325738823939275334851117805_f,
+    0.53809356689453125000000000000000_f,
+    0.48393667036566689887422398896888_f,
+    0.42779787528024826315231621265411_f,
+    0.36989098229747874313488864572719_f,
+    0.31043761607725173234939575195312_f,
+    0.24966652581150761136541404994205_f,
+    0.18781285679187931236810982227325_f,
+    0.12511739441026925589994789334014_f,
+    0.06182578206062316894531250000000_f,
+    -0.00181228551821099870267062215135_f,
+    -0.06554389184702813508920371532440_f,
+    -0.12911374957508137129025271860883_f,
+    -0.19226507085841149091720581054688_f,
+    -0.25474045542131129593599325744435_f,
+    -0.31628279440292317303828895092010_f,
+    -0.37663618801934539703779591945931_f,
+    -0.43554687500000000000000000000000_f,
+    -0.49276417168539232704915775684640_f,
+    -0.54804141860176969203166663646698_f,
+    -0.60113693225656383845034724799916_f,
+    -0.65181495982687920331954956054688_f,
+    -0.69984663434166627382637670962140_f,
+    -0.74501092788659661891870200634003_f,
+    -0.78709560028903347017603664426133_f,
+    -0.82589814066886901855468750000000_f,
+    -0.86122669916937688583402632502839_f,
+    -0.89290100611060552182607352733612_f,
+    -0.92075327573621557064598164288327_f,
+    -0.94462909165304154157638549804688_f,
+    -0.96438827099103541229396796552464_f,
+    -0.97990570423962708446197211742401_f,
+    -0.99107216764491390392777248052880_f,
+    -0.99779510498046875000000000000000_f,
+    -0.99999937543293349051509721903130_f,
+    -0.99762796427194189163856208324432_f,
+    -0.99064265290229336358152067987248_f,
+    -0.97902464482467621564865112304688_f,
+    -0.96277514395961638626886269776151_f,
+    -0.94191588171770490589551627635956_f,
+    -0.91648958912753464289835392264649_f,
+    -0.88656041026115417480468750000000_f,
+    -0.85221425312522391948277800111100_f,
+    -0.81355907411443695309571921825409_f,
+    -0.77072509205214423388952127425000_f,
+    -0.72386492777150124311447143554688_f,
+    -0.67315366511883034661423153011128_f,
+    -0.61878882918927047285251319408417_f,
+    -0.56099027753316299538255407242104_f,
+    -0.50000000000000000000000000000000_f,
+    -0.43608182281513840905518009094521_f,
+    -0.36952101241286072763614356517792_f,
+    -0.30062377447774046856920904247090_f,
+    -0.22971664357464760541915893554688_f,
+    -0.15714575867610669490659347502515_f,
+    -0.08327601982409760239534080028534_f,
+    -0.00849012109176605633820145158097_f,
+    0.06681254506111145019531250000000_f,
+    0.14221711701668660055020154686645_f,
+    0.21729463186102293548174202442169_f,
+    0.29160353700052787928598263533786_f,
+    0.36469135072547942399978637695312_f,
+    0.43609647698491649236984812887385_f,
+    0.50535017970878470805473625659943_f,
+    0.57197872208485200928862468572333_f,
+    0.63550567626953125000000000000000_f,
+    0.69545440908336964014324621530250_f,
+    0.75135074931358758476562798023224_f,
+    0.80272584231767218909681105287746_f,
+    0.84911919769365340471267700195312_f,
+    0.89008193585431349958980717929080_f,
+    0.92518023941420324263162910938263_f,
+    0.95399901536996090101183654041961_f,
+    0.97614577412605285644531250000000_f,
+    0.99125473148967735426140279741958_f,
+    0.99899113983019560691900551319122_f,
+    0.99905585467007718136756011517718_f,
+    0.99119014304596930742263793945312_f,
+    0.97518074005012245208945387275890_f,
+    0.95086516003402721253223717212677_f,
+    0.91813726902774028815201745601371_f,
+    0.87695312500000000000000000000000_f,
+    0.82733709265585453351832256885245_f,
+    0.76938823954014878836460411548615_f,
+    0.70328702028683842684131377609447_f,
+    0.62930225592572242021560668945312_f,
+    0.54779841522980809997989126713946_f,
+    0.45924320515814542886801064014435_f,
+    0.36421547752058991420653910608962_f,
+    0.26341345906257629394531250000000_f,
+    0.15766331223960783347592951031402_f,
+    0.04792803402278877911157906055450_f,
+    -0.06468329985164977813383302418515_f,
+    -0.17890593770425766706466674804688_f,
+    -0.29330949424951135995343065587804_f,
+    -0.40628762482037927838973701000214_f,
+    -0.51604732378086559663188381819054_f,
+    -0.62059783935546875000000000000000_f,
+    -0.71773919703286814808507187990472_f,
+    -0.80505032362952988478355109691620_f,
+    -0.87987676402729952940262592164800_f,
+    -0.93931798252742737531661987304688_f,
+    -0.98021424069184881489036342827603_f,
+    -0.99913304347091980162076652050018_f,
+    -0.99235514534518465268320142058656_f,
+    -0.95586010813713073730468750000000_f,
+    -0.88531140207726188862125127343461_f,
+    -0.77604104163719966891221702098846_f,
+    -0.62303374757089891033956519095227_f,
+    -0.42091062653344124555587768554688_f,
+    -0.16391235957524763477977103320882_f,
+    0.15411810926207181182689964771271_f,
+    0.53975339309363512541040108771995_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.43051439593469709166129177901894_f,
+    0.02227100832443795752624282613397_f,
+    0.37239362362339811785005849742447_f,
+    0.63275403879379155114293098449707_f,
+    0.81518104040703254220545659336494_f,
+    0.93049399819078359996638027951121_f,
+    0.98856268901257338121979501011083_f,
+    0.99836463108658790588378906250000_f,
+    0.96803999882079083683095177548239_f,
+    0.90494418749274530000548111274838_f,
+    0.81569809572380802542568289936753_f,
+    0.70623619251273339614272117614746_f,
+    0.58185243439116041130887424515095_f,
+    0.44724409707497159160993760451674_f,
+    0.30655358480709127277918923937250_f,
+    0.16340827941894531250000000000000_f,
+    0.02095848997953497772073205851484_f,
+    -0.11808643724712908351648366078734_f,
+    -0.25142378995361303051225831950433_f,
+    -0.37712488459510495886206626892090_f,
+    -0.49360412851334378725454143932438_f,
+    -0.59958969414977048018045024946332_f,
+    -0.69409575121708155798216921539279_f,
+    -0.77639620378613471984863281250000_f,
+    -0.84599988032285478034566494898172_f,
+    -0.90262712577741410768794594332576_f,
+    -0.94618774588551535220659616243211_f,
+    -0.97676025488908635452389717102051_f,
+    -0.99457237892110761379171890439466_f,
+    -0.99998276832663179902738193050027_f,
+    -0.99346387320931750508634650032036_f,
+    -0.97558593750000000000000000000000_f,
+    -0.94700206784093676759539448539726_f,
+    -0.90843433456642230794386705383658_f,
+    -0.86066086303744171459584322292358_f,
+    -0.80450387455493910238146781921387_f,
+    -0.74081863703311490176872666779673_f,
+    -0.67048328656092337496374966576695_f,
+    -0.59438948191663665276962547068251_f,
+    -0.51343385502696037292480468750000_f,
+    -0.42851022127872862022002209414495_f,
+    -0.34050251449768609290913445875049_f,
+    -0.25027841230526504112674501811853_f,
+    -0.15868361845059553161263465881348_f,
+    -0.06653676959124998901984326948877_f,
+    0.02537506513759524295892333611846_f,
+    0.11630032256977917981544123904314_f,
+    0.20552635192871093750000000000000_f,
+    0.29238231834404748710198873595800_f,
+    0.37624163176077729531243676319718_f,
+    0.45652392872116875910393218873651_f,
+    0.53269663369428599253296852111816_f,
+    0.60427612583209067143030779334367_f,
+    0.67082853624553706595179392024875_f,
+    0.73197020011852820253750451229280_f,
+    0.78736778721213340759277343750000_f,
+    0.83673813355607129516045006312197_f,
+    0.87984779637913845817820401862264_f,
+    0.91651235359501270760773650181363_f,
+    0.94659546843467978760600090026855_f,
+    0.97000773910162407798196682051639_f,
+    0.98670535262088776562450220808387_f,
+    0.99668856135813932439759810222313_f,
+    1.00000000000000000000000000000000_f,
+    0.99672286011205635247733880532905_f,
+    0.98697893872623865263449260964990_f,
+    0.97092657675456905952415809224476_f,
+    0.94875850238167913630604743957520_f,
+    0.92069959395396339107975336446543_f,
+    0.88700457625877504597156075760722_f,
+    0.84795566347268214180132872570539_f,
+    0.80386016145348548889160156250000_f,
+    0.75504804145645487700733156088972_f,
+    0.70186949677106724720943020656705_f,
+    0.64469249320043020556880719595938_f,
+    0.58390032374154543504118919372559_f,
+    0.51988917727060923734683228758513_f,
+    0.45306573049366249961167341098189_f,
+    0.38384477188908983080750658700708_f,
+    0.31264686584472656250000000000000_f,
+    0.23989606467866275707478962431196_f,
+    0.16601767572923620264191413298249_f,
+    0.09143609020618159721749407253810_f,
+    0.01657268001144984737038612365723_f,
+    -0.05815623173517037169943932894967_f,
+    -0.13234132119380603853642242029309_f,
+    -0.20558213050704243762822898133891_f,
+    -0.27748884633183479309082031250000_f,
+    -0.34768398625846264060612611501710_f,
+    -0.41580398959722231211344478651881_f,
+    -0.48150070942650213812186166251195_f,
+    -0.54444280319876270368695259094238_f,
+    -0.60431701959375072608082746228320_f,
+    -0.66082937969100896680174628272653_f,
+    -0.71370625090640604781810907297768_f,
+    -0.76269531250000000000000000000000_f,
+    -0.80756641181506783055965570383705_f,
+    -0.84811231075057946782180806621909_f,
+    -0.88414932230176812577582268204424_f,
+    -0.91551783732575131580233573913574_f,
+    -0.94208274200138741871768388591590_f,
+    -0.96373372675471102866140427067876_f,
+    -0.98038548771337619136545526998816_f,
+    -0.99197782203555107116699218750000_f,
+    -0.99847561873065049375952639820753_f,
+    -0.99986874685116333694168133661151_f,
+    -0.99617184318662987951853438062244_f,
+    -0.98742400183255085721611976623535_f,
+    -0.97368836823866511398506418117904_f,
+    -0.95505164056261548921611392870545_f,
+    -0.93162348136653294616849052545149_f,
+    -0.90353584289550781250000000000000_f,
+    -0.87094220936828437018561999138910_f,
+    -0.83401675989181001114047830924392_f,
+    -0.79295345578249276652371690943255_f,
+    -0.74796505623817211017012596130371_f,
+    -0.69928206645588752987663383464678_f,
+    -0.64715162243153656618233071640134_f,
+    -0.59183631680844883682368617883185_f,
+    -0.53361297026276588439941406250000_f,
+    -0.47277135302430850494204150891164_f,
+    -0.40961286123233264788723317906260_f,
+    -0.34444915291622202335730662525748_f,
+    -0.27760074847174109891057014465332_f,
+    -0.20939560057397618719754461835691_f,
+    -0.14016763852852420768613228574395_f,
+    -0.07025529211284722852504103229876_f,
+    0.00000000000000000000000000000000_f,
+    0.07025529211284722852504103229876_f,
+    0.14016763852852420768613228574395_f,
+    0.20939560057397618719754461835691_f,
+    0.27760074847174109891057014465332_f,
+    0.34444915291622202335730662525748_f,
+    0.40961286123233264788723317906260_f,
+    0.47277135302430850494204150891164_f,
+    0.53361297026276588439941406250000_f,
+    0.59183631680844883682368617883185_f,
+    0.64715162243153656618233071640134_f,
+    0.69928206645588752987663383464678_f,
+    0.74796505623817211017012596130371_f,
+    0.79295345578249276652371690943255_f,
+    0.83401675989181001114047830924392_f,
+    0.87094220936828437018561999138910_f,
+    0.90353584289550781250000000000000_f,
+    0.93162348136653294616849052545149_f,
+    0.95505164056261548921611392870545_f,
+    0.97368836823866511398506418117904_f,
+    0.98742400183255085721611976623535_f,
+    0.99617184318662987951853438062244_f,
+    0.99986874685116333694168133661151_f,
+    0.99847561873065049375952639820753_f,
+    0.99197782203555107116699218750000_f,
+    0.98038548771337619136545526998816_f,
+    0.96373372675471102866140427067876_f,
+    0.94208274200138741871768388591590_f,
+    0.91551783732575131580233573913574_f,
+    0.88414932230176812577582268204424_f,
+    0.84811231075057946782180806621909_f,
+    0.80756641181506783055965570383705_f,
+    0.76269531250000000000000000000000_f,
+    0.71370625090640604781810907297768_f,
+    0.66082937969100896680174628272653_f,
+    0.60431701959375072608082746228320_f,
+    0.54444280319876270368695259094238_f,
+    0.48150070942650213812186166251195_f,
+    0.41580398959722231211344478651881_f,
+    0.34768398625846264060612611501710_f,
+    0.27748884633183479309082031250000_f,
+    0.20558213050704243762822898133891_f,
+    0.13234132119380603853642242029309_f,
+    0.05815623173517037169943932894967_f,
+    -0.01657268001144984737038612365723_f,
+    -0.09143609020618159721749407253810_f,
+    -0.16601767572923620264191413298249_f,
+    -0.23989606467866275707478962431196_f,
+    -0.31264686584472656250000000000000_f,
+    -0.38384477188908983080750658700708_f,
+    -0.45306573049366249961167341098189_f,
+    -0.51988917727060923734683228758513_f,
+    -0.58390032374154543504118919372559_f,
+    -0.64469249320043020556880719595938_f,
+    -0.70186949677106724720943020656705_f,
+    -0.75504804145645487700733156088972_f,
+    -0.80386016145348548889160156250000_f,
+    -0.84795566347268214180132872570539_f,
+    -0.88700457625877504597156075760722_f,
+    -0.92069959395396339107975336446543_f,
+    -0.94875850238167913630604743957520_f,
+    -0.97092657675456905952415809224476_f,
+    -0.98697893872623865263449260964990_f,
+    -0.99672286011205635247733880532905_f,
+    -1.00000000000000000000000000000000_f,
+    -0.99668856135813932439759810222313_f,
+    -0.98670535262088776562450220808387_f,
+    -0.97000773910162407798196682051639_f,
+    -0.94659546843467978760600090026855_f,
+    -0.91651235359501270760773650181363_f,
+    -0.87984779637913845817820401862264_f,
+    -0.83673813355607129516045006312197_f,
+    -0.78736778721213340759277343750000_f,
+    -0.73197020011852820253750451229280_f,
+    -0.67082853624553706595179392024875_f,
+    -0.60427612583209067143030779334367_f,
+    -0.53269663369428599253296852111816_f,
+    -0.45652392872116875910393218873651_f,
+    -0.37624163176077729531243676319718_f,
+    -0.29238231834404748710198873595800_f,
+    -0.20552635192871093750000000000000_f,
+    -0.11630032256977917981544123904314_f,
+    -0.02537506513759524295892333611846_f,
+    0.06653676959124998901984326948877_f,
+    0.15868361845059553161263465881348_f,
+    0.25027841230526504112674501811853_f,
+    0.34050251449768609290913445875049_f,
+    0.42851022127872862022002209414495_f,
+    0.51343385502696037292480468750000_f,
+    0.59438948191663665276962547068251_f,
+    0.67048328656092337496374966576695_f,
+    0.74081863703311490176872666779673_f,
+    0.80450387455493910238146781921387_f,
+    0.86066086303744171459584322292358_f,
+    0.90843433456642230794386705383658_f,
+    0.94700206784093676759539448539726_f,
+    0.97558593750000000000000000000000_f,
+    0.99346387320931750508634650032036_f,
+    0.99998276832663179902738193050027_f,
+    0.99457237892110761379171890439466_f,
+    0.97676025488908635452389717102051_f,
+    0.94618774588551535220659616243211_f,
+    0.90262712577741410768794594332576_f,
+    0.84599988032285478034566494898172_f,
+    0.77639620378613471984863281250000_f,
+    0.69409575121708155798216921539279_f,
+    0.59958969414977048018045024946332_f,
+    0.49360412851334378725454143932438_f,
+    0.37712488459510495886206626892090_f,
+    0.25142378995361303051225831950433_f,
+    0.11808643724712908351648366078734_f,
+    -0.02095848997953497772073205851484_f,
+    -0.16340827941894531250000000000000_f,
+    -0.30655358480709127277918923937250_f,
+    -0.44724409707497159160993760451674_f,
+    -0.58185243439116041130887424515095_f,
+    -0.70623619251273339614272117614746_f,
+    -0.81569809572380802542568289936753_f,
+    -0.90494418749274530000548111274838_f,
+    -0.96803999882079083683095177548239_f,
+    -0.99836463108658790588378906250000_f,
+    -0.98856268901257338121979501011083_f,
+    -0.93049399819078359996638027951121_f,
+    -0.81518104040703254220545659336494_f,
+    -0.63275403879379155114293098449707_f,
+    -0.37239362362339811785005849742447_f,
+    -0.02227100832443795752624282613397_f,
+    0.43051439593469709166129177901894_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.31454861133927947136612601752859_f,
+    -0.19796415690080904070669021166395_f,
+    -0.56341893656420183322808270531823_f,
+    -0.80505032362952988478355109691620_f,
+    -0.94364231446136681569214488263242_f,
+    -0.99771314241398156852369538682979_f,
+    -0.98368993183713460126682548434474_f,
+    -0.91607357515022158622741699218750_f,
+    -0.80759422746222320199649402638897_f,
+    -0.66935780221882934526433928112965_f,
+    -0.51098384055323764485478932328988_f,
+    -0.34073511640190190519206225872040_f,
+    -0.16563932901931677221796235244256_f,
+    0.00839677571473673722834973887075_f,
+    0.17648052385784762652320978304488_f,
+    0.33463335037231445312500000000000_f,
+    0.47969744272260961270859525029664_f,
+    0.60924868883888239068369330198038_f,
+    0.72151563651425854040155627444619_f,
+    0.81530418045849728514440357685089_f,
+    0.88992770220989647622644724833663_f,
+    0.94514239691276857868729166511912_f,
+    0.98108752960091649697460525203496_f,
+    0.99823037208989262580871582031250_f,
+    0.99731557987400454301507579657482_f,
+    0.97931877654960830525965320703108_f,
+    0.94540412124577088981425276870141_f,
+    0.89688564233847500872798264026642_f,
+    0.83519212835674982997602455725428_f,
+    0.76183537446000615389607446559239_f,
+    0.67838159017701737951711038476788_f,
+    0.58642578125000000000000000000000_f,
+    0.48756892542365015685845719417557_f,
+    0.38339776886040555226031756319571_f,
+    0.27546707655115998392147957929410_f,
+    0.16528417662675565225072205066681_f,
+    0.05429564486138316325991581834387_f,
+    -0.05612401810389711087623254570644_f,
+    -0.16468185819935454716755884874146_f,
+    -0.27017422346398234367370605468750_f,
+    -0.37149293331918920024747876595939_f,
+    -0.46762998555793755528497968043666_f,
+    -0.55768091951138343276284103922080_f,
+    -0.64084694847724676947109401226044_f,
+    -0.71643596925401986652559571666643_f,
+    -0.78386255152113148980674850463402_f,
+    -0.84264700483574639378048232174478_f,
+    -0.89241361618041992187500000000000_f,
+    -0.93288814629078564699682374339318_f,
+    -0.96389466841723203671676856174599_f,
+    -0.98535182872757265393204306747066_f,
+    -0.99726860323744404013268649578094_f,
+    -0.99973962196000909496973463319591_f,
+    -0.99294012689492516798850374470931_f,
+    -0.97712062652688280728341396752512_f,
+    -0.95260130567476153373718261718750_f,
+    -0.91976624582200050550540026961244_f,
+    -0.87905750746558508623706984508317_f,
+    -0.83096912254351640303440262869117_f,
+    -0.77604104163719966891221702098846_f,
+    -0.71485307739427228490569632413099_f,
+    -0.64801888247742978066412433690857_f,
+    -0.57617999731422187004170609725406_f,
+    -0.50000000000000000000000000000000_f,
+    -0.42015878788964244883175069844583_f,
+    -0.33734701770177322188715152151417_f,
+    -0.25226072835036827957111427167547_f,
+    -0.16559616821132294717244803905487_f,
+    -0.07804484612416573430238031505723_f,
+    0.00971117687992206768399228167254_f,
+    0.09700374034486636265484094110434_f,
+    0.18318276898935437202453613281250_f,
+    0.26762017850089370174515579492436_f,
+    0.34971349381711691606255953956861_f,
+    0.42888917302801010666968295481638_f,
+    0.50460563178467054967768490314484_f,
+    0.57635596476477668481663840793772_f,
+    0.64367036232376806381694223091472_f,
+    0.70611822195534901247526704537449_f,
+    0.76330995559692382812500000000000_f,
+    0.81489849514652090700650433063856_f,
+    0.86058049980923856381309633434284_f,
+    0.90009727006481399236292872956255_f,
+    0.93323537414516977150924503803253_f,
+    0.95982699393328319015239458167343_f,
+    0.97974999814404073461560074065346_f,
+    0.99292775152545098560352698768838_f,
+    0.99932866962626576423645019531250_f,
+    0.99896552941528415914262950536795_f,
+    0.99189454670994736673605984833557_f,
+    0.97821423197886281375446060337708_f,
+    0.95806403662618322414346039295197_f,
+    0.93162280234689620606047810724704_f,
+    0.89910702656261820564509434916545_f,
+    0.86076895730900793157758243978606_f,
+    0.81689453125000000000000000000000_f,
+    0.76780116874226889134291695881984_f,
+    0.71383544006725729857976148196030_f,
+    0.65537061708930000047956809794414_f,
+    0.59280412468842769158072769641876_f,
+    0.52655490635691670764373384372448_f,
+    0.45706071834112949048289920028765_f,
+    0.38477536665624856304646073112963_f,
+    0.31016590120270848274230957031250_f,
+    0.23370978107105827570322276187653_f,
+    0.15589202493820808470559313718695_f,
+    0.07720236023410531611688156772288_f,
+    -0.00186761550457958946935832500458_f,
+    -0.08082724797662504956363704877731_f,
+    -0.15918960137201265681028417020570_f,
+    -0.23647418312768159198711259705306_f,
+    -0.31220960617065429687500000000000_f,
+    -0.38593617706754773655219992178900_f,
+    -0.45720839896024001447472073778044_f,
+    -0.52559737865575972826093220646726_f,
+    -0.59069312775272919679991900920868_f,
+    -0.65210674822534808736662625960889_f,
+    -0.70947249344738194665183073084336_f,
+    -0.76244969622133895725824004330207_f,
+    -0.81072455598041415214538574218750_f,
+    -0.85401177795126825831317773918272_f,
+    -0.89205605770272766719131141144317_f,
+    -0.92463340515745395808977491469705_f,
+    -0.95155230280897740158252418041229_f,
+    -0.97265469356363276620669466865365_f,
+    -0.98781679431431212989878076768946_f,
+    -0.99694973204897863183759909588844_f,
+    -1.00000000000000000000000000000000_f,
+    -0.99694973204897863183759909588844_f,
+    -0.98781679431431212989878076768946_f,
+    -0.97265469356363276620669466865365_f,
+    -0.95155230280897740158252418041229_f,
+    -0.92463340515745395808977491469705_f,
+    -0.89205605770272766719131141144317_f,
+    -0.85401177795126825831317773918272_f,
+    -0.81072455598041415214538574218750_f,
+    -0.76244969622133895725824004330207_f,
+    -0.70947249344738194665183073084336_f,
+    -0.65210674822534808736662625960889_f,
+    -0.59069312775272919679991900920868_f,
+    -0.52559737865575972826093220646726_f,
+    -0.45720839896024001447472073778044_f,
+    -0.38593617706754773655219992178900_f,
+    -0.31220960617065429687500000000000_f,
+    -0.23647418312768159198711259705306_f,
+    -0.15918960137201265681028417020570_f,
+    -0.08082724797662504956363704877731_f,
+    -0.00186761550457958946935832500458_f,
+    0.07720236023410531611688156772288_f,
+    0.15589202493820808470559313718695_f,
+    0.23370978107105827570322276187653_f,
+    0.31016590120270848274230957031250_f,
+    0.38477536665624856304646073112963_f,
+    0.45706071834112949048289920028765_f,
+    0.52655490635691670764373384372448_f,
+    0.59280412468842769158072769641876_f,
+    0.65537061708930000047956809794414_f,
+    0.71383544006725729857976148196030_f,
+    0.76780116874226889134291695881984_f,
+    0.81689453125000000000000000000000_f,
+    0.86076895730900793157758243978606_f,
+    0.89910702656261820564509434916545_f,
+    0.93162280234689620606047810724704_f,
+    0.95806403662618322414346039295197_f,
+    0.97821423197886281375446060337708_f,
+    0.99189454670994736673605984833557_f,
+    0.99896552941528415914262950536795_f,
+    0.99932866962626576423645019531250_f,
+    0.99292775152545098560352698768838_f,
+    0.97974999814404073461560074065346_f,
+    0.95982699393328319015239458167343_f,
+    0.93323537414516977150924503803253_f,
+    0.90009727006481399236292872956255_f,
+    0.86058049980923856381309633434284_f,
+    0.81489849514652090700650433063856_f,
+    0.76330995559692382812500000000000_f,
+    0.70611822195534901247526704537449_f,
+    0.64367036232376806381694223091472_f,
+    0.57635596476477668481663840793772_f,
+    0.50460563178467054967768490314484_f,
+    0.42888917302801010666968295481638_f,
+    0.34971349381711691606255953956861_f,
+    0.26762017850089370174515579492436_f,
+    0.18318276898935437202453613281250_f,
+    0.09700374034486636265484094110434_f,
+    0.00971117687992206768399228167254_f,
+    -0.07804484612416573430238031505723_f,
+    -0.16559616821132294717244803905487_f,
+    -0.25226072835036827957111427167547_f,
+    -0.33734701770177322188715152151417_f,
+    -0.42015878788964244883175069844583_f,
+    -0.50000000000000000000000000000000_f,
+    -0.57617999731422187004170609725406_f,
+    -0.64801888247742978066412433690857_f,
+    -0.71485307739427228490569632413099_f,
+    -0.77604104163719966891221702098846_f,
+    -0.83096912254351640303440262869117_f,
+    -0.87905750746558508623706984508317_f,
+    -0.91976624582200050550540026961244_f,
+    -0.95260130567476153373718261718750_f,
+    -0.97712062652688280728341396752512_f,
+    -0.99294012689492516798850374470931_f,
+    -0.99973962196000909496973463319591_f,
+    -0.99726860323744404013268649578094_f,
+    -0.98535182872757265393204306747066_f,
+    -0.96389466841723203671676856174599_f,
+    -0.93288814629078564699682374339318_f,
+    -0.89241361618041992187500000000000_f,
+    -0.84264700483574639378048232174478_f,
+    -0.78386255152113148980674850463402_f,
+    -0.71643596925401986652559571666643_f,
+    -0.64084694847724676947109401226044_f,
+    -0.55768091951138343276284103922080_f,
+    -0.46762998555793755528497968043666_f,
+    -0.37149293331918920024747876595939_f,
+    -0.27017422346398234367370605468750_f,
+    -0.16468185819935454716755884874146_f,
+    -0.05612401810389711087623254570644_f,
+    0.05429564486138316325991581834387_f,
+    0.16528417662675565225072205066681_f,
+    0.27546707655115998392147957929410_f,
+    0.38339776886040555226031756319571_f,
+    0.48756892542365015685845719417557_f,
+    0.58642578125000000000000000000000_f,
+    0.67838159017701737951711038476788_f,
+    0.76183537446000615389607446559239_f,
+    0.83519212835674982997602455725428_f,
+    0.89688564233847500872798264026642_f,
+    0.94540412124577088981425276870141_f,
+    0.97931877654960830525965320703108_f,
+    0.99731557987400454301507579657482_f,
+    0.99823037208989262580871582031250_f,
+    0.98108752960091649697460525203496_f,
+    0.94514239691276857868729166511912_f,
+    0.88992770220989647622644724833663_f,
+    0.81530418045849728514440357685089_f,
+    0.72151563651425854040155627444619_f,
+    0.60924868883888239068369330198038_f,
+    0.47969744272260961270859525029664_f,
+    0.33463335037231445312500000000000_f,
+    0.17648052385784762652320978304488_f,
+    0.00839677571473673722834973887075_f,
+    -0.16563932901931677221796235244256_f,
+    -0.34073511640190190519206225872040_f,
+    -0.51098384055323764485478932328988_f,
+    -0.66935780221882934526433928112965_f,
+    -0.80759422746222320199649402638897_f,
+    -0.91607357515022158622741699218750_f,
+    -0.98368993183713460126682548434474_f,
+    -0.99771314241398156852369538682979_f,
+    -0.94364231446136681569214488263242_f,
+    -0.80505032362952988478355109691620_f,
+    -0.56341893656420183322808270531823_f,
+    -0.19796415690080904070669021166395_f,
+    0.31454861133927947136612601752859_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.19366800469168565790312186436495_f,
+    0.36747092557402982748726572026499_f,
+    0.72803398685355869002222561903181_f,
+    0.92703096323842260062519926577806_f,
+    0.99838153269840690384739900764544_f,
+    0.97139667953586883442085309070535_f,
+    0.87122608836700932144481157592963_f,
+    0.71927332232007756829261779785156_f,
+    0.53358051786678051264800615172135_f,
+    0.32918426034822134695900786027778_f,
+    0.11844423778757950938000931273564_f,
+    -0.08865379403428619298210833221674_f,
+    -0.28421926505957556541304143138404_f,
+    -0.46220085381684639092014776906581_f,
+    -0.61815200974360351438008365221322_f,
+    -0.74901664257049560546875000000000_f,
+    -0.85293374220156104037471322953934_f,
+    -0.92905974669469992832659954729024_f,
+    -0.97740752848473355651748306627269_f,
+    -0.99870091992860920981911476701498_f,
+    -0.99424374861882680587399363503209_f,
+    -0.96580240073700251990373999433359_f,
+    -0.91550097703442201435564129496925_f,
+    -0.84572815085994079709053039550781_f,
+    -0.75905488103687135392760865215678_f,
+    -0.65816217434852419820856539445231_f,
+    -0.54577813295546684368986234403565_f,
+    -0.42462356126478084661357570439577_f,
+    -0.29736544463073988353585264121648_f,
+    -0.16657764881525261024819428712362_f,
+    -0.03470822440272436359975927189225_f,
+    0.09594726562500000000000000000000_f,
+    0.22326694416520609376419770342181_f,
+    0.34531886155270163918373782507842_f,
+    0.46037276742403737683773101707629_f,
+    0.56690787065397785227105487138033_f,
+    0.66361701699583575120300338312518_f,
+    0.74940768701952864550008825972327_f,
+    0.82340019097511407686340589862084_f,
+    0.88492341228993609547615051269531_f,
+    0.93350842750950147053146110920352_f,
+    0.96888030759116472445668932778062_f,
+    0.99094838353132119745936279286980_f,
+    0.99979523832698191654344554990530_f,
+    0.99566466721755697566464959891164_f,
+    0.97894882899885438121145853074268_f,
+    0.95017479292546225266846704471391_f,
+    0.90999066829681396484375000000000_f,
+    0.85915148723364098692911738908151_f,
+    0.79850499537272434658063957613194_f,
+    0.72897749021669200342188332797377_f,
+    0.65155983265017880512459669262171_f,
+    0.56729374365229501275820211958489_f,
+    0.47725848547672011790155011112802_f,
+    0.38255801451369753074516211199807_f,
+    0.28430868167197331786155700683594_f,
+    0.18362754540271053471656159672420_f,
+    0.08162135241134527152695454788045_f,
+    -0.02062376835278412201546416326892_f,
+    -0.12205186169515513938677031546831_f,
+    -0.22164592370449531788523245268152_f,
+    -0.31843588006603829043683617783245_f,
+    -0.41150575158588276192261901087477_f,
+    -0.50000000000000000000000000000000_f,
+    -0.58312905328318964670586410647957_f,
+    -0.66017401532764585780910238099750_f,
+    -0.73049057004562434336492060538149_f,
+    -0.79351209468356387333187740296125_f,
+    -0.84875200143324813772949255508138_f,
+    -0.89580533030620446144354218631634_f,
+    -0.93434961971732877206164857852855_f,
+    -0.96414508431917056441307067871094_f,
+    -0.98503413235566039674040439422242_f,
+    -0.99694025717925960350385139463469_f,
+    -0.99986633961425108729770272475434_f,
+    -0.99389239956659025665430817753077_f,
+    -0.97917283669254073785737091384362_f,
+    -0.95593320105910628559087172106956_f,
+    -0.92446653557365388031996644713217_f,
+    -0.88512933254241943359375000000000_f,
+    -0.83833714705188899785071043879725_f,
+    -0.78455990996712643426036493110587_f,
+    -0.72431698322050397376159480700153_f,
+    -0.65817199973625406528299208730459_f,
+    -0.58672752981375431158284072807874_f,
+    -0.51061961508822073518842898920411_f,
+    -0.43051221031394959481986006721854_f,
+    -0.34709157218458130955696105957031_f,
+    -0.26106063322897610223805031637312_f,
+    -0.17313339751180889525272732498706_f,
+    -0.08402939343627791046742459002417_f,
+    0.00553178259653464010625611990690_f,
+    0.09483579956029186686095044933609_f,
+    0.18317877182961805893057771754684_f,
+    0.26987225729394881401645989171811_f,
+    0.35424804687500000000000000000000_f,
+    0.43566272070553135886683548960718_f,
+    0.51350194821905259523475706373574_f,
+    0.58718451143317906826268881559372_f,
+    0.65616603277456420073576737195253_f,
+    0.71994239088206324339580532978289_f,
+    0.77805280992862724254166550963419_f,
+    0.83008261011327910683377240275149_f,
+    0.87566560908453539013862609863281_f,
+    0.91448616615823896669468240361311_f,
+    0.94628086327865434945749711914686_f,
+    0.97083981873481406399406523632933_f,
+    0.98800763167773197892529424279928_f,
+    0.99768395748172566950273676411598_f,
+    0.99982371594849406282179415939027_f,
+    0.99443693625982332306989519565832_f,
+    0.98158824443817138671875000000000_f,
+    0.96139600086849086313378620616277_f,
+    0.93403109716436250042903566281893_f,
+    0.89971542332194398561284742754651_f,
+    0.85872001769180883457011077553034_f,
+    0.81136291380711922371915534313302_f,
+    0.75800669953268995371331584465224_f,
+    0.69905580533957456523808104975615_f,
+    0.63495353976031765341758728027344_f,
+    0.56617889123772846549087489620433_f,
+    0.49324311664196335280863081607095_f,
+    0.41668613769414808434277119886247_f,
+    0.33707276739730218650947790592909_f,
+    0.25498878933477148178710081083409_f,
+    0.17103691335084647562325699254870_f,
+    0.08583263167611251964750351817202_f,
+    -0.00000000000000000000000000000000_f,
+    -0.08583263167611251964750351817202_f,
+    -0.17103691335084647562325699254870_f,
+    -0.25498878933477148178710081083409_f,
+    -0.33707276739730218650947790592909_f,
+    -0.41668613769414808434277119886247_f,
+    -0.49324311664196335280863081607095_f,
+    -0.56617889123772846549087489620433_f,
+    -0.63495353976031765341758728027344_f,
+    -0.69905580533957456523808104975615_f,
+    -0.75800669953268995371331584465224_f,
+    -0.81136291380711922371915534313302_f,
+    -0.85872001769180883457011077553034_f,
+    -0.89971542332194398561284742754651_f,
+    -0.93403109716436250042903566281893_f,
+    -0.96139600086849086313378620616277_f,
+    -0.98158824443817138671875000000000_f,
+    -0.99443693625982332306989519565832_f,
+    -0.99982371594849406282179415939027_f,
+    -0.99768395748172566950273676411598_f,
+    -0.98800763167773197892529424279928_f,
+    -0.97083981873481406399406523632933_f,
+    -0.94628086327865434945749711914686_f,
+    -0.91448616615823896669468240361311_f,
+    -0.87566560908453539013862609863281_f,
+    -0.83008261011327910683377240275149_f,
+    -0.77805280992862724254166550963419_f,
+    -0.71994239088206324339580532978289_f,
+    -0.65616603277456420073576737195253_f,
+    -0.58718451143317906826268881559372_f,
+    -0.51350194821905259523475706373574_f,
+    -0.43566272070553135886683548960718_f,
+    -0.35424804687500000000000000000000_f,
+    -0.26987225729394881401645989171811_f,
+    -0.18317877182961805893057771754684_f,
+    -0.09483579956029186686095044933609_f,
+    -0.00553178259653464010625611990690_f,
+    0.08402939343627791046742459002417_f,
+    0.17313339751180889525272732498706_f,
+    0.26106063322897610223805031637312_f,
+    0.34709157218458130955696105957031_f,
+    0.43051221031394959481986006721854_f,
+    0.51061961508822073518842898920411_f,
+    0.58672752981375431158284072807874_f,
+    0.65817199973625406528299208730459_f,
+    0.72431698322050397376159480700153_f,
+    0.78455990996712643426036493110587_f,
+    0.83833714705188899785071043879725_f,
+    0.88512933254241943359375000000000_f,
+    0.92446653557365388031996644713217_f,
+    0.95593320105910628559087172106956_f,
+    0.97917283669254073785737091384362_f,
+    0.99389239956659025665430817753077_f,
+    0.99986633961425108729770272475434_f,
+    0.99694025717925960350385139463469_f,
+    0.98503413235566039674040439422242_f,
+    0.96414508431917056441307067871094_f,
+    0.93434961971732877206164857852855_f,
+    0.89580533030620446144354218631634_f,
+    0.84875200143324813772949255508138_f,
+    0.79351209468356387333187740296125_f,
+    0.73049057004562434336492060538149_f,
+    0.66017401532764585780910238099750_f,
+    0.58312905328318964670586410647957_f,
+    0.50000000000000000000000000000000_f,
+    0.41150575158588276192261901087477_f,
+    0.31843588006603829043683617783245_f,
+    0.22164592370449531788523245268152_f,
+    0.12205186169515513938677031546831_f,
+    0.02062376835278412201546416326892_f,
+    -0.08162135241134527152695454788045_f,
+    -0.18362754540271053471656159672420_f,
+    -0.28430868167197331786155700683594_f,
+    -0.38255801451369753074516211199807_f,
+    -0.47725848547672011790155011112802_f,
+    -0.56729374365229501275820211958489_f,
+    -0.65155983265017880512459669262171_f,
+    -0.72897749021669200342188332797377_f,
+    -0.79850499537272434658063957613194_f,
+    -0.85915148723364098692911738908151_f,
+    -0.90999066829681396484375000000000_f,
+    -0.95017479292546225266846704471391_f,
+    -0.97894882899885438121145853074268_f,
+    -0.99566466721755697566464959891164_f,
+    -0.99979523832698191654344554990530_f,
+    -0.99094838353132119745936279286980_f,
+    -0.96888030759116472445668932778062_f,
+    -0.93350842750950147053146110920352_f,
+    -0.88492341228993609547615051269531_f,
+    -0.82340019097511407686340589862084_f,
+    -0.74940768701952864550008825972327_f,
+    -0.66361701699583575120300338312518_f,
+    -0.56690787065397785227105487138033_f,
+    -0.46037276742403737683773101707629_f,
+    -0.34531886155270163918373782507842_f,
+    -0.22326694416520609376419770342181_f,
+    -0.09594726562500000000000000000000_f,
+    0.03470822440272436359975927189225_f,
+    0.16657764881525261024819428712362_f,
+    0.29736544463073988353585264121648_f,
+    0.42462356126478084661357570439577_f,
+    0.54577813295546684368986234403565_f,
+    0.65816217434852419820856539445231_f,
+    0.75905488103687135392760865215678_f,
+    0.84572815085994079709053039550781_f,
+    0.91550097703442201435564129496925_f,
+    0.96580240073700251990373999433359_f,
+    0.99424374861882680587399363503209_f,
+    0.99870091992860920981911476701498_f,
+    0.97740752848473355651748306627269_f,
+    0.92905974669469992832659954729024_f,
+    0.85293374220156104037471322953934_f,
+    0.74901664257049560546875000000000_f,
+    0.61815200974360351438008365221322_f,
+    0.46220085381684639092014776906581_f,
+    0.28421926505957556541304143138404_f,
+    0.08865379403428619298210833221674_f,
+    -0.11844423778757950938000931273564_f,
+    -0.32918426034822134695900786027778_f,
+    -0.53358051786678051264800615172135_f,
+    -0.71927332232007756829261779785156_f,
+    -0.87122608836700932144481157592963_f,
+    -0.97139667953586883442085309070535_f,
+    -0.99838153269840690384739900764544_f,
+    -0.92703096323842260062519926577806_f,
+    -0.72803398685355869002222561903181_f,
+    -0.36747092557402982748726572026499_f,
+    0.19366800469168565790312186436495_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    0.06976133547078428032151009574591_f,
+    -0.52549422782306220991443979073665_f,
+    -0.85852244400915489475067943203612_f,
+    -0.99107216764491390392777248052880_f,
+    -0.97512219369338404284519583598012_f,
+    -0.85401177795126836933548020169837_f,
+    -0.66347189148174234851751407404663_f,
+    -0.43256390419992385432124137878418_f,
+    -0.18453204794632183105562717173598_f,
+    0.06242432220179627844203196218587_f,
+    0.29445296834781886641252413028269_f,
+    0.50142011808904562997213361086324_f,
+    0.67634582092324158075768991693622_f,
+    0.81489849514652090700650433063856_f,
+    0.91494411834570221753182295287843_f,
+    0.97614577412605285644531250000000_f,
+    0.99960951640822270913844249662361_f,
+    0.98757275079263306949428624648135_f,
+    0.94313156043630330671589945268352_f,
+    0.87000362192103075642535259248689_f,
+    0.77232356501220456035383676862693_f,
+    0.65446782930789182408659598877421_f,
+    0.52090626084618207869425532408059_f,
+    0.37607787305751116946339607238770_f,
+    0.22428836929471018812876081938157_f,
+    0.06962718881835217032971740991343_f,
+    -0.08409800517542476150367747322889_f,
+    -0.23341132786225493589427060214803_f,
+    -0.37520495619357407957039640677976_f,
+    -0.50676334971165060139242086734157_f,
+    -0.62577693756663821389452095900197_f,
+    -0.73034667968750000000000000000000_f,
+    -0.81898079566887793667717687640106_f,
+    -0.89058484676593607787253858987242_f,
+    -0.94444625421421424249501797021367_f,
+    -0.98021424069184881489036342827603_f,
+    -0.99787609090233708730721673418884_f,
+    -0.99773054176731501563324400194688_f,
+    -0.98035903237541344168448631535284_f,
+    -0.94659546843467978760600090026855_f,
+    -0.89749508532653932135758623189759_f,
+    -0.83430292776769010565374173893360_f,
+    -0.75842240236615254822538645385066_f,
+    -0.67138430182691699599217827199027_f,
+    -0.57481664604374937965758363134228_f,
+    -0.47041563563365063060928150662221_f,
+    -0.35991796746054172118078895437066_f,
+    -0.24507471919059753417968750000000_f,
+    -0.12762697076324003297997933259467_f,
+    -0.00928329469327571210612859431421_f,
+    0.10830078581061508558036621252540_f,
+    0.22354130196535670904722792329267_f,
+    0.33494226611747590638401561591309_f,
+    0.44111000306246750390926081308862_f,
+    0.54076539122219657862444819329539_f,
+    0.63275403879379155114293098449707_f,
+    0.71605443764086851299310865215375_f,
+    0.78978415326567619203501635638531_f,
+    0.85320412279886181927679444925161_f,
+    0.90572114468830200451066048117355_f,
+    0.94688865377241582255152252400876_f,
+    0.97640588379553183706605068437057_f,
+    0.99411552626863408654855902568670_f,
+    1.00000000000000000000000000000000_f,
+    0.99417644971528229547175214975141_f,
+    0.97689059505043018827308287654887_f,
+    0.94850955292510397143246336781885_f,
+    0.90951375697716407842108310433105_f,
+    0.86048809744544141331346054357709_f,
+    0.80211240371007574978534648835193_f,
+    0.73515138971587956628894744426361_f,
+    0.66044417978991987183690071105957_f,
+    0.57889352899225199333699265480391_f,
+    0.49145484817788331888266384339659_f,
+    0.39912513946504157846817406607443_f,
+    0.30293194286318403385394049109891_f,
+    0.20392238947459173648013575075311_f,
+    0.10315245100365877384263058047509_f,
+    0.00167646934322973617526031375746_f,
+    -0.09946295619010925292968750000000_f,
+    -0.19924465278028991033210104433238_f,
+    -0.29667806452036649123016331941471_f,
+    -0.39081189123789716877155342444894_f,
+    -0.48074212432649510162718797801062_f,
+    -0.56561943483966703460907865519403_f,
+    -0.64465587574239591184266373602441_f,
+    -0.71713086679307702642205413212650_f,
+    -0.78239643701090244576334953308105_f,
+    -0.83988170604137679653433679050067_f,
+    -0.88909659193731083171030604717089_f,
+    -0.92963473889851466758216247399105_f,
+    -0.96117566433673395920322946039960_f,
+    -0.98348613023143083289312471606536_f,
+    -0.99642074909710276475749424207606_f,
+    -0.99992183997620032176456561501254_f,
+    -0.99401855468750000000000000000000_f,
+    -0.97882529908401061380374130749260_f,
+    -0.95453947829493823729052337512258_f,
+    -0.92143859883245926578609896751004_f,
+    -0.87987676402729952940262592164800_f,
+    -0.83028060251028712457355140941218_f,
+    -0.77314467237463424531540567841148_f,
+    -0.70902638623174829568540644686436_f,
+    -0.63854050460940925404429435729980_f,
+    -0.56235324703417544078831724618794_f,
+    -0.48117607169024551039271386798646_f,
+    -0.39575917575646618606910465132387_f,
+    -0.30688476939471165394479612587020_f,
+    -0.21536017690076225683526445209282_f,
+    -0.12201081873850128101111067735474_f,
+    -0.02767312806633398514222221820091_f,
+    0.06681254506111145019531250000000_f,
+    0.16060898936399520264828311155725_f,
+    0.25288909645553570015863442677073_f,
+    0.34284268329348988046945123642217_f,
+    0.42968312443551504031802323879674_f,
+    0.51265374741474944997321472328622_f,
+    0.59103394664539909975076170667307_f,
+    0.66414497359546131871610441521625_f,
+    0.73135536351037444546818733215332_f,
+    0.79208596172214174035985934096971_f,
+    0.84581451551754360806967270036694_f,
+    0.89207980065009861991853767904104_f,
+    0.93048525484664601492568181129172_f,
+    0.96070209406356532610971044050530_f,
+    0.98247189077209817753555398667231_f,
+    0.99560859717903937848859641235322_f,
+    1.00000000000000000000000000000000_f,
+    0.99560859717903937848859641235322_f,
+    0.98247189077209817753555398667231_f,
+    0.96070209406356532610971044050530_f,
+    0.93048525484664601492568181129172_f,
+    0.89207980065009861991853767904104_f,
+    0.84581451551754360806967270036694_f,
+    0.79208596172214174035985934096971_f,
+    0.73135536351037444546818733215332_f,
+    0.66414497359546131871610441521625_f,
+    0.59103394664539909975076170667307_f,
+    0.51265374741474944997321472328622_f,
+    0.42968312443551504031802323879674_f,
+    0.34284268329348988046945123642217_f,
+    0.25288909645553570015863442677073_f,
+    0.16060898936399520264828311155725_f,
+    0.06681254506111145019531250000000_f,
+    -0.02767312806633398514222221820091_f,
+    -0.12201081873850128101111067735474_f,
+    -0.21536017690076225683526445209282_f,
+    -0.30688476939471165394479612587020_f,
+    -0.39575917575646618606910465132387_f,
+    -0.48117607169024551039271386798646_f,
+    -0.56235324703417544078831724618794_f,
+    -0.63854050460940925404429435729980_f,
+    -0.70902638623174829568540644686436_f,
+    -0.77314467237463424531540567841148_f,
+    -0.83028060251028712457355140941218_f,
+    -0.87987676402729952940262592164800_f,
+    -0.92143859883245926578609896751004_f,
+    -0.95453947829493823729052337512258_f,
+    -0.97882529908401061380374130749260_f,
+    -0.99401855468750000000000000000000_f,
+    -0.99992183997620032176456561501254_f,
+    -0.99642074909710276475749424207606_f,
+    -0.98348613023143083289312471606536_f,
+    -0.96117566433673395920322946039960_f,
+    -0.92963473889851466758216247399105_f,
+    -0.88909659193731083171030604717089_f,
+    -0.83988170604137679653433679050067_f,
+    -0.78239643701090244576334953308105_f,
+    -0.71713086679307702642205413212650_f,
+    -0.64465587574239591184266373602441_f,
+    -0.56561943483966703460907865519403_f,
+    -0.48074212432649510162718797801062_f,
+    -0.39081189123789716877155342444894_f,
+    -0.29667806452036649123016331941471_f,
+    -0.19924465278028991033210104433238_f,
+    -0.09946295619010925292968750000000_f,
+    0.00167646934322973617526031375746_f,
+    0.10315245100365877384263058047509_f,
+    0.20392238947459173648013575075311_f,
+    0.30293194286318403385394049109891_f,
+    0.39912513946504157846817406607443_f,
+    0.49145484817788331888266384339659_f,
+    0.57889352899225199333699265480391_f,
+    0.66044417978991987183690071105957_f,
+    0.73515138971587956628894744426361_f,
+    0.80211240371007574978534648835193_f,
+    0.86048809744544141331346054357709_f,
+    0.90951375697716407842108310433105_f,
+    0.94850955292510397143246336781885_f,
+    0.97689059505043018827308287654887_f,
+    0.99417644971528229547175214975141_f,
+    1.00000000000000000000000000000000_f,
+    0.99411552626863408654855902568670_f,
+    0.97640588379553183706605068437057_f,
+    0.94688865377241582255152252400876_f,
+    0.90572114468830200451066048117355_f,
+    0.85320412279886181927679444925161_f,
+    0.78978415326567619203501635638531_f,
+    0.71605443764086851299310865215375_f,
+    0.63275403879379155114293098449707_f,
+    0.54076539122219657862444819329539_f,
+    0.44111000306246750390926081308862_f,
+    0.33494226611747590638401561591309_f,
+    0.22354130196535670904722792329267_f,
+    0.10830078581061508558036621252540_f,
+    -0.00928329469327571210612859431421_f,
+    -0.12762697076324003297997933259467_f,
+    -0.24507471919059753417968750000000_f,
+    -0.35991796746054172118078895437066_f,
+    -0.47041563563365063060928150662221_f,
+    -0.57481664604374937965758363134228_f,
+    -0.67138430182691699599217827199027_f,
+    -0.75842240236615254822538645385066_f,
+    -0.83430292776769010565374173893360_f,
+    -0.89749508532653932135758623189759_f,
+    -0.94659546843467978760600090026855_f,
+    -0.98035903237541344168448631535284_f,
+    -0.99773054176731501563324400194688_f,
+    -0.99787609090233708730721673418884_f,
+    -0.98021424069184881489036342827603_f,
+    -0.94444625421421424249501797021367_f,
+    -0.89058484676593607787253858987242_f,
+    -0.81898079566887793667717687640106_f,
+    -0.73034667968750000000000000000000_f,
+    -0.62577693756663821389452095900197_f,
+    -0.50676334971165060139242086734157_f,
+    -0.37520495619357407957039640677976_f,
+    -0.23341132786225493589427060214803_f,
+    -0.08409800517542476150367747322889_f,
+    0.06962718881835217032971740991343_f,
+    0.22428836929471018812876081938157_f,
+    0.37607787305751116946339607238770_f,
+    0.52090626084618207869425532408059_f,
+    0.65446782930789182408659598877421_f,
+    0.77232356501220456035383676862693_f,
+    0.87000362192103075642535259248689_f,
+    0.94313156043630330671589945268352_f,
+    0.98757275079263306949428624648135_f,
+    0.99960951640822270913844249662361_f,
+    0.97614577412605285644531250000000_f,
+    0.91494411834570221753182295287843_f,
+    0.81489849514652090700650433063856_f,
+    0.67634582092324158075768991693622_f,
+    0.50142011808904562997213361086324_f,
+    0.29445296834781886641252413028269_f,
+    0.06242432220179627844203196218587_f,
+    -0.18453204794632183105562717173598_f,
+    -0.43256390419992385432124137878418_f,
+    -0.66347189148174234851751407404663_f,
+    -0.85401177795126836933548020169837_f,
+    -0.97512219369338404284519583598012_f,
+    -0.99107216764491390392777248052880_f,
+    -0.85852244400915489475067943203612_f,
+    -0.52549422782306220991443979073665_f,
+    0.06976133547078428032151009574591_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+}}};
+
+/* fold */
+const Buffer<f, 1025> Data::fold = {{{
+  0.00000000000000000000000000000000_f,
+  0.09835209217670898285135194782924_f,
+  0.19371772923276570077533165203931_f,
+  0.28544645249563876943099671734672_f,
+  0.37296427042081009561869109347754_f,
+  0.45577289394920106335717946421937_f,
+  0.53344820535350356838222296573804_f,
+  0.60563807292800575510227645281702_f,
+  0.67205961732265928620932982084923_f,
+  0.73249602817632841755823847051943_f,
+  0.78679302218410362979028604968335_f,
+  0.83485502602424765949962193190004_f,
+  0.87664115982669144067074284976115_f,
+  0.91216108921477290216728306404548_f,
+  0.94147080649840553245866203724290_f,
+  0.96466839442172702678846007984248_f,
+  0.98188981903409233709112413635012_f,
+  0.99330479180598940658342144160997_f,
+  0.99911273508280229460609689340345_f,
+  0.99953887937879348779546262449003_f,
+  0.99483051587050985720139806289808_f,
+  0.98525342275378424705678526152042_f,
+  0.97108847987540569679509872003109_f,
+  0.95262848222758256255815467739012_f,
+  0.93017515948439766226840674789855_f,
+  0.90403640574508214999838173753233_f,
+  0.87452372100725406234289494022960_f,
+  0.84194986360079304699155500202323_f,
+  0.80662671084526127440739173835027_f,
+  0.76886332352585440297332297632238_f,
+  0.72896420838987008306020243253442_f,
+  0.68722777172312810023413476301357_f,
+  0.64394495614983715547907650034176_f,
+  0.59939805208716667728197080577957_f,
+  0.55385967475537878357272347784601_f,
+  0.50759189727517195489525647644768_f,
+  0.46084553015648305196449996401498_f,
+  0.41385953737934877416648760117823_f,
+  0.36686057927077536655602330029069_f,
+  0.32006267247660247221574536524713_f,
+  0.27366695749992075992196305378457_f,
+  0.22786156451495845343124813098257_f,
+  0.18282156845595620708877504512202_f,
+  0.13870902471391463595118409557472_f,
+  0.09567307714105276195137861350304_f,
+  0.05385013045499981859665084016342_f,
+  0.01336407954495493453916932224956_f,
+  -0.02567341139612691613969275294949_f,
+  -0.06316258656137871407842965254531_f,
+  -0.09901523926076824522191088817635_f,
+  -0.13315432148526937239374490218324_f,
+  -0.16551352767688998213202467013616_f,
+  -0.19603685766607306661946097392502_f,
+  -0.22467816333862605793214584082307_f,
+  -0.25140068320843639293471483142639_f,
+  -0.27617656870132806234963140923355_f,
+  -0.29898640560065581350812635719194_f,
+  -0.31981873376745201253967820775870_f,
+  -0.33866956792770874784537227242254_f,
+  -0.35554192201700079989379332801036_f,
+  -0.37044533928827810820294530458341_f,
+  -0.38339543012216326101082586319535_f,
+  -0.39441341923033179650559532092302_f,
+  -0.40352570371114832026293584021914_f,
+  -0.41076342320224568105402340734145_f,
+  -0.41616204317668192835810714313993_f,
+  -0.41976095224702375530156928107317_f,
+  -0.42160307417464926160732829885092_f,
+  -0.42173449512894728430367763394315_f,
+  -0.42020410660230472776888177577348_f,
+  -0.41706326426103818016954960512521_f,
+  -0.41236546289903497353179773199372_f,
+  -0.40616602755910496957980626575591_f,
+  -0.39852182079615988685716843065165_f,
+  -0.38949096597565519006778345101338_f,
+  -0.37913258642953001631425991035940_f,
+  -0.36750656022951339041426876974583_f,
+  -0.35467329028346156194473337563977_f,
+  -0.34069348941374172357043903502927_f,
+  -0.32562798003697068782713586188038_f,
+  -0.30953750803108726064039046832477_f,
+  -0.29248257034824731714905965418438_f,
+  -0.27452325590984105740943732598680_f,
+  -0.25571909930260172671978580183350_f,
+  -0.23612894678179408014528917192365_f,
+  -0.21581083407844714461276680594892_f,
+  -0.19482187550211602089511586655135_f,
+  -0.17321816382834831493653382494813_f,
+  -0.15105468046052272779178338169004_f,
+  -0.12838521535874611312344484304049_f,
+  -0.10526229623367472365558228375448_f,
+  -0.08173712651025442921248753691543_f,
+  -0.05785953157513463313010859678798_f,
+  -0.03367791283173456745592133643186_f,
+  -0.00923920909834407416694190828821_f,
+  0.01541113510291875626778690389074_f,
+  0.04022919480518243745548190304362_f,
+  0.06517258382888470313876183581669_f,
+  0.09020046839728246279577206223621_f,
+  0.11527357553099162879028938277770_f,
+  0.14035419660197909208498856514780_f,
+  0.16540618641208870709391476339079_f,
+  0.19039495814579379673325831845432_f,
+  0.21528747453143973200617722341121_f,
+  0.24005223552993254498844066802121_f,
+  0.26465926285465424250276100792689_f,
+  0.28908008161140319458581871003844_f,
+  0.31328769933244898782120912983373_f,
+  0.33725658266436725485348802067165_f,
+  0.36096263195520050803821732188226_f,
+  0.38438315397279937402075233876531_f,
+  0.40749683297281341642914753720106_f,
+  0.43028370032188628657721096715250_f,
+  0.45272510286906164633791149753961_f,
+  0.47480367024634656525350351330417_f,
+  0.49650328126771081649337702401681_f,
+  0.51780902958462105001302688833675_f,
+  0.53870718874542522502935071315733_f,
+  0.55918517679565071798464259700268_f,
+  0.57923152054637272456716345914174_f,
+  0.59883581962843535073659495537868_f,
+  0.61798871044131509222552267601714_f,
+  0.63668183009688061879671749920817_f,
+  0.65490778045017561392882043946884_f,
+  0.67266009230163958942938506879727_f,
+  0.68993318984788665204632707173005_f,
+  0.70672235545123707201042861925089_f,
+  0.72302369479164252386027555985493_f,
+  0.73883410245853298192741931416094_f,
+  0.75415122803422807162831986715901_f,
+  0.76897344271514544988832540184376_f,
+  0.78329980651187480766850512736710_f,
+  0.79713003606436383385869248741074_f,
+  0.81046447310395697272156212420668_f,
+  0.82330405358980018881709384004353_f,
+  0.83565027754317933172956145426724_f,
+  0.84750517959967996972636683494784_f,
+  0.85887130029565805777735931769712_f,
+  0.86975165810229559948396627078182_f,
+  0.88014972221759713022493087919429_f,
+  0.89006938612395802845611569864559_f,
+  0.89951494191638270425670498298132_f,
+  0.90849105540416208448561974364566_f,
+  0.91700274198663966895850307992077_f,
+  0.92505534330176886204100128452410_f,
+  0.93265450464436228106279713756521_f,
+  0.93980615314931148507326952312724_f,
+  0.94651647673356276158074251725338_f,
+  0.95279190378930389559997138348990_f,
+  0.95863908361960281645508530345978_f,
+  0.96406486760663989699082776496653_f,
+  0.96907629110173088005097952191136_f,
+  0.97368055602544811844012428991846_f,
+  0.97788501416539630461954857310047_f,
+  0.98169715115854372378123571252218_f,
+  0.98512457114440532546240092415246_f,
+  0.98817498207490861439339369098889_f,
+  0.99085618166632416503603053570259_f,
+  0.99317604397831871221313804198871_f,
+  0.99514250660488257071989437463344_f,
+  0.99676355846168307461852009510039_f,
+  0.99804722815421065273966405584360_f,
+  0.99900157291097935186030554177705_f,
+  0.99963466806597778280263355554780_f,
+  0.99995459707453304698532292604796_f,
+  0.99996944204678184231482873656205_f,
+  0.99968727478298213817708983697230_f,
+  0.99911614829499340029173026778153_f,
+  0.99826408879836825427389612741536_f,
+  0.99713908815964080734062235933379_f,
+  0.99574909678356704478829897198011_f,
+  0.99410201692526234396041218133178_f,
+  0.99220569641239209079941474556108_f,
+  0.99006792276279942388583776846644_f,
+  0.98769641768319571539791468239855_f,
+  0.98509883193479774732281839533243_f,
+  0.98228274055206499237868911222904_f,
+  0.97925563840096507828292260455783_f,
+  0.97602493606349083332673899349174_f,
+  0.97259795603543253150746750179678_f,
+  0.96898192922472781152265497439657_f,
+  0.96518399173799840351506418301142_f,
+  0.96121118194320576133549138830858_f,
+  0.95707043779665834648540112539195_f,
+  0.95276859442291739199504263524432_f,
+  0.94831238193646927303603888503858_f,
+  0.94370842349433070594955097476486_f,
+  0.93896323356908095725259499886306_f,
+  0.93408321643210823204128701036097_f,
+  0.92907466483718437189054384361953_f,
+  0.92394375889476842989012084217393_f,
+  0.91869656512775987877716943330597_f,
+  0.91333903569970642521980153105687_f,
+  0.90787700780677405010266056706314_f,
+  0.90231620322507510856269163923571_f,
+  0.89666222800523753821977379629971_f,
+  0.89092057230637700104836085301940_f,
+  0.88509661036190601102191521931672_f,
+  0.87919560056989731755550110392505_f,
+  0.87322268570096583939488255055039_f,
+  0.86718289321690911197748619088088_f,
+  0.86108113569358513128548793247319_f,
+  0.85492221134176993313502634919132_f,
+  0.84871080461995662691521147280582_f,
+  0.84245148693332383427190279689967_f,
+  0.83614871741329743759507664435660_f,
+  0.82980684377237867721532893483527_f,
+  0.82343010322911969200987414296833_f,
+  0.81702262349833432164558644217323_f,
+  0.81058842384184570661886937159579_f,
+  0.80413141617527050808433841666556_f,
+  0.79765540622652453262020344482153_f,
+  0.79116409474194071549391082953662_f,
+  0.78466107873604484801433045504382_f,
+  0.77814985278124193524007523592445_f,
+  0.77163381033381328588660608147620_f,
+  0.76511624509279874128964138435549_f,
+  0.75860035238849965466556568571832_f,
+  0.75208923059748933326318365288898_f,
+  0.74558588258116387237350863870233_f,
+  0.73909321714502440592298171395669_f,
+  0.73261405051599848281540516836685_f,
+  0.72615110783525882443001364663360_f,
+  0.71970702466413316589211035534390_f,
+  0.71328434850078858975308548906469_f,
+  0.70688554030554551221854353570961_f,
+  0.70051297603274287340013870561961_f,
+  0.69416894816722340966208548707073_f,
+  0.68785566726358371436589322911459_f,
+  0.68157526348647357039567395986523_f,
+  0.67532978815028998909042456944007_f,
+  0.66912121525672829669417751574656_f,
+  0.66295144302873798558550788584398_f,
+  0.65682229543952486139346547133755_f,
+  0.65073552373531007297913220099872_f,
+  0.64469280795064454192555558620370_f,
+  0.63869575841516790237761824755580_f,
+  0.63274591725074591508359844738152_f,
+  0.62684475985801801911634356656577_f,
+  0.62099369639144053056867278428399_f,
+  0.61519407322196872911490572732873_f,
+  0.60944717438661477615369221894071_f,
+  0.60375422302412062869336750736693_f,
+  0.59811638279611289981119170988677_f,
+  0.59253475929308863090483328051050_f,
+  0.58701040142469251836843113778741_f,
+  0.58154430279375124435148336488055_f,
+  0.57613740305360316984462087930297_f,
+  0.57079058924829395582634106176556_f,
+  0.56550469713525330917036626487970_f,
+  0.56028051249011345813499929136015_f,
+  0.55511877239335671863074139764649_f,
+  0.55002016649852769614170711065526_f,
+  0.54498533828176976001600451127160_f,
+  0.54001488627249039087274695702945_f,
+  0.53510936526497454579498480597977_f,
+  0.53026928751080748547508392221062_f,
+  0.52549512389199670714390322245890_f,
+  0.52078730507469095378780821192777_f,
+  0.51614622264344678370662222732790_f,
+  0.51157223021599307344331464264542_f,
+  0.50706564453847746687387143538217_f,
+  0.50262674656118844218610774987610_f,
+  0.49825578249479679504574392012728_f,
+  0.49395296484712286622098531552183_f,
+  0.48971847344051872008563464078179_f,
+  0.48555245640991467892533250960696_f,
+  0.48145503118163057720835240615997_f,
+  0.47742628543305559718490371778898_f,
+  0.47346627803329510708607585911523_f,
+  0.46957503996493971110126608436985_f,
+  0.46575257522706742241425104111840_f,
+  0.46199886171965048875520665205840_f,
+  0.45831385210951242070720468291256_f,
+  0.45469747467801363560724325907358_f,
+  0.45114963415063541463112528617785_f,
+  0.44767021250865318693357153279067_f,
+  0.44425906978308621342321771408024_f,
+  0.44091604483112523116261627365020_f,
+  0.43764095609524150676250542346679_f,
+  0.43443360234518807461157052784984_f,
+  0.43129376340310354720486429869197_f,
+  0.42822120085194581573517780270777_f,
+  0.42521565872746736047815829806495_f,
+  0.42227686419396565087325257081829_f,
+  0.41940452820404022782341257880034_f,
+  0.41659834614257590379438056515937_f,
+  0.41385799845520010453725490151555_f,
+  0.41118315126144094895366265518533_f,
+  0.40857345695282570874340422051318_f,
+  0.40602855477615901191867919806100_f,
+  0.40354807140221571337690420477884_f,
+  0.40113162148009573471085786877666_f,
+  0.39877880817747224373448489131988_f,
+  0.39648922370697814443474271683954_f,
+  0.39426244983896979734439014464442_f,
+  0.39209805840090700135291967853846_f,
+  0.38999561176358499281491276633460_f,
+  0.38795466331446404328886501389206_f,
+  0.38597475791832464020458814957237_f,
+  0.38405543236548694840948314777052_f,
+  0.38219621580783286196592030137253_f,
+  0.38039663018285546636221283733903_f,
+  0.37865619062597688504467896564165_f,
+  0.37697440587135083722714057330450_f,
+  0.37535077864139254621989039151231_f,
+  0.37378480602524544185172317156685_f,
+  0.37227597984642291084611542828497_f,
+  0.37082378701983220725679757379112_f,
+  0.36942770989841383633134341835103_f,
+  0.36808722660959419803461400988454_f,
+  0.36680181138178741262478865792218_f,
+  0.36557093486113650948610143132100_f,
+  0.36439406441871885489192095519684_f,
+  0.36327066444841077386129768456158_f,
+  0.36220019665562441790740422220551_f,
+  0.36118212033710755948234805146058_f,
+  0.36021589265201203744481972535141_f,
+  0.35930096888442425440146621440363_f,
+  0.35843680269754746303689785236202_f,
+  0.35762284637972580059184224410274_f,
+  0.35685855108250402745184715058713_f,
+  0.35614336705089311152505615609698_f,
+  0.35547674384603655806103006398189_f,
+  0.35485813056044512858733241955633_f,
+  0.35428697602598230309567384210823_f,
+  0.35376272901476857324354341471917_f,
+  0.35328483843317448620524601210491_f,
+  0.35285275350907091551633243398101_f,
+  0.35246592397249820738380776674603_f,
+  0.35212380022991590644565462753235_f,
+  0.35182583353219076816031929411110_f,
+  0.35157147613647793393809592998878_f,
+  0.35136018146214686996842146982090_f,
+  0.35119140424090544705393313051900_f,
+  0.35106460066126149444087900519662_f,
+  0.35097922850747220735456721740775_f,
+  0.35093474729312162940786379294877_f,
+  0.35093061838945965869029919304012_f,
+  0.35096630514864557426335522904992_f,
+  0.35104127302202348115400809547282_f,
+  0.35115498967356206794221407108125_f,
+  0.35130692508858835099161410653323_f,
+  0.35149655167793725230040990936686_f,
+  0.35172334437764080083965723133588_f,
+  0.35198678074428135786888560687657_f,
+  0.35228634104611677990703810792184_f,
+  0.35262150835010475091735315800179_f,
+  0.35299176860492875729136130757979_f,
+  0.35339661072014316722800231218571_f,
+  0.35383552664154110933836250296736_f,
+  0.35430801142285311966517724613368_f,
+  0.35481356329387869763536400569137_f,
+  0.35535168372515341106421260519710_f,
+  0.35592187748924869472588738972263_f,
+  0.35652365271880193109410583929275_f,
+  0.35715652096137207038850647222716_f,
+  0.35781999723121188372587653248047_f,
+  0.35851360005804749908620010501181_f,
+  0.35923685153295503713621883434826_f,
+  0.35998927735141794670425952062942_f,
+  0.36077040685365213690261043666396_f,
+  0.36157977306227873093291691475315_f,
+  0.36241691271742698665647708367032_f,
+  0.36328136630934415585159058537101_f,
+  0.36417267810859033083659141993849_f,
+  0.36509039619389216380085372293252_f,
+  0.36603407247772917765260558553564_f,
+  0.36700326272972327856791707745288_f,
+  0.36799752659790246900328725132567_f,
+  0.36901642762790443086373670666944_f,
+  0.37005953328018859060932754800888_f,
+  0.37112641494531950492330452107126_f,
+  0.37221664795738601538843681737490_f,
+  0.37332981160561617972604153692373_f,
+  0.37446548914424959697555550519610_f,
+  0.37562326780072335941085270860640_f,
+  0.37680273878223219385930065072898_f,
+  0.37800349728071303001541991761769_f,
+  0.37922514247631411432593040444772_f,
+  0.38046727753939640903624308521103_f,
+  0.38172950963112173283775518939365_f,
+  0.38301144990267638190672983000695_f,
+  0.38431271349317913665899482111854_f,
+  0.38563291952632178238857818541874_f,
+  0.38697169110578721884508013317827_f,
+  0.38832865530949212118372315671877_f,
+  0.38970344318269489747308398364112_f,
+  0.39109568973001551661639041412855_f,
+  0.39250503390640495426922029764683_f,
+  0.39393111860710749994041179888882_f,
+  0.39537359065665494961550052721577_f,
+  0.39683210079692721183874937196379_f,
+  0.39830630367432284799633634975180_f,
+  0.39979585782607102162344858697907_f,
+  0.40130042566572127205049014264659_f,
+  0.40281967346784564032446951387101_f,
+  0.40435327135198673165206173507613_f,
+  0.40590089326588307816479073153459_f,
+  0.40746221696800505318591945069784_f,
+  0.40903692400942798235163877507148_f,
+  0.41062469971507886690176292177057_f,
+  0.41222523316437748031049181918206_f,
+  0.41383821717130642170445753436070_f,
+  0.41546334826393382932963049825048_f,
+  0.41710032666341606555349130758259_f,
+  0.41874885626250701875505910720676_f,
+  0.42040864460359594900751289969776_f,
+  0.42207940285630296539665096133831_f,
+  0.42376084579465012058818729201448_f,
+  0.42545269177383415737381255894434_f,
+  0.42715466270662300063420957485505_f,
+  0.42886648403939664486728133852012_f,
+  0.43058788472785086698380041525525_f,
+  0.43231859721238963256695342352032_f,
+  0.43405835739322012889473967334197_f,
+  0.43580690460517135242923814075766_f,
+  0.43756398159225573518682494977838_f,
+  0.43932933448198929760053488280391_f,
+  0.44110271275949014535555647853471_f,
+  0.44288386924136924349681976309512_f,
+  0.44467256004943117586591938561469_f,
+  0.44646854458419954481129821033392_f,
+  0.44827158549828421962857305516081_f,
+  0.45008144866960203556160990956414_f,
+  0.45189790317446776324317170292488_f,
+  0.45372072126056489649315039969224_f,
+  0.45554967831981746373415376183402_f,
+  0.45738455286116369569171524744888_f,
+  0.45922512648325830575402051181300_f,
+  0.46107118384710038538898402293853_f,
+  0.46292251264861039583564661370474_f,
+  0.46477890359116058593969000867219_f,
+  0.46664015035807354658814460890426_f,
+  0.46850604958509284303502795410168_f,
+  0.47037640083284681935538174002431_f,
+  0.47225100655930174475827243441017_f,
+  0.47412967209222528497392090685025_f,
+  0.47601220560166113138222954148659_f,
+  0.47789841807242905424857326579513_f,
+  0.47978812327665387726938206469640_f,
+  0.48168113774633497525812231288000_f,
+  0.48357728074596234568716113244591_f,
+  0.48547637424518658155747630189580_f,
+  0.48737824289155129431350133017986_f,
+  0.48928271398329037378260863988544_f,
+  0.49118961744220557275042438050150_f,
+  0.49309878578661858750109558968688_f,
+  0.49501005410441584198011355510971_f,
+  0.49692326002618153468759487623174_f,
+  0.49883824369843227097831572791620_f,
+  0.50075484775695311423504563208553_f,
+  0.50267291730024232787599203220452_f,
+  0.50459229986307241322407435291097_f,
+  0.50651284539016727670457385102054_f,
+  0.50843440620999846846217451457051_f,
+  0.51035683700871758983197423731326_f,
+  0.51227999480420793876334073502221_f,
+  0.51420373892028214957150566988275_f,
+  0.51612793096100861856001529304194_f,
+  0.51805243478518692157308578316588_f,
+  0.51997711648096389680517859233078_f,
+  0.52190184434060093998652973823482_f,
+  0.52382648883539084661009610499605_f,
+  0.52575092259072853106971479064669_f,
+  0.52767502036134095177999370207544_f,
+  0.52959865900667335569806937201065_f,
+  0.53152171746643872562998467401485_f,
+  0.53344407673633242872313076077262_f,
+  0.53536561984390984569870397535851_f,
+  0.53728623182463408625153533648700_f,
+  0.53920579969809168119354580994695_f,
+  0.54112421244438468903581451741047_f,
+  0.54304136098068811477901363105047_f,
+  0.54495713813799007141369656892493_f,
+  0.54687143863799980714190951402998_f,
+  0.54878415907024102882161287197960_f,
+  0.55069519786931797611373440304305_f,
+  0.55260445529236279504914364224533_f,
+  0.55451183339666332283712790740537_f,
+  0.55641723601747361538372160794097_f,
+  0.55832056874600133333785834111040_f,
+  0.56022173890758708569848067782004_f,
+  0.56212065554005519185665207260172_f,
+  0.56401722937225950982309541359427_f,
+  0.56591137280280812138499868524377_f,
+  0.56780299987897053792806900673895_f,
+  0.56969202627577442132889018466813_f,
+  0.57157836927528715698088035424007_f,
+  0.57346194774607772703944874592707_f,
+  0.57534268212286965304969044154859_f,
+  0.57722049438637668128393443112145_f,
+  0.57909530804332498554742869600886_f,
+  0.58096704810665700247085396767943_f,
+  0.58283564107592733538609763854765_f,
+  0.58470101491787573877445538528264_f,
+  0.58656309904719150516427816910436_f,
+  0.58842182430745582077946664867341_f,
+  0.59027712295227230399063955701422_f,
+  0.59212892862658306203371694209636_f,
+  0.59397717634815927478797448202386_f,
+  0.59582180248928362509275302727474_f,
+  0.59766274475860858839126876773662_f,
+  0.59949994218320057370874565094709_f,
+  0.60133333509075859169001887494233_f,
+  0.60316286509202388099737390803057_f,
+  0.60498847506335218238149309399887_f,
+  0.60681010912948540880762493543443_f,
+  0.60862771264648141134045999933733_f,
+  0.61044123218483614667917436236166_f,
+  0.61225061551277060178932742928737_f,
+  0.61405581157970334782447707766551_f,
+  0.61585677049989129283602551367949_f,
+  0.61765344353624240802957956475439_f,
+  0.61944578308430942037432487268234_f,
+  0.62123374265644593084090274714981_f,
+  0.62301727686614216672467136959312_f,
+  0.62479634141252238244135241984623_f,
+  0.62657089306501623227063646481838_f,
+  0.62834088964819800882111167084076_f,
+  0.63010629002678908427981241402449_f,
+  0.63186705409082988271762815202237_f,
+  0.63362314274101516620163465631776_f,
+  0.63537451787419052529060081724310_f,
+  0.63712114236901484787267690990120_f,
+  0.63886298007178399238625843281625_f,
+  0.64059999578240955919739008095348_f,
+  0.64233215524056375134165364215733_f,
+  0.64405942511197822319957140280167_f,
+  0.64578177297489902652927185044973_f,
+  0.64749916730669965225786199880531_f,
+  0.64921157747064428544803149634390_f,
+  0.65091897370281248669243723270483_f,
+  0.65262132709916576001063504008926_f,
+  0.65431860960277066219248354173033_f,
+  0.65601079399117223633908224655897_f,
+  0.65769785386391288461993553937646_f,
+  0.65937976363019845660318196678418_f,
+  0.66105649849671443973875284427777_f,
+  0.66272803445558126078651639545569_f,
+  0.66439434827245646975057979943813_f,
+  0.66605541747477958747225557090132_f,
+  0.66771122034015562007880362216383_f,
+  0.66936173588487946073399825763772_f,
+  0.67100694385260117869052010064479_f,
+  0.67264682470312431306069811398629_f,
+  0.67428135960134405468835439023678_f,
+  0.67591053040631732251597441063495_f,
+  0.67753431966047028556232589835417_f,
+  0.67915271057893500383784157747868_f,
+  0.68076568703901774171072247554548_f,
+  0.68237323356979817656764453204232_f,
+  0.68397533534185894765755620028358_f,
+  0.68557197815713877275811682920903_f,
+  0.68716314843891435071299156334135_f,
+  0.68874883322190916246086089813616_f,
+  0.69032902014252128797267005211324_f,
+  0.69190369742917878781440776947420_f,
+  0.69347285389281398959582247698563_f,
+  0.69503647891745745646119303273736_f,
+  0.69659456245095585646964764237055_f,
+  0.69814709499579985507722312831902_f,
+  0.69969406760007535339696005394217_f,
+  0.70123547184852719205139237601543_f,
+  0.70277129985374009457643751375144_f,
+  0.70430154424742730245867505800561_f,
+  0.70582619817183689381323574707494_f,
+  0.70734525527126657085119632029091_f,
+  0.70885870968368824840410979959415_f,
+  0.71036655603248111123804164890316_f,
+  0.71186878941827269606790196121437_f,
+  0.71336540541088699907135151079274_f,
+  0.71485640004139316960873884454486_f,
+  0.71634176979426689158003682678100_f,
+  0.71782151159964546760505754718906_f,
+  0.71929562282569292630540758182178_f,
+  0.72076410127105694503057975452975_f,
+  0.72222694515743590670808771392331_f,
+  0.72368415312223555169168776046718_f,
+  0.72513572421132643786023663778906_f,
+  0.72658165787190109874416066304548_f,
+  0.72802195394542046358310471987352_f,
+  0.72945661266065964234428520285292_f,
+  0.73088563462684341676123267461662_f,
+  0.73230902082687598930732519875164_f,
+  0.73372677261066399090339018584928_f,
+  0.73513889168852331046366543887416_f,
+  0.73654538012467984930964348677662_f,
+  0.73794624033085953751509578069090_f,
+  0.73934147505996272720096840203041_f,
+  0.74073108739982307380245174499578_f,
+  0.74211508076705778869097684946610_f,
+  0.74349345890099438616260840717587_f,
+  0.74486622585768824666985210569692_f,
+  0.74623338600401623033064879564336_f,
+  0.74759494401185500045414755732054_f,
+  0.74895090485233972721346162870759_f,
+  0.75030127379019873057330869414727_f,
+  0.75164605637817161198910298480769_f,
+  0.75298525845150365842783912739833_f,
+  0.75431888612251252190787909057690_f,
+  0.75564694577523516816341953017400_f,
+  0.75696944406015087558614595764084_f,
+  0.75828638788897329003901859323378_f,
+  0.75959778442951919608105981751578_f,
+  0.76090364110064834246571763287648_f,
+  0.76220396556727543213582976022735_f,
+  0.76349876573545116809071942043374_f,
+  0.76478804974751468659377451331238_f,
+  0.76607182597731271478380676853703_f,
+  0.76735010302549022664919675662532_f,
+  0.76862288971484338251372037120746_f,
+  0.76989019508574429995206855892320_f,
+  0.77115202839162533265948695770930_f,
+  0.77240839909453506972880632019951_f,
+  0.77365931686075173345784605771769_f,
+  0.77490479155646374564980760624167_f,
+  0.77614483324351213333613941358635_f,
+  0.77737945217519177631970705988351_f,
+  0.77860865879211960116634827500093_f,
+  0.77983246371815539976779518838157_f,
+  0.78105087775638792901844453808735_f,
+  0.78226391188517507835342712496640_f,
+  0.78347157725424976248973507608753_f,
+  0.78467388518086855775379717670148_f,
+  0.78587084714603583357472871284699_f,
+  0.78706247479076574258272103179479_f,
+  0.78824877991241226737884062458761_f,
+  0.78942977446104489747114030251396_f,
+  0.79060547053588348109798289442551_f,
+  0.79177588038178592366733710150584_f,
+  0.79294101638578184942929283351987_f,
+  0.79410089107366832461565309131402_f,
+  0.79525551710664588167531974249869_f,
+  0.79640490727801394044149674300570_f,
+  0.79754907450990930595224881471950_f,
+  0.79868803185009740186472981804400_f,
+  0.79982179246881157652637739374768_f,
+  0.80095036965563815023472216125811_f,
+  0.80207377681645219968942228661035_f,
+  0.80319202747039653011995596898487_f,
+  0.80430513524690827598107034646091_f,
+  0.80541311388279235305986958337598_f,
+  0.80651597721933476758948700080509_f,
+  0.80761373919946777277800720185041_f,
+  0.80870641386497077451878112697159_f,
+  0.80979401535372186327066401645425_f,
+  0.81087655789698342978510936518433_f,
+  0.81195405581673985029311779726413_f,
+  0.81302652352306614691457298249588_f,
+  0.81409397551154627503677829736262_f,
+  0.81515642636072693782978149101837_f,
+  0.81621389072961125776828339439817_f,
+  0.81726638335519552480690208540182_f,
+  0.81831391905003891817926842122688_f,
+  0.81935651269987808120731642702594_f,
+  0.82039417926127433666749766416615_f,
+  0.82142693375929887178443777884240_f,
+  0.82245479128525744716426970626344_f,
+  0.82347776699445163206547704248806_f,
+  0.82449587610396823933456289523747_f,
+  0.82550913389051572277566037882934_f,
+  0.82651755568828522147128978758701_f,
+  0.82752115688685412564495891274419_f,
+  0.82851995292911562174253958801273_f,
+  0.82951395930924820554253074078588_f,
+  0.83050319157071728071173311036546_f,
+  0.83148766530430284760200265736785_f,
+  0.83246739614616971358884711662540_f,
+  0.83344239977596068502663229082827_f,
+  0.83441269191492650758590343684773_f,
+  0.83537828832408222989869273078511_f,
+  0.83633920480239787309528765035793_f,
+  0.83729545718501741102812729877769_f,
+  0.83824706134150706038354883276043_f,
+  0.83919403317413343579289630724816_f,
+  0.84013638861616979358615253659082_f,
+  0.84107414363023114134421120979823_f,
+  0.84200731420663965653972127256566_f,
+  0.84293591636180986714776963708573_f,
+  0.84385996613667424437466024755850_f,
+  0.84477947959512167397377879751730_f,
+  0.84569447282247212083206022725790_f,
+  0.84660496192397360903925118691404_f,
+  0.84751096302332462606443641561782_f,
+  0.84841249226122461557508813712047_f,
+  0.84930956579394623062739810848143_f,
+  0.85020219979193412118689820999862_f,
+  0.85109041043842936780094987625489_f,
+  0.85197421392811423235258416752913_f,
+  0.85285362646578510847916732018348_f,
+  0.85372866426504345760406522458652_f,
+  0.85459934354701694303457770729437_f,
+  0.85546568053909610718221756542334_f,
+  0.85632769147369747209097567974823_f,
+  0.85718539258704951055989340602537_f,
+  0.85803880011799493754409695611685_f,
+  0.85888793030682319962210158337257_f,
+  0.85973279939411428873796694460907_f,
+  0.86057342361961242094281487879925_f,
+  0.86140981922111381496875992525020_f,
+  0.86224200243337800753096189509961_f,
+  0.86306998948705782037649214544217_f,
+  0.86389379660765075463757511897711_f,
+  0.86471344001446659444098941094126_f,
+  0.86552893591961788111177611426683_f,
+  0.86634030052702615254389684196212_f,
+  0.86714755003145049805368671513861_f,
+  0.86795070061752899182039300285396_f,
+  0.86874976845884310794332350269542_f,
+  0.86954476971699878884436429871130_f,
+  0.87033572054072283474823734650272_f,
+  0.87112263706497872206568899855483_f,
+  0.87190553541010085147888730716659_f,
+  0.87268443168094012030167050397722_f,
+  0.87345934196603336463482492035837_f,
+  0.87423028233678234943937468415243_f,
+  0.87499726884665429693654914444778_f,
+  0.87576031753039529359483594816993_f,
+  0.87651944440325824103865670622326_f,
+  0.87727466546025101301609083748190_f,
+  0.87802599667539305006158656397020_f,
+  0.87877345400099471373067672175239_f,
+  0.87951705336694196990521277257358_f,
+  0.88025681068000571904974549397593_f,
+  0.88099274182315800985065834538545_f,
+  0.88172486265490435108915789896855_f,
+  0.88245318900863212174812133525847_f,
+  0.88317773669196963925998034028453_f,
+  0.88389852148616010474313497979892_f,
+  0.88461555914544887091466307538212_f,
+  0.88532886539648347756781276984839_f,
+  0.88603845593772712074809305704548_f,
+  0.88674434643888300211500563818845_f,
+  0.88744655254033411040381906786934_f,
+  0.88814508985259299489456452647573_f,
+  0.88883997395576475053502463197219_f,
+  0.88953122039901988404864141557482_f,
+  0.89021884470008350032088628722704_f,
+  0.89090286234472992887845066434238_f,
+  0.89158328878629600211525030317716_f,
+  0.89226013944519788623210843070410_f,
+  0.89293342970846356632108609119314_f,
+  0.89360317492927743288078090699855_f,
+  0.89426939042653152966977359028533_f,
+  0.89493209148438912503564779399312_f,
+  0.89559129335186082876418822706910_f,
+  0.89624701124238659311060928303050_f,
+  0.89689926033343236877470872059348_f,
+  0.89754805576609342221416909524123_f,
+  0.89819341264470875518810544235748_f,
+  0.89883534603648551630783458676888_f,
+  0.89947387097113151721572421593009_f,
+  0.90010900244049862894968327964307_f,
+  0.90074075539823472702494200348156_f,
+  0.90136914475944396318851659088978_f,
+  0.90199418540035636304708077659598_f,
+  0.90261589215800874796968855662271_f,
+  0.90323427982992887663726833125111_f,
+  0.90384936317383279824611008734792_f,
+  0.90446115690732886704950033163186_f,
+  0.90506967570763074970585648770793_f,
+  0.90567493421127609476428688140004_f,
+  0.90627694701385563824658220255515_f,
+  0.90687572866975052487958919300581_f,
+  0.90747129369187495839810253528412_f,
+  0.90806365655142884385497836774448_f,
+  0.90865283167765442673413645024993_f,
+  0.90923883345760714291827753186226_f,
+  0.90982167623592424821055146821891_f,
+  0.91040137431460943506777994116419_f,
+  0.91097794195281789342288902844302_f,
+  0.91155139336665313987140280005406_f,
+  0.91212174272896595628168370240019_f,
+  0.91268900416916631801456105677062_f,
+  0.91325319177303354578612015757244_f,
+  0.91381431958254077940750903508160_f,
+  0.91437240159568045072546738083474_f,
+  0.91492745176630052572619433703949_f,
+  0.91547948400394041357230889843777_f,
+  0.91602851217368175262834029126680_f,
+  0.91657455009599542172793462668778_f,
+  0.91711761154660298434038168124971_f,
+  0.91765771025633890989325891496264_f,
+  0.91819485991101879029940846521640_f,
+  0.91872907415131466191127174170106_f,
+  0.91926036657263598961264960962581_f,
+  0.91978875072501464771335122350138_f,
+  0.92031424011299378662442904897034_f,
+  0.92083684819552868994207983632805_f,
+  0.92135658838588196939412000574521_f,
+  0.92187347405153385881959593461943_f,
+  0.92238751851409128690306715725455_f,
+  0.92289873504920560964848164076102_f,
+  0.92340713688649089796456337353447_f,
+  0.92391273720945177316821173008066_f,
+  0.92441554915541157555480822338723_f,
+  0.92491558581544763839588085829746_f,
+  0.92541286023432922647202758525964_f,
+  0.92590738541046380127852444275049_f,
+  0.92639917429584095476258198686992_f,
+  0.92688823979598555791170610973495_f,
+  0.92737459476991690454639183371910_f,
+  0.92785825203010219297539151739329_f,
+  0.92833922434242788224167952648713_f,
+  0.92881752442616150045040512850392_f,
+  0.92929316495392821906307290191762_f,
+  0.92976615855168298629962464474374_f,
+  0.93023651779869220845853305945639_f,
+  0.93070425522751609737071021299926_f,
+  0.93116938332399501465630464736023_f,
+  0.93163191452723992380668960322510_f,
+  0.93209186122962484066789556891308_f,
+  0.93254923577678727752982013043948_f,
+  0.93300405046762280303340730824857_f,
+  0.93345631755429581133398642123211_f,
+  0.93390604924223985516817947427626_f,
+  0.93435325769017119057480158517137_f,
+  0.93479795501010154445964417391224_f,
+  0.93524015326735321362860986482701_f,
+  0.93567986448057915982445820191060_f,
+  0.93611710062178410396427352679893_f,
+  0.93655187361635072740284613246331_f,
+  0.93698419534306554012914602935780_f,
+  0.93741407763415152132324692502152_f,
+  0.93784153227529953866792311600875_f,
+  0.93826657100570498570846211805474_f,
+  0.93868920551810663965852654655464_f,
+  0.93910944745882674045134308471461_f,
+  0.93952730842781506659378010226646_f,
+  0.93994279997869478737726467443281_f,
+  0.94035593361881086860165623875218_f,
+  0.94076672080928058772286703970167_f,
+  0.94117517296504737966955644878908_f,
+  0.94158130145493446061522035961389_f,
+  0.94198511760170500206612587135169_f,
+  0.94238663268211975143628933437867_f,
+  0.94278585792699853840304058394395_f,
+  0.94318280452128566704317336188979_f,
+  0.94357748360411664023672528855968_f,
+  0.94396990626888288566931350942468_f,
+  0.94436008356330480850715503038373_f,
+  0.94474802648950262362603780275094_f,
+  0.94513374600406940828634105855599_f,
+  0.94551725301814770752173444634536_f,
+  0.94589855839750613952787716698367_f,
+  0.94627767296261977580940083498717_f,
+  0.94665460748874863394775047709118_f,
+  0.94702937270602394193019790691324_f,
+  0.94740197929952774114070734867710_f,
+  0.94777243790938281442493007489247_f,
+  0.94814075913083761815158823083038_f,
+  0.94850695351435632129977193471859_f,
+  0.94887103156570951068005115303094_f,
+  0.94923300374606367491026048810454_f,
+  0.94959288047207834893015387933701_f,
+  0.94995067211599770740093617860111_f,
+  0.95030638900574915250984986414551_f,
+  0.95066004142503890417259526657290_f,
+  0.95101163961345114294942959531909_f,
+  0.95136119376654904034040782789816_f,
+  0.95170871403597534499141374908504_f,
+  0.95205421052955419014551807777025_f,
+  0.95239769331139745300873755695648_f,
+  0.95273917240200667322369554312900_f,
+  0.95307865777838018939149833386182_f,
+  0.95341615937412038661591395793948_f,
+  0.95375168707954249835978544069803_f,
+  0.95408525074178196501151205666247_f,
+  0.95441686016490800970046848306083_f,
+  0.95474652511002999766276388982078_f,
+  0.95507425529541500885954974364722_f,
+  0.95540006039659652881113061084761_f,
+  0.95572395004649113303685226128437_f,
+  0.95604593383551350616045283459243_f,
+  0.95636602131169001772548199369339_f,
+  0.95668422198077818219275059163920_f,
+  0.95700054530638223315719415040803_f,
+  0.95731500071007191721150775265414_f,
+  0.95762759757150228701050309609855_f,
+  0.95793834522853182900092861018493_f,
+  0.95824725297734525408799299839302_f,
+  0.95855433007257251354360505501973_f,
+  0.95885958572741236682901444510208_f,
+  0.95916302911375428408291554660536_f,
+  0.95946466936230079269876114267390_f,
+  0.95976451556269404274956968947663_f,
+  0.96006257676363615516379468317609_f,
+  0.96035886197301856270769349066541_f,
+  0.96065338015804446758494350433466_f,
+  0.96094614024535662810677649758873_f,
+  0.96123715112116259184915634250501_f,
+  0.96152642163136325947903060296085_f,
+  0.96181396058168022733525504008867_f,
+  0.96209977673778268592030826766859_f,
+  0.96238387882541809315029013305320_f,
+  0.96266627553053862875742652249755_f,
+  0.96294697549943308878539482975611_f,
+  0.96322598733885445021485338656930_f,
+  0.96350331961615220954797678132309_f,
+  0.96377898085940094663470745217637_f,
+  0.96405297955753233019038361817366_f,
+  0.96432532416046645717955243526376_f,
+  0.96459602307924274811057330225594_f,
+  0.96486508468615184153094332941691_f,
+  0.96513251731486870976794989474001_f,
+  0.96539832926058333217866902487003_f,
+  0.96566252878013514315824750156025_f,
+  0.96592512409214470459062340523815_f,
+  0.96618612337714826487911068397807_f,
+  0.96644553477772909833021230951999_f,
+  0.96670336639865206418420484624221_f,
+  0.96695962630699827666802548264968_f,
+  0.96721432253229788766901720009628_f,
+  0.96746746306666397963169856666354_f,
+  0.96771905586492834583367539380561_f,
+  0.96796910884477327385866374243051_f,
+  0.96821762988686910222924097979558_f,
+  0.96846462683500733614749833577662_f,
+  0.96871010749623398528029838416842_f,
+  0.96895407964098712039202609958011_f,
+  0.96919655100323043317445126376697_f,
+  0.96943752928058735118810318454052_f,
+  0.96967702213447837245041682763258_f,
+  0.96991503719025351504257059787051_f,
+  0.97015158203732920760842262097867_f,
+  0.97038666422932318145200270009809_f,
+  0.97062029128418825241197964714956_f,
+  0.97085247068434987749441233972902_f,
+  0.97108320987684004776951951498631_f,
+  0.97131251627343118126844956350396_f,
+  0.97154039725077401268293897373951_f,
+  0.97176686015053026501675503823208_f,
+  0.97199191227950920701772474785685_f,
+  0.97221556090980187914141197325080_f,
+  0.97243781327891598564860942133237_f,
+  0.97265867658991245203736752955592_f,
+  0.97287815801153709749371500947746_f,
+  0.97309626467835863561361975371256_f,
+  0.97331300369090156809903646717430_f,
+  0.97352838211578041072158384849899_f,
+  0.97374240698583591768766609675367_f,
+  0.97395508530026764226761315512704_f,
+  0.97416642402476871787087020493345_f,
+  0.97437643009165997298737238452304_f,
+  0.97458511040002437919582689573872_f,
+  0.97479247181584105508278526031063_f,
+  0.97499852117211649460415401335922_f,
+  0.97520326526902112451722359764972_f,
+  0.97540671087402164296520368225174_f,
+  0.97560886472201313601715355616761_f,
+  0.97580973351545297056475192221114_f,
+  0.97600932392449490926367161591770_f,
+  0.97620764258711800742673858621856_f,
+  0.97640469610926328147826325221104_f,
+  0.97660049106496349402561918395804_f,
+  0.97679503399647560346608088366338_f,
+  0.97698833141441299154905664181570_f,
+  0.97718038979787624764838938062894_f,
+  0.97737121559458572939149689773330_f,
+  0.97756081522101212488706778458436_f,
+  0.97774919506250734801966473241919_f,
+  0.97793636147343443454360567557160_f,
+  0.97812232077729965862289418510045_f,
+  0.97830707926688176279128583701095_f,
+  0.97849064320436152097926196802291_f,
+  0.97867301882145252278633051901124_f,
+  0.97885421231952951526267270310200_f,
+  0.97903422986975796593611676144064_f,
+  0.97921307761322384788371664399165_f,
+  0.97939076166106042720116420241538_f,
+  0.97956728809457882523048510847730_f,
+  0.97974266296539314069491410918999_f,
+  0.97991689229555212214961557037896_f,
+  0.98008998207766284682662671912112_f,
+  0.98026193827502039468413386202883_f,
+  0.98043276682173385871976734051714_f,
+  0.98060247362285302141771126116510_f,
+  0.98077106455449469812890583853005_f,
+  0.98093854546396852533973742538365_f,
+  0.98110492216990319302993839301053_f,
+  0.98127020046237123374055499880342_f,
+  0.98143438610301436675342756643659_f,
+  0.98159748482516850920376327849226_f,
+  0.98175950233398689981356710632099_f,
+  0.98192044430656599818263430279330_f,
+  0.98208031639206883056658625719137_f,
+  0.98223912421184633725346202481887_f,
+  0.98239687335956360492161820729962_f,
+  0.98255356940132065890480816960917_f,
+  0.98270921787577558692561296993517_f,
+  0.98286382429426555340512550174026_f,
+  0.98301739414093081137480112374760_f,
+  0.98316993287283316327318516414380_f,
+  0.98332144592007952876855370050180_f,
+  0.98347193868594173782327061417163_f,
+  0.98362141654697587966893479460850_f,
+  0.98376988485314398324987905652961_f,
+  0.98391734892793203393068779405439_f,
+  0.98406381406847176496199836037704_f,
+  0.98420928554565556556354977146839_f,
+  0.98435376860425960465761363593629_f,
+  0.98449726846305751770671577105531_f,
+  0.98463979031494286431325235753320_f,
+  0.98478133932704248199030416799360_f,
+  0.98492192064083594615908623381983_f,
+  0.98506153937227181049962609904469_f,
+  0.98520020061188351423453468669322_f,
+  0.98533790942490639963580179028213_f,
+  0.98547467085139106579561030230252_f,
+  0.98561048990632149635615633087582_f,
+  0.98574537157972852430276589075220_f,
+  0.98587932083680362982391898185597_f,
+  0.98601234261801418146120568053448_f,
+  0.98614444183921701192474529307219_f,
+  0.98627562339177032857406857146998_f,
+  0.98640589214264939865728365475661_f,
+  0.98653525293455623934590903445496_f,
+  0.98666371058603397070640994570567_f,
+  0.98679126989157783800266088292119_f,
+  0.98691793562174534581998841531458_f,
+  0.98704371252327016694749772796058_f,
+  0.98716860531917027810067111204262_f,
+  0.98729261870885887120152801799122_f,
+  0.98741575736825526465878510862240_f,
+}}};
+
+/* triangles */
+const Buffer<Buffer<f, 9>, 8> Data::triangles = {{{
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.75000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.25000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    0.25000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    0.75000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -0.66666000000000003034017481695628_f,
+    -0.33333000000000001517008740847814_f,
+    0.00000000000000000000000000000000_f,
+    0.33333000000000001517008740847814_f,
+    0.66666000000000003034017481695628_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    -0.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    -1.00000000000000000000000000000000_f,
+    -0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    0.50000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+  }}},
+  {{{
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    0.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+    1.00000000000000000000000000000000_f,
+    -1.00000000000000000000000000000000_f,
+  }}},
+}}};
+
+/* harm */
+const Buffer<f, 16> Data::harm = {{{
+  -12.00000000000000000000000000000000_f,
+  0.00000000000000000000000000000000_f,
+  7.01955000865387290787111851386726_f,
+  12.00000000000000000000000000000000_f,
+  15.86313713864834795685965218581259_f,
+  19.01955000865387290787111851386726_f,
+  21.68825906469125186504243174567819_f,
+  24.00000000000000000000000000000000_f,
+  26.03910001730774581574223702773452_f,
+  27.86313713864834795685965218581259_f,
+  29.51317942364757129780628019943833_f,
+  31.01955000865387290787111851386726_f,
+  32.40527661769310441286506829783320_f,
+  33.68825906469125186504243174567819_f,
+  34.88268714730222086473077069967985_f,
+  36.00000000000000000000000000000000_f,
+}}};
+
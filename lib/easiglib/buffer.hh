@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 
 #include "util.hh"
 #include "signal.hh"
@@ -66,16 +68,19 @@ struct Buffer : std::array<T, SIZE> {
 
   constexpr int size() const { return SIZE; }
 
-  constexpr T interpolate(f phase) const {
+  // compact types (f16) are interpolated in their full-size counterpart
+  using interpolated_type = typename Widened<T>::type;
+
+  constexpr interpolated_type interpolate(f phase) const {
     constexpr f const max = f(SIZE-1);
     phase *= max;
     return interpolate_from_index(phase);
   }
 
-  constexpr T interpolate_from_index(f index) const {
+  constexpr interpolated_type interpolate_from_index(f index) const {
     auto [integral, fractional] = index.integral_fractional();
-    T a = (*this)[integral];
-    T b = (*this)[integral+1];
+    interpolated_type a = widen((*this)[integral]);
+    interpolated_type b = widen((*this)[integral+1]);
     return Signal::crossfade(a, b, fractional);
   }
 
@@ -86,17 +91,17 @@ struct Buffer : std::array<T, SIZE> {
     phase *= max;
     auto [integral, fractional] = phase.integral_fractional();
     auto [a, d] = (*this)[integral];
-    return Signal::crossfade_with_diff(a, d, fractional);
+    return U(Signal::crossfade_with_diff(widen(a), widen(d), fractional));
   }
 
-  constexpr T interpolate(u0_32 const phase) const {
+  constexpr interpolated_type interpolate(u0_32 const phase) const {
     static_assert(is_power_of_2(SIZE-1), "only power-of-two-sized buffers");
     constexpr int BITS = Log2<SIZE>::val;
     Fixed<UNSIGNED, BITS, 32-BITS> p = phase.movr<BITS>();
     int integral = p.integral();
     auto fractional = p.fractional();
-    T a = (*this)[integral];
-    T b = (*this)[integral+1];
+    interpolated_type a = widen((*this)[integral]);
+    interpolated_type b = widen((*this)[integral+1]);
     return Signal::crossfade(a, b, fractional);
   }
 
@@ -108,17 +113,17 @@ struct Buffer : std::array<T, SIZE> {
     int integral = p.integral();
     u0_32 fractional = p.fractional();
     auto [a, d] = (*this)[integral];
-    return Signal::crossfade_with_diff(a, d, fractional);
+    return U(Signal::crossfade_with_diff(widen(a), widen(d), fractional));
   }
 
-  constexpr T interpolate(u0_16 const phase) const {
+  constexpr interpolated_type interpolate(u0_16 const phase) const {
     static_assert(is_power_of_2(SIZE-1), "only power-of-two-sized buffers");
     constexpr int BITS = Log2<SIZE>::val;
     Fixed<UNSIGNED, BITS, 16-BITS> p = phase.movr<BITS>();
     int integral = p.integral();
     auto fractional = p.fractional();
-    T a = (*this)[integral];
-    T b = (*this)[integral+1];
+    interpolated_type a = widen((*this)[integral]);
+    interpolated_type b = widen((*this)[integral+1]);
     return Signal::crossfade(a, b, fractional);
   }
 };
@@ -200,3 +205,41 @@ public:
   bool empty() const { return (!full_ && (head_ == tail_)); };
   bool full() const { return full_; };
 };
+
+// Single-producer single-consumer queue of power-of-two size. The
+// producer and the consumer may run in different contexts (interrupt
+// and main loop) without locking; Put fails when the queue is full.
+template <class T, int SIZE>
+class SpscQueue : Nocopy {
+  static_assert((SIZE & (SIZE-1)) == 0, "Error: SIZE must be a power of two");
+  static constexpr uint32_t kMask = SIZE - 1;
+
+  T buf_[SIZE];
+  std::atomic<uint32_t> head_ {0};  // written by the producer only
+  std::atomic<uint32_t> tail_ {0};  // written by the consumer only
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+public:
+  // producer side
+  bool Put(T const& x) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == SIZE) return false;
+    buf_[head & kMask] = x;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer side
+  bool Get(T& x) {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == tail) return false;
+    x = buf_[tail & kMask];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+};
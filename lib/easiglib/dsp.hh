@@ -108,9 +108,9 @@ class MagicSine {
   f cosz_ = 1_f;
   f freq_ = 2_f * Math::pi * 0.001_f;
 public:
-  MagicSine(f freq) : freq_(2_f * Math::pi * freq) { }
+  constexpr MagicSine(f freq) : freq_(2_f * Math::pi * freq) { }
 
-  f Process() {
+  constexpr f Process() {
     sinz_ += freq_ * cosz_;
     cosz_ -= freq_ * sinz_;
     return sinz_;
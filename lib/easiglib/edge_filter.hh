@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include "buffer.hh"
+
+// Glitch filter for the edges of a digital input, timestamped by an
+// interrupt. Times are in frames of a free-running clock, compared
+// modulo 2^32. A level counts once the input has held it for
+// [glitch] frames: a shorter pulse is dropped, both of its edges.
+// The edges kept are handed over in order with the time at which
+// they occurred, so that their effect can be scheduled to the frame.
+template<int glitch, int size = 16>
+class EdgeFilter : Nocopy {
+public:
+  struct Edge {
+    uint32_t time;
+    bool level;                 // after the edge
+  };
+
+  // the level before the first edge
+  void Init(bool level) { level_ = level; }
+
+  // producer side, from the edge interrupt; an edge is dropped when
+  // the queue is full, and the level read when it is processed
+  // makes up for it
+  void Put(uint32_t time, bool level) { edges_.Put({time, level}); }
+
+  // consumer side. Handles the edges that occurred before [due],
+  // with the input at [level] at time [now]; later edges wait for a
+  // later call. Calls fn(edge) for each edge kept.
+  template<class F>
+  void Process(uint32_t now, uint32_t due, bool level, F&& fn) {
+    for (;;) {
+      if (!has_next_ && !(has_next_ = edges_.Get(next_))) break;
+      if (!before(next_.time, due)) break;
+      has_next_ = false;
+      Edge e = next_;
+      if (has_pending_) {
+        has_pending_ = false;
+        // a pulse too short, or bounces: restart from the last edge
+        if (before(e.time, pending_.time + glitch)) {
+          if (e.level != level_) { pending_ = e; has_pending_ = true; }
+          continue;
+        }
+        Keep(fn);
+      }
+      if (e.level != level_) { pending_ = e; has_pending_ = true; }
+    }
+
+    // the next edge, or the current time, tells whether the pending
+    // level held
+    if (has_pending_) {
+      uint32_t until = has_next_ ? next_.time : now;
+      if (!before(until, pending_.time + glitch)) {
+        has_pending_ = false;
+        Keep(fn);
+      }
+    }
+
+    // an edge was lost: the level changed some time before now
+    if (!has_pending_ && !has_next_ && level != level_) {
+      pending_ = {now, level};
+      has_pending_ = true;
+    }
+  }
+
+  // the same, for edges that take effect [latency] frames after they
+  // occurred, rendered in blocks of [block_size] frames: handles the
+  // edges due in the block that starts at frame [start], and calls
+  // fn(edge, at) with [at] the frame of their effect in the block.
+  // Edges handled late take effect at the start of the block.
+  template<class F>
+  void Process(uint32_t now, uint32_t start, int block_size, int latency,
+               bool level, F&& fn) {
+    Process(now, start + block_size - latency, level, [&](Edge e) {
+      int at = int32_t(e.time + latency - start);
+      fn(e, std::clamp(at, 0, block_size - 1));
+    });
+  }
+
+  bool level() const { return level_; }
+
+private:
+  SpscQueue<Edge, size> edges_;
+  Edge next_, pending_;
+  bool has_next_ = false;
+  bool has_pending_ = false;
+  bool level_ = false;
+
+  static bool before(uint32_t a, uint32_t b) { return int32_t(a - b) < 0; }
+
+  template<class F>
+  void Keep(F& fn) {
+    level_ = pending_.level;
+    fn(pending_);
+  }
+};
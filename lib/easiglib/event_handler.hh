@@ -1,40 +1,59 @@
 #pragma once
 
+#include <tuple>
 #include "buffer.hh"
 
 constexpr int kEventBufferSize = 16;
 
+// An event source has a method
+//   template<class Put> void Poll(Put const& put)
+// which calls put(e) for each new event e. Sources are listed at
+// compile time by the handler's sources() (a tuple of references), so
+// that polling them involves no virtual call nor type-erased callable.
 template<class Event>
-struct EventSource : Nocopy {
-  virtual void Poll(std::function<void(Event)> const& put) = 0;
-};
+struct EventSource : Nocopy {};
 
 template<class T, class Event>
 struct EventHandler : crtp<T, EventHandler<T, Event>> {
 
-  using EventStack = BufferReader<Event, kEventBufferSize>;
+  // the event being handled, and the one handled before it
+  struct EventStack {
+    Event events_[2];
+    Event& get(int n) { return events_[n]; }
+  };
 
+  // sink passed to the sources' Poll
+  struct Put {
+    EventHandler& handler_;
+    void operator()(Event e) const { handler_.put(e); }
+  };
+
+  // producer side: from the context that calls Poll, or before
+  // Process is first called; events are dropped when the queue is full
   void put(Event e) {
-    events_.Write(e);
-    pending_++;
+    events_.Put(e);
   }
 
   void Poll() {
-    for(auto& s : (**this).sources_)
-      s->Poll([this](Event e){ put(e); });
+    Put put {*this};
+    std::apply([&](auto&... sources) { (sources.Poll(put), ...); },
+               (**this).sources());
   }
 
+  // consumer side
   void Process() {
-    while(pending_ >= 0) {
-      (**this).Handle(EventStack(events_, pending_));
-      pending_--;
+    Event e;
+    while(events_.Get(e)) {
+      (**this).Handle(EventStack {e, previous_});
+      previous_ = e;
     }
   }
 
   struct DelayedEventSource : EventSource<Event> {
     int count_ = -1;
     Event event_;
-    void Poll(std::function<void(Event)> const& put) {
+    template<class Put>
+    void Poll(Put const& put) {
       if (count_ >= 0 && count_-- == 0) put(event_);
     }
     void trigger_after(int delay, Event e) {
@@ -43,9 +62,8 @@ struct EventHandler : crtp<T, EventHandler<T, Event>> {
     }
     void Stop() { count_ = -1; }
   };
-  
+
 private:
-  RingBuffer<Event, kEventBufferSize> events_;
-  // number of events remaining to handle - 1
-  int pending_ = -1;
+  SpscQueue<Event, kEventBufferSize> events_;
+  Event previous_ {};
 };
@@ -79,6 +79,11 @@ public:
     state_ += transfer::Process(input-state_);
     return state_;
   }
+  // when run only every [period] samples
+  T Process(T input, int period) {
+    state_ += transfer::Process(input-state_, period);
+    return state_;
+  }
 
   T last() { return state_; }
 };
@@ -104,6 +109,14 @@ struct TransferQuadratic {
     constexpr f const fact = 1_f / f(divisor);
     return x.abs() * x * fact;
   }
+  // the step of [period] samples at once: integrates dx/dt=-|x|x/divisor
+  // over the period, which never overshoots
+  static f Process(f x, int period) {
+    if (period == 1) return Process(x);
+    constexpr f const fact = 1_f / f(divisor);
+    f k = x.abs() * f(period) * fact;
+    return x * k / (1_f + k);
+  }
 };
 
 template<int divisor>
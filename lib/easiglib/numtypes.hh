@@ -152,18 +152,30 @@ constexpr Float operator "" _f(unsigned long long int f){ return Float(f); }
  * 16-bits Floating Point
  ***************/
 
+// IEEE half precision, for storage only: convert to Float to compute
 #ifdef __arm__
+using half = __fp16;
+#else
+using half = _Float16;
+#endif
 
 struct Float16 {
-  Float16(Float x) : val_(x.repr()) { };
-  Float to_float() { return Float(val_); }
+  explicit Float16() { }
+  constexpr Float16(Float x) : val_(x.repr()) { };
+  constexpr Float to_float() const { return Float(float(val_)); }
+  constexpr half repr() const { return val_; }
 private:
-  __fp16 val_;
+  half val_;
 };
 
 using f16 = Float16;
 
-#endif
+// the type a stored value is computed with
+template<class T> struct Widened { using type = T; };
+template<> struct Widened<Float16> { using type = Float; };
+
+template<class T> constexpr T widen(T x) { return x; }
+constexpr Float widen(Float16 x) { return x.to_float(); }
 
 /***************
  * Fixed-Point
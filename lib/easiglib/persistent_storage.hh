@@ -6,9 +6,12 @@
 #include <cstring>
 
 template <typename T> struct Persistent : T {
-  Persistent(T *data, T const &default_data) {
+  T const &default_data_;
+  Persistent(T *data, T const &default_data) : default_data_(default_data) {
     memcpy(data, &default_data, sizeof(T));
   }
+  void Load(T *to) { memcpy(to, &default_data_, sizeof(T)); }
+  void Load() {}
   void Save() {}
 };
 
@@ -50,20 +53,32 @@ public:
   }
 };
 
+// Starts from the default data; the stored data are only read by
+// Load(), which scans the flash and can take milliseconds: the owner
+// picks the moment, e.g. once audio runs.
 template <class Storage>
 class Persistent : Storage {
   using data_t = typename Storage::data_t;
   data_t* data_;
+  data_t const& default_data_;
 public:
-  Persistent(data_t *data, data_t const &default_data) : data_(data) {
-    // load to data_, falling back to default_data if not found
-    if (!Storage::Read(data_) ||
-        !data_->validate()) {
-      *data_ = default_data;
-      Save();
+  Persistent(data_t *data, data_t const &default_data) :
+    data_(data), default_data_(default_data) {
+    *data_ = default_data;
+  }
+
+  // load to [to], falling back to default_data (and storing them) if
+  // not found
+  void Load(data_t *to) {
+    if (!Storage::Read(to) ||
+        !to->validate()) {
+      *to = default_data_;
+      Storage::Write(to);
     }
   }
 
+  void Load() { Load(data_); }
+
   void Save() {
     Storage::Write(data_);
   }
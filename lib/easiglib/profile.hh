@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+
+// Profiling of named regions: each region keeps the count, min, max
+// and total of its durations, in ticks (CPU cycles on the target, ns on
+// the host). Compiled out unless PROFILE is defined. On the target,
+// the counters live in [profile_table] and are read from gdb with the
+// "profile" command (see gdbinit). ProfileClock itself is always
+// available.
+
+struct ProfileCounter {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+
+  void add(uint32_t t) {
+    if (count == 0 || t < min) min = t;
+    if (t > max) max = t;
+    total += t;
+    count++;
+  }
+
+  uint32_t avg() const { return count ? uint32_t(total / count) : 0; }
+};
+
+constexpr int kMaxProfileRegions = 16;
+inline ProfileCounter profile_table[kMaxProfileRegions];
+
+// Boot stages: the time at which each one ended, in ticks from the
+// start of ProfileClock. Always recorded; read from gdb with the
+// "boot" command.
+constexpr int kMaxBootStages = 16;
+inline uint32_t boot_stamps[kMaxBootStages];
+
+#ifdef TEST
+
+#include <chrono>
+
+struct ProfileClock {
+  static void Init() {}
+  static uint32_t ticks() {
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(t).count());
+  }
+  static uint32_t ticks_per_second() { return 1000000000; }
+};
+
+#else
+
+#include "stm32f7xx.h"
+
+struct ProfileClock {
+  static void Init() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;      // unlock, needed on the M7
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+  static uint32_t ticks() { return DWT->CYCCNT; }
+  static uint32_t ticks_per_second() { return SystemCoreClock; }
+};
+
+#endif
+
+inline void BootStamp(int stage) { boot_stamps[stage] = ProfileClock::ticks(); }
+
+// stamps [stage] when constructed: placed between the bases of the
+// application, times their construction
+template<int stage>
+struct BootMark {
+  BootMark() { BootStamp(stage); }
+};
+
+// usage: { ProfileScope p {REGION}; ... }
+#ifdef PROFILE
+
+class ProfileScope {
+  ProfileCounter& counter_;
+  uint32_t start_;
+public:
+  explicit ProfileScope(int region)
+    : counter_(profile_table[region]), start_(ProfileClock::ticks()) {}
+  ~ProfileScope() { counter_.add(ProfileClock::ticks() - start_); }
+};
+
+#else
+
+struct ProfileScope {
+  explicit ProfileScope(int) {}
+};
+
+#endif
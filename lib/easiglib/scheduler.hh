@@ -0,0 +1,63 @@
+#pragma once
+
+#include <climits>
+#include <algorithm>
+#include "util.hh"
+
+// Runs periodic tasks, each at its own period counted in ticks. The
+// phase of each task is chosen at construction so that tasks land on
+// the least busy ticks: the number of tasks run per tick then stays
+// as even as the periods allow. Periods are powers of two, at most
+// max_period.
+//
+// Process may advance by several ticks at once; a task due in that
+// span runs once, and is told how many ticks went by since its
+// previous run so that it can compensate for it.
+
+template<int num_tasks, int max_period>
+class StaggeredScheduler : Nocopy {
+  static_assert((max_period & (max_period - 1)) == 0,
+                "Error: max_period must be a power of two");
+
+  int period_[num_tasks];
+  int left_[num_tasks];         // ticks until the next run
+  int elapsed_[num_tasks];      // ticks since the previous run
+
+public:
+  explicit StaggeredScheduler(int const (&periods)[num_tasks]) {
+    int load[max_period] = {};
+    // shortest periods first, they have the least choice
+    for (int p=1; p<=max_period; p*=2) {
+      for (int i=0; i<num_tasks; i++) {
+        if (periods[i] != p) continue;
+        int best = 0, best_load = INT_MAX;
+        for (int phase=0; phase<p; phase++) {
+          int l = 0;
+          for (int t=phase; t<max_period; t+=p) l = std::max(l, load[t]);
+          if (l < best_load) { best = phase; best_load = l; }
+        }
+        for (int t=best; t<max_period; t+=p) load[t]++;
+        period_[i] = p;
+        left_[i] = best + 1;
+        elapsed_[i] = p - left_[i];
+      }
+    }
+  }
+
+  int period(int task) { return period_[task]; }
+
+  // advances by [ticks] and calls fn(task, elapsed ticks) for every
+  // task due, in task order
+  template<class F>
+  void Process(int ticks, F&& fn) {
+    for (int i=0; i<num_tasks; i++) {
+      elapsed_[i] += ticks;
+      left_[i] -= ticks;
+      if (left_[i] > 0) continue;
+      left_[i] = period_[i] + left_[i] % period_[i];
+      int elapsed = elapsed_[i];
+      elapsed_[i] = 0;
+      fn(i, elapsed);
+    }
+  }
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "util.hh"
+
+// Lock-free single-writer/single-reader snapshot of a value (triple
+// buffer). The writer fills a private back buffer and publishes it by
+// swapping it with the shared middle slot; the reader swaps the middle
+// slot with its private front buffer when something new was
+// published. Neither side ever waits, and the reader always sees a
+// value that was published whole, whatever the relative priorities of
+// the two contexts.
+
+template<class T>
+class Snapshot : Nocopy {
+  static constexpr uint8_t kFresh = 4;
+
+  T buffers_[3];
+  uint8_t back_ = 0;                        // owned by the writer
+  std::atomic<uint8_t> middle_ {1};         // index | kFresh
+  uint8_t front_ = 2;                       // owned by the reader
+
+  static_assert(std::atomic<uint8_t>::is_always_lock_free);
+
+public:
+  Snapshot() = default;
+  explicit Snapshot(T const& x) { buffers_[0] = buffers_[1] = buffers_[2] = x; }
+
+  // writer side
+  void Write(T const& x) {
+    buffers_[back_] = x;
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & ~kFresh;
+  }
+
+  // reader side: latest published value, stable until the next Read
+  T const& Read() {
+    if (middle_.load(std::memory_order_relaxed) & kFresh)
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & ~kFresh;
+    return buffers_[front_];
+  }
+};
@@ -3,6 +3,8 @@
 #include "adc.hh"
 #include "spi_adc.hh"
 #include "dsp.hh"
+#include "ext_cv_conditioner.hh"
+#include "scheduler.hh"
 #include "event_handler.hh"
 #include "persistent_storage.hh"
 #include "qspi_flash.hh"
@@ -15,131 +17,9 @@ const f kRootPotRange = 9_f * 12_f;
 const f kNewNoteRange = 6_f * 12_f;
 const f kFineTuneRange = 4_f;
 const f kSpreadRange = 12_f;
-const f kCalibration2Volts = 2_f;
-const f kCalibration4Volts = 4_f;
-const f kCalibrationSuccessTolerance = 0.3_f;
-const f kCalibrationSuccessToleranceOffset = 0.1_f;
 const f kPotMoveThreshold = 0.01_f;
 
 const int kIntCVCalibrationIterations = 16;
-const int kExtCVCalibrationIterations = 1024;
-
-enum CalibrationStepResult {
-  CAL_STEP_RESULT_NOT_BEGUN,
-  CAL_STEP_RESULT_IN_PROGRESS,
-  CAL_STEP_RESULT_SUCCESS,
-  CAL_STEP_RESULT_FAILURE,
-};
-
-enum CalibrationStep {
-  CALIBRATE_UNPATCHED,
-  CALIBRATE_C2,
-  CALIBRATE_C4
-};
-
-template<int CHAN, class FILTER>
-class ExtCVConditioner {
-  SpiAdc& spi_adc_;
-  f& offset_;
-  f nominal_offset_;
-  f& slope_;
-  f nominal_slope_;
-  FILTER lp_;
-
-  f reading_at_C2;
-  f reading_unpatched;
-  int cal_i_;
-  bool is_calibrating_=false;
-  f cal_running_total_;
-
-  CalibrationStep cal_step_;
-
-  f last_raw_reading_;
-
-public:
-  ExtCVConditioner(f& o, f& s, SpiAdc& spi_adc) :
-    offset_(o), nominal_offset_(o),
-    slope_(s), nominal_slope_(s),
-    spi_adc_(spi_adc) {}
-
-  void reset_calibration() {
-    is_calibrating_ = false;
-    cal_step_ = CALIBRATE_UNPATCHED;
-  }
-
-  void start_calibration(CalibrationStep step) {
-    cal_i_ = 0;
-    cal_step_ = step;
-    cal_running_total_ = 0_f;
-    is_calibrating_ = true;
-  }
-  auto process_calibration() {
-    CalibrationStepResult res;
-
-    cal_running_total_ += last_raw_reading_;
-
-    if (++cal_i_ >= kExtCVCalibrationIterations) {
-      is_calibrating_ = false;
-      cal_running_total_ /= f(kExtCVCalibrationIterations);
-
-      switch (cal_step_) {
-
-        case (CALIBRATE_UNPATCHED): {
-          reading_unpatched = cal_running_total_;
-          if ((reading_unpatched - nominal_offset_).abs() < kCalibrationSuccessToleranceOffset) {
-            res = CAL_STEP_RESULT_SUCCESS;
-           } else
-            res = CAL_STEP_RESULT_FAILURE;
-        } break;
-
-        case (CALIBRATE_C2): {
-          reading_at_C2 = cal_running_total_;
-          f octave = (reading_at_C2 - reading_unpatched) / kCalibration2Volts;
-          f slope = 12_f / octave;
-
-          if ((slope / nominal_slope_ - 1_f).abs() < kCalibrationSuccessTolerance)
-            res = CAL_STEP_RESULT_SUCCESS;
-          else
-            res = CAL_STEP_RESULT_FAILURE;
-        } break;
-
-        case (CALIBRATE_C4): {
-          f octave = (cal_running_total_ - reading_at_C2) / kCalibration2Volts;
-          f slope = 12_f / octave;
-
-          if ((slope / nominal_slope_ - 1_f).abs() < kCalibrationSuccessTolerance) {
-            slope_ = slope;
-            offset_ = reading_at_C2 - (kCalibration2Volts * 12_f / slope_);
-            res = CAL_STEP_RESULT_SUCCESS;
-          } else
-            res = CAL_STEP_RESULT_FAILURE;
-        } break;
-
-      }
-    }
-    else res = CAL_STEP_RESULT_IN_PROGRESS;
-
-    return res;
-  }
-
-  bool calibration_busy() {
-    return is_calibrating_;
-  }
-
-  void Process() {
-    u0_16 x = spi_adc_.get(CHAN);
-    lp_.Process(x);
-  }
-
-  void switch_channel() {
-    spi_adc_.switch_channel();
-  }
-
-  f last() {
-    last_raw_reading_ = f::inclusive(lp_.last());
-    return (last_raw_reading_ - offset_) * slope_;
-  }
-};
 
 template<AdcInput INPUT>
 class CVConditioner {
@@ -204,7 +84,9 @@ public:
   
   f raw() { return f::inclusive(adc_.get(INPUT)); }
 
-  f Process(std::function<void(Event)> const& put) {
+  // [period]: ticks of kBlockSize samples since the last call
+  template<class Put>
+  f Process(Put const& put, int period) {
     f x = f::inclusive(adc_.get(INPUT));
     x = Signal::crop(kPotDeadZone, x);
     switch(LAW) {
@@ -213,7 +95,7 @@ public:
     case Law::CUBIC: x = x * x * x; break;
     case Law::QUARTIC: x = x * x; x = x * x; break;
     }
-    x = filter_.Process(x);
+    x = filter_.Process(x, period);
     if (MovementDetector::Process(x))
       put({PotMove, INPUT});
     return x;                   // 0..1
@@ -234,11 +116,15 @@ public:
   DualFunctionPotConditioner(Adc& adc) : PotConditioner<INPUT, LAW, FILTER>(adc) {}
   DualFunctionPotConditioner(Adc& adc, SavedDualPotState saved_state) : PotConditioner<INPUT, LAW, FILTER>(adc)
   {
+    restore(saved_state);
+  }
+
+  void restore(SavedDualPotState saved_state) {
     if (saved_state.validate()) {
       main_value_ = saved_state.restore_main_val;
       alt_value_ = saved_state.restore_alt_val;
-      if (saved_state.restore_catchup_mode == SavedDualPotState::CatchUpMode)
-        state_ = ARMING;
+      state_ = saved_state.restore_catchup_mode == SavedDualPotState::CatchUpMode
+        ? ARMING : MAIN;
     }
   }
 
@@ -256,8 +142,9 @@ public:
                .restore_alt_val = alt_value_};
   }
 
-  std::pair<f, f> Process(std::function<void(Event)> const& put) {
-    f input = PotConditioner<INPUT, LAW, FILTER>::Process(put);
+  template<class Put>
+  std::pair<f, f> Process(Put const& put, int period) {
+    f input = PotConditioner<INPUT, LAW, FILTER>::Process(put, period);
     switch(state_) {
     case MAIN: {
       main_value_ = input;
@@ -302,20 +189,22 @@ public:
   PotCVCombiner(Adc& adc, f& cv_offset) : pot_(adc), cv_(adc, cv_offset) {}
 
   // TODO disable this function if PotConditioner = DualFunction
-  f Process(std::function<void(Event)> const& put) {
-    f x = pot_.Process(put);
+  template<class Put>
+  f Process(Put const& put, int period) {
+    f x = pot_.Process(put, period);
     x -= cv_.Process();
     x = x.clip(0_f, 1_f);
-    return filter_.Process(x);
+    return filter_.Process(x, period);
   }
 
-  std::pair<f, f> ProcessDualFunction(std::function<void(Event)> const& put) {
-    auto [main, alt] = pot_.Process(put);
+  template<class Put>
+  std::pair<f, f> ProcessDualFunction(Put const& put, int period) {
+    auto [main, alt] = pot_.Process(put, period);
 
     // sum main pot function and its associated CV
     main -= cv_.Process();
     main = main.clip(0_f, 1_f);
-    main = filter_.Process(main);
+    main = filter_.Process(main, period);
 
     return std::pair(main, alt);
   }
@@ -325,10 +214,10 @@ public:
 
 struct NoFilter {
   f Process(f x) { return x; }
+  f Process(f x, int period) { return x; }
 };
 
 
-template<int block_size>
 class Control : public EventSource<Event> {
 
   Adc adc_;
@@ -378,6 +267,7 @@ class Control : public EventSource<Event> {
 
   Persistent<WearLevel<FlashBlock<0, CalibrationData>>>
   calibration_data_storage_ {&calibration_data_, default_calibration_data_};
+  CalibrationData stored_calibration_data_;
 
   PotCVCombiner<PotConditioner<POT_DETUNE, Law::LINEAR, NoFilter>,
                 NoCVInput, QuadraticOnePoleLp<1>
@@ -411,11 +301,11 @@ class Control : public EventSource<Event> {
   DualFunctionPotConditioner<POT_ROOT, Law::LINEAR,
                              QuadraticOnePoleLp<2>, Takeover::SOFT
                              > root_pot_ {adc_};
-  ExtCVConditioner<CV_PITCH, Average<4, 4>
+  ExtCVConditioner<CV_PITCH, Average<4, 4>, Average<3, 2>, SpiAdc
                    > pitch_cv_ {calibration_data_.pitch_offset,
                                 calibration_data_.pitch_slope, 
                                 spi_adc_};
-  ExtCVConditioner<CV_ROOT, Average<4, 2>
+  ExtCVConditioner<CV_ROOT, Average<4, 2>, Average<3, 1>, SpiAdc
                    > root_cv_ {calibration_data_.root_offset,
                                calibration_data_.root_slope, 
                                spi_adc_};
@@ -423,55 +313,109 @@ class Control : public EventSource<Event> {
   HysteresisFilter<1, 10> root_post_filter_;
 
   Parameters& params_;
-  PolypticOscillator<block_size>& osc_;
+  PolypticOscillator& osc_;
 
   Sampler<f> pitch_cv_sampler_;
 
   uint8_t ext_cv_chan;
+  bool fast_cv_ = false;
+
+  // Each conditioner runs at its own period, in ticks of kBlockSize
+  // samples (6kHz): pitch and root track their CV every tick, the
+  // other timbre CVs every other tick, and the controls that only
+  // pick a setting (detune, scale) at 750Hz. The scheduler staggers
+  // them so that every tick does about the same work.
+  enum Task {
+    DETUNE, BALANCE, TWIST, WARP, MODULATION, SPREAD, SCALE, PITCH, ROOT,
+    kNumTasks
+  };
+  static constexpr int kMaxTaskPeriod = 8;
+  static constexpr int kTaskPeriods[kNumTasks] = {
+    8, 2, 2, 2, 2, 2, 8, 1, 1,
+  };
+  StaggeredScheduler<kNumTasks, kMaxTaskPeriod> scheduler_ {kTaskPeriods};
+  int ticks_ = 1;               // per Poll
 public:
 
-  Control(Parameters& params, PolypticOscillator<block_size>& osc) :
+  Control(Parameters& params, PolypticOscillator& osc) :
     osc_(osc),
     params_(params),
     pitch_pot_(adc_, params.alt.pitch_pot_state) {}
 
+  // Poll runs once per audio block of [block_size] samples
+  void set_block_size(int block_size) { ticks_ = block_size / kBlockSize; }
+
+  // the stored calibration is read into a copy, in the background;
+  // swapped in from the control context, with the pitch pot state of
+  // the stored alternate parameters
+  void LoadStored() { calibration_data_storage_.Load(&stored_calibration_data_); }
+  void ApplyStored() {
+    calibration_data_ = stored_calibration_data_;
+    pitch_pot_.restore(params_.alt.pitch_pot_state);
+  }
+
+  // low-latency CV mode: the pitch and root CV go through shorter
+  // filters, run every block
+  void set_fast_cv(bool fast) {
+    fast_cv_ = fast;
+    pitch_cv_.set_fast(fast);
+    root_cv_.set_fast(fast);
+  }
+
+  // otherwise the filters of each channel run every other block, like
+  // when the channels were read in turns
   void ProcessSpiAdcInput() {
-    if (ext_cv_chan) {
+    spi_adc_.Process();
+    if (fast_cv_) {
+      pitch_cv_.Process();
+      root_cv_.Process();
+    } else if (ext_cv_chan) {
       pitch_cv_.Process();
-      pitch_cv_.switch_channel();
     } else {
       root_cv_.Process();
-      root_cv_.switch_channel();
     }
     ext_cv_chan = !ext_cv_chan;
   }
 
-  void Poll(std::function<void(Event)> const& put) {
+  template<class Put>
+  void Poll(Put const& put) {
+    ProfileScope profile {PROFILE_CONTROL_POLL};
 
-    // Process gates
-    gates_.Debounce();
+    // Process gates: each edge toggles Freeze at its frame in the
+    // next block, or in sync mode each rising edge resets the phases
+    uint32_t now = AudioClock::now();
+    uint32_t start = AudioClock::next_block();
+    int block_size = ticks_ * kBlockSize;
 
-    if (gates_.freeze_.just_enabled()) {
-      osc_.set_freeze(!osc_.frozen());
-    } else if (gates_.freeze_.just_disabled()) {
-      osc_.set_freeze(!osc_.frozen());
-    }
+    gates_.freeze_.Process(now, start, block_size, [&](Gates::Edge e, int at) {
+      if (osc_.sync_mode() == SYNC_OFF) osc_.set_freeze(!osc_.frozen(), at);
+      else if (!e.level) osc_.sync(at);
+    });
 
-    if (gates_.learn_.just_enabled() && osc_.learn_mode()) {
-      put({NewNoteAfterDelay, 0});
-    }
+    gates_.learn_.Process(now, start, block_size, [&](Gates::Edge e, int) {
+      if (!e.level && osc_.learn_mode()) put({NewNoteAfterDelay, 0});
+    });
 
     // Process potentiometer & CV
+    scheduler_.Process(ticks_, [&](int task, int period) {
+      Process(Task(task), period, put);
+    });
+  }
 
-    // DETUNE
-    { f detune = detune_.Process(put);
+private:
+  // [period]: ticks of kBlockSize samples since the task last ran
+  template<class Put>
+  void Process(Task task, int period, Put const& put) {
+    switch(task) {
+    case DETUNE: {
+      f detune = detune_.Process(put, period);
       detune = (detune * detune) * (detune * detune);
       detune *= 10_f / f(kMaxNumOsc);
       params_.detune = detune;
-    }
+    } break;
 
-    // BALANCE
-    { auto [balance, crossfade] = balance_.ProcessDualFunction(put);
+    case BALANCE: {
+      auto [balance, crossfade] = balance_.ProcessDualFunction(put, period);
 
       balance = balance * 2_f - 1_f; // -1..1
       balance *= balance * balance;     // -1..1 cubic
@@ -485,10 +429,10 @@ public:
         crossfade *= 0.5_f; // 0..0.5
         params_.alt.crossfade_factor = crossfade; // 0..0.5
       }
-    }
+    } break;
 
-    // TWIST
-    { auto [twist, freeze_mode] = twist_.ProcessDualFunction(put);
+    case TWIST: {
+      auto [twist, freeze_mode] = twist_.ProcessDualFunction(put, period);
 
       // avoids CV noise to produce harmonics near 0
       twist = Signal::crop_down(0.01_f, twist);
@@ -511,10 +455,10 @@ public:
         if (m != params_.alt.freeze_mode) put({AltParamChange, m});
         params_.alt.freeze_mode = m;
       }
-    }
+    } break;
 
-    // WARP
-    { auto [warp, stereo_mode] = warp_.ProcessDualFunction(put);
+    case WARP: {
+      auto [warp, stereo_mode] = warp_.ProcessDualFunction(put, period);
 
       // avoids CV noise to produce harmonics near 0
       warp = Signal::crop_down(0.01_f, warp);
@@ -536,10 +480,10 @@ public:
         if (m != params_.alt.stereo_mode) put({AltParamChange, m});
         params_.alt.stereo_mode = m;
       }
-    }
+    } break;
 
-    // MODULATION
-    { f mod = modulation_.Process(put);
+    case MODULATION: {
+      f mod = modulation_.Process(put, period);
       // avoids CV noise to produce harmonics near 0
       mod = Signal::crop_down(0.01_f, mod);
       mod *= 6_f / f(params_.alt.numOsc);
@@ -551,10 +495,10 @@ public:
         mod *= 4.0_f;
       }
       params_.modulation.value = mod;
-    }
+    } break;
 
-    // SPREAD
-    { auto [spread, numOsc] = spread_.ProcessDualFunction(put);
+    case SPREAD: {
+      auto [spread, numOsc] = spread_.ProcessDualFunction(put, period);
 
       spread *= 10_f / f(kMaxNumOsc);
       params_.spread = spread * kSpreadRange;
@@ -566,19 +510,19 @@ public:
         if (n != params_.alt.numOsc) put({AltParamChange, n});
         params_.alt.numOsc = n;
       }
-    }
+    } break;
 
-    // SCALE
-    { f scale = scale_.Process(put);
+    case SCALE: {
+      f scale = scale_.Process(put, period);
       scale *= 9_f;                           // [0..9]
       scale += 0.5_f;                         // [0.5..9.5]
       int g = scale.floor();
       if (g != params_.scale.value) put({ScaleChange, g});
       params_.scale.value = g; // [0..9]
-    }
+    } break;
 
-    // PITCH
-    { auto [pitch, fine_tune] = pitch_pot_.Process(put);
+    case PITCH: {
+      auto [pitch, fine_tune] = pitch_pot_.Process(put, period);
       pitch *= kPitchPotRange;                               // 0..range
       pitch -= kPitchPotRange * 0.5_f;                       // -range/2..range/2
       f pitch_cv = pitch_cv_.last();
@@ -597,10 +541,10 @@ public:
         fine_tune > 0_f ? (fine_tune - 0.5_f) * kFineTuneRange : 0_f;
 
       params_.pitch = pitch + params_.fine_tune;
-    }
+    } break;
 
-    // ROOT
-    { auto [root, new_note] = root_pot_.Process(put);
+    case ROOT: {
+      auto [root, new_note] = root_pot_.Process(put, period);
       root *= kRootPotRange;
       root += root_post_filter_.Process(root_cv_.last());
 
@@ -622,9 +566,13 @@ public:
         new_note += root_cv_.last();
         params_.new_note = new_note.max(0_f);
       }
+    } break;
+
+    case kNumTasks: break;
     }
   }
 
+public:
   f pitch_cv() { return pitch_cv_.last(); }
   void hold_pitch_cv() { pitch_cv_sampler_.hold(); }
   void release_pitch_cv() { pitch_cv_sampler_.release(); }
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include "dsp.hh"
 #include "dynamic_data.hh"
 #include "bitfield.hh"
 
+// level of the band-limited shapers, and how far to crossfade to the
+// next one (see Antialias::band)
+struct Band {
+  int level;
+  f mix;
+};
+
 namespace Distortion {
 
-  template<WarpMode> inline f warp(s1_15, f);
+  template<WarpMode> inline f warp(s1_15, f, int);
   template<TwistMode> inline u0_32 twist(u0_32, f);
 
   template<>
@@ -30,38 +38,65 @@ namespace Distortion {
     return u0_32::of_repr(x.repr());
   }
 
+  // [level]: of the band-limited shapers (see Antialias::band)
   template<>
-  inline f warp<FOLD>(s1_15 x, f amount) {
+  inline f warp<FOLD>(s1_15 x, f amount, int level) {
     if (amount <= 0.005_f)
       return(f::inclusive(x));
     s1_31 sample = x * s1_15(amount);
     u0_32 phase = sample.to_unsigned_scale();
-    f res = DynamicData::fold.interpolateDiff<f>(phase);
+    using T = Widened<FoldValue>::type;
+    f res = level < kBandLevels
+      ? tables::loaded(DynamicData::fold_bands[level].interpolateDiff<s1_15>(phase))
+      : tables::loaded(DynamicData::fold.interpolateDiff<T>(phase));
     res *= DynamicData::fold_max.interpolate(amount);
     return res;
   }
 
+  // band-limited by its amount instead (see Antialias::warp)
   template<>
-  inline f warp<CHEBY>(s1_15 x, f amount) {
+  inline f warp<CHEBY>(s1_15 x, f amount, int) {
     constexpr f const fact = f(DynamicData::cheby.size() - 2);
     amount *= fact;
     auto [idx, frac] = amount.integral_fractional();
     u0_32 phase = u0_32(x.to_unsigned_scale());
-    f s1 = DynamicData::cheby[idx].interpolate(phase);
-    f s2 = DynamicData::cheby[idx+1].interpolate(phase);
+    f s1 = tables::loaded(DynamicData::cheby[idx].interpolate(phase));
+    f s2 = tables::loaded(DynamicData::cheby[idx+1].interpolate(phase));
     return Signal::crossfade(s1, s2, frac);
   }
 
-  template<>
-  inline f warp<SEGMENT>(s1_15 x, f amount) {
-    constexpr f const fact = f(DynamicData::triangles.size() - 1);
+  template<class T, int N>
+  inline f segment(Buffer<T, N> const& triangles, u0_32 phase, f amount) {
+    constexpr f const fact = f(N - 1);
     amount *= fact;
     auto [idx, frac] = amount.integral_fractional();
-    u0_32 phase = u0_32(x.to_unsigned_scale());
-    f s1 = DynamicData::triangles[idx].interpolate(phase);
-    f s2 = DynamicData::triangles[idx+1].interpolate(phase);
+    f s1 = tables::loaded(triangles[idx].interpolate(phase));
+    f s2 = tables::loaded(triangles[idx+1].interpolate(phase));
     return Signal::crossfade(s1, s2, frac);
   }
+
+  template<>
+  inline f warp<SEGMENT>(s1_15 x, f amount, int level) {
+    if (level >= kBandLevels)
+      return segment(DynamicData::triangles, u0_32(x.to_unsigned_scale()), amount);
+    // the bands store 0..1 of the odd shapes, scaled down: -1 reads
+    // as -1 + 2^-15
+    int32_t r = x.repr();
+    uint32_t a = r < 0 ? std::min(-r, 0x7fff) : r;
+    f scale = r < 0 ? -band_segment_scale : band_segment_scale;
+    return scale * segment(DynamicData::segment_bands[level],
+                           u0_32::of_repr(a << 17), amount);
+  }
+
+  // [mode] at the level of [band], crossfaded to the next level during
+  // a glide
+  template<WarpMode mode>
+  inline f at_band(s1_15 x, f amount, Band band) {
+    f res = warp<mode>(x, amount, band.level);
+    if (band.mix > 0_f)
+      res = Signal::crossfade(res, warp<mode>(x, amount, band.level + 1), band.mix);
+    return res;
+  }
 };
 
 namespace Antialias {
@@ -76,7 +111,7 @@ namespace Antialias {
   }
 
   template<TwistMode> f twist(f freq, f amount);
-  template<WarpMode> f warp(f freq, f amount);
+  template<WarpMode> f warp(Band band, f amount);
 
   template<> f twist<FEEDBACK>(f freq, f amount) {
     return amount * (1_f - 2_f * freq).max(0_f).square();
@@ -90,15 +125,34 @@ namespace Antialias {
     return amount; // no antialiasing here
   }
 
-  template<> f warp<FOLD>(f freq, f amount) {
-    return (amount * (1_f - 8_f * freq).max(0_f).square().square()).max(0.004_f);
+  // level of the band-limited waveshapers that makes no harmonic
+  // above Nyquist: 1 << level harmonics of a sine of [freq] fit below
+  // it, over the octave of [freq]. Over the top sixteenth of the octave
+  // (by its mantissa), the band glides down to the level of the octave
+  // above, so that it moves with [freq] without a step; voices then
+  // crossfade the two levels. kBandLevels (the full shapers) for the
+  // lowest octaves, and until the levels are computed
+  inline Band band(u0_32 freq) {
+    if (!DynamicData::bands_ready.load(std::memory_order_acquire))
+      return {kBandLevels, 0_f};
+    uint32_t r = freq.repr() | 1;
+    int clz = __builtin_clz(r);
+    int level = clz - 1;
+    if (level > kBandLevels) return {kBandLevels, 0_f};
+    if (level <= 0) return {0, 0_f};
+    f glide = 16_f * f(u0_32::of_repr(r << (clz + 1))) - 15_f;
+    return glide > 0_f ? Band{level - 1, 1_f - glide} : Band{level, 0_f};
   }
 
-  template<> f warp<CHEBY>(f freq, f amount) {
-    return amount * (1_f - 6_f * freq).max(0_f);
+  // cheby[n] makes harmonic n + 1 at most: keep them all below the
+  // 1 << level harmonics of the band, interpolated between levels
+  template<> f warp<CHEBY>(Band band, f amount) {
+    if (band.level >= kBandLevels) return amount;
+    f const max = (f(1 << band.level) * (1_f + band.mix) - 1_f)
+      / f(DynamicData::cheby.size() - 2);
+    return amount.min(max);
   }
 
-  template<> f warp<SEGMENT>(f freq, f amount) {
-    return amount * (1_f - 4_f * freq).cube().max(0_f);
-  }
+  template<> f warp<FOLD>(Band band, f amount) { return amount; }
+  template<> f warp<SEGMENT>(Band band, f amount) { return amount; }
 };
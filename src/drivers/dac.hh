@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include "buffer.hh"
 #include "parameters.hh"
 #include "hal.hh"
+#include "dac_monitor.hh"
 
 //
 // Dac SAI pins
@@ -112,7 +115,55 @@ static void delay() {
 
 void register_dac_isr(void f());
 
-template<int sample_rate, int block_size, class T>
+// Frames played since power-on, to timestamp events to the frame.
+// The DAC interrupt advances it by a block at each half of the DMA
+// buffer; in between, the DMA counter tells how far into the buffer
+// the output is. Wraps after about a day: compare times modulo 2^32.
+struct AudioClock {
+  static uint32_t now() {
+    uint32_t n = 2 * block_size_;
+    uint32_t playing, position;
+    do {                        // in case the DAC interrupt comes in
+      playing = playing_;
+      position = n - DACSAI_SAI_TX_DMA_STREAM->NDTR / 2;
+    } while (playing != playing_);
+    // if the interrupt is pending, the output is already into the
+    // next block: the difference then goes beyond a block
+    return playing + (position + n - playing % n) % n;
+  }
+
+  // first frame of the block that the next DAC interrupt renders
+  static uint32_t next_block() { return rendered_ + block_size_; }
+
+  static int block_size() { return block_size_; }
+
+private:
+  template<int, class> friend struct Dac;
+
+  // first frame of the block being played, of the last one rendered
+  static inline volatile uint32_t playing_ = 0;
+  static inline volatile uint32_t rendered_ = 0;
+  static inline int block_size_ = kBlockSize;
+
+  // at each DAC interrupt, when the output starts playing a block
+  // and the one it just finished is rendered
+  static void Advance() {
+    playing_ = playing_ + block_size_;
+    rendered_ = playing_ + block_size_;
+  }
+
+  // the DMA restarts from the beginning of the buffer
+  static void Restart(int block_size) {
+    uint32_t n = 2 * block_size;
+    playing_ = (playing_ / n + 1) * n;
+    block_size_ = block_size;
+  }
+};
+
+// The block size is chosen at run time among kBlockSizes: the DMA
+// buffer is sized for the largest, and each callback reaches the
+// instantiation of T::DacCallback compiled for the current size.
+template<int sample_rate, class T>
 struct Dac : Nocopy {
 
   Dac() {
@@ -131,25 +182,44 @@ struct Dac : Nocopy {
     bb_regsetup_.Init();
   }
 
-  void Start() {
+  // starts the audio callbacks, with blocks of [block_size] frames
+  // (one of kBlockSizes). Can be called again to switch block size,
+  // from outside of the callback: the DMA is then stopped and
+  // restarted on silence, which makes an audible gap.
+  void Start(int block_size) {
+    HAL_NVIC_DisableIRQ(DACSAI_SAI_TX_DMA_IRQn);
+    if (block_size != block_size_ && valid_block_size(block_size)) {
+      HAL_SAI_DMAStop(&hsai_tx);
+      block_size_ = block_size;
+      std::fill(std::begin(tx_), std::end(tx_), zero);
+      HAL_SAI_Transmit_DMA(&hsai_tx, reinterpret_cast<uint8_t*>(tx_), block_size_ * 2 * 2);
+      HAL_NVIC_ClearPendingIRQ(DACSAI_SAI_TX_DMA_IRQn);
+      AudioClock::Restart(block_size_);
+    }
+    monitor_.set_block_size(block_size_);
     HAL_NVIC_EnableIRQ(DACSAI_SAI_TX_DMA_IRQn);
   }
 
+  int block_size() const { return block_size_; }
+
+  // late callbacks since Start
+  DacMonitor::Stats const& overrun_stats() const {
+    return monitor_.stats();
+  }
+  void reset_overrun_stats() { monitor_.reset(); }
+
 private:
 
+  int block_size_ = kBlockSize;
+  DacMonitor monitor_ {kBlockSize};
+
   DMA_HandleTypeDef hdma_tx;
 
   SAI_HandleTypeDef hsai_tx;
 
-  union {
-    // TODO cleanup: no struct necessary
-    struct {
-      Buffer<Frame, block_size> tx[2];
-    } buffers;
-    struct {
-      uint8_t tx[block_size * sizeof(Frame)][2];
-    } arrays;
-  };
+  // both halves of the double buffer, back to back; only the first
+  // 2 * block_size_ frames are used
+  Frame tx_[2 * kMaxBlockSize];
 
   static Dac *instance_;
 
@@ -166,17 +236,28 @@ private:
       // Transfer Complete (TC) -> Point to 2nd half of buffers
       __HAL_DMA_CLEAR_FLAG(&instance_->hdma_tx,
                            __HAL_DMA_GET_TC_FLAG_INDEX(&instance_->hdma_tx));
-      static_cast<T&>(*this).template DacCallback<block_size>(instance_->buffers.tx[1]);
+      Callback(1);
+      monitor_.Check(1, __HAL_DMA_GET_COUNTER(&instance_->hdma_tx));
 
     } else if ((tmpisr & __HAL_DMA_GET_HT_FLAG_INDEX(&instance_->hdma_tx))
                && __HAL_DMA_GET_IT_SOURCE(&instance_->hdma_tx, DMA_IT_HT)) {
       // Half Transfer complete (HT) -> Point to 1st half of buffers
       __HAL_DMA_CLEAR_FLAG(&instance_->hdma_tx,
                            __HAL_DMA_GET_HT_FLAG_INDEX(&instance_->hdma_tx));
-      static_cast<T&>(*this).template DacCallback<block_size>(instance_->buffers.tx[0]);
+      Callback(0);
+      monitor_.Check(0, __HAL_DMA_GET_COUNTER(&instance_->hdma_tx));
     }
   }
 
+  // fills [half] of the buffer
+  void Callback(int half) {
+    AudioClock::Advance();
+    with_block_size(block_size_, [&](auto size) {
+      constexpr int n = decltype(size)::value;
+      static_cast<T&>(*this).template DacCallback<n>(tx_ + half * n);
+    });
+  }
+
   struct GPIO {
     // TODO init with constructor
     void __attribute__((optimize("Os"))) Init() {
@@ -292,7 +373,7 @@ private:
 
     bb_regsetup_.Init(sample_rate);
 
-    Start();
+    Start(block_size_);
   }
 
   void  __attribute__((optimize("Os"))) init_SAI_clock() {
@@ -410,10 +491,10 @@ private:
     // DMA IRQ and start DMA
     HAL_NVIC_SetPriority(DACSAI_SAI_TX_DMA_IRQn, 0, 0);
     HAL_NVIC_DisableIRQ(DACSAI_SAI_TX_DMA_IRQn); 
-    HAL_SAI_Transmit_DMA(&hsai_tx, arrays.tx[0], block_size * 2 * 2);
+    HAL_SAI_Transmit_DMA(&hsai_tx, reinterpret_cast<uint8_t*>(tx_), block_size_ * 2 * 2);
   }
 
 };
 
-template<int sample_rate, int block_size, class T>
-Dac<sample_rate, block_size, T> *Dac<sample_rate, block_size, T>::instance_;
+template<int sample_rate, class T>
+Dac<sample_rate, T> *Dac<sample_rate, T>::instance_;
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+// Detects late audio callbacks on the circular DMA double buffer. The
+// DMA stream counts down (NDTR) the items left before it wraps around;
+// read at callback exit, it tells whether the DMA has already come back
+// into the half the callback was writing. No HAL dependency, so that it
+// can be tested on the host.
+//
+// Lateness is only measured modulo half a buffer: a callback late by
+// more than that looks on time.
+
+class DacMonitor {
+  // DMA items (32-bit words) per frame
+  static constexpr uint32_t kItemsPerFrame = 2;
+
+public:
+  struct Stats {
+    uint32_t blocks;
+    uint32_t overruns;
+    uint32_t max_lateness;      // frames
+  };
+
+private:
+  Stats stats_ {};
+  // DMA items per half buffer
+  uint32_t half_;
+
+public:
+  explicit DacMonitor(int block_size) { set_block_size(block_size); }
+
+  // also resets the counters
+  void set_block_size(int block_size) {
+    half_ = block_size * kItemsPerFrame;
+    reset();
+  }
+
+  // [half]: the half just written (0 or 1); [ndtr]: DMA counter read
+  // right after writing it
+  void Check(int half, uint32_t ndtr) {
+    stats_.blocks++;
+    uint32_t pos = 2 * half_ - ndtr;           // items sent this cycle
+    // the DMA must not have entered [half] yet
+    bool late = half == 0 ? pos < half_ : pos >= half_;
+    if (late) {
+      uint32_t lateness = (half == 0 ? pos : pos - half_) / kItemsPerFrame;
+      stats_.overruns++;
+      if (lateness > stats_.max_lateness) stats_.max_lateness = lateness;
+    }
+  }
+
+  Stats const& stats() const { return stats_; }
+  void reset() { stats_ = {}; }
+};
@@ -0,0 +1,10 @@
+#include "gates.hh"
+
+Gates *Gates::instance_;
+
+void (*gates_isr)();
+void register_gates_isr(void f()) { gates_isr = f; }
+
+extern "C" void EXTI9_5_IRQHandler() {
+  gates_isr();
+}
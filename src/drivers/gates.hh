@@ -1,5 +1,7 @@
 #pragma once
 #include "hal.hh"
+#include "dac.hh"
+#include "edge_filter.hh"
 
 enum Gate {
   GATE_LEARN,
@@ -14,46 +16,91 @@ enum Gate {
 #define LEARN_JACK_GPIO_Port GPIOB
 #define LEARN_JACK_RCC_CLK_ON __HAL_RCC_GPIOB_CLK_ENABLE
 
+// both jacks share EXTI lines 9..5
+#define GATES_EXTI_IRQn EXTI9_5_IRQn
 
+void register_gates_isr(void f());
+
+// The gate jacks interrupt on both edges; the interrupt timestamps
+// each edge with the AudioClock, and the control context filters the
+// glitches out and handles the edges a fixed latency after they
+// occurred, to the frame.
 struct Gates : Nocopy {
 
+  // pulses shorter than this are glitches
+  static constexpr int kGlitchFrames = 8;
+  using Filter = EdgeFilter<kGlitchFrames>;
+  using Edge = Filter::Edge;
+
+  // frames between an edge and its effect. The control context runs
+  // as a block starts playing, and handles the edges due in the block
+  // rendered next, which plays two blocks later: by then, they must
+  // have been kept, kGlitchFrames after they occurred.
+  static int latency(int block_size) { return 3 * block_size + kGlitchFrames; }
+
   template<class T>
-  struct Debouncer : crtp<T, Debouncer<T>> {
-    uint8_t state_;
-    void Debounce() { state_ = (state_ << 1) | (**this).get(); }
-    bool just_disabled() const { return state_ == 0b01111111; }
-    bool just_enabled() const { return state_ == 0b10000000; }
-    bool enabled() const { return state_ == 0b00000000; }
+  struct Input : crtp<T, Input<T>> {
+    Filter filter_;
+    // from the interrupt
+    void Record(uint32_t time) { filter_.Put(time, (**this).get()); }
+    // calls fn(edge, at) for each edge due in the block of
+    // [block_size] frames starting at frame [start], [at] being its
+    // frame in the block. As before, false is the enabled level
+    template<class F>
+    void Process(uint32_t now, uint32_t start, int block_size, F&& fn) {
+      filter_.Process(now, start, block_size, latency(block_size),
+                      (**this).get(), fn);
+    }
   };
 
-  struct Learn : Debouncer<Learn> {
-    uint8_t state_;
+  struct Learn : Input<Learn> {
     Learn() {
       LEARN_JACK_RCC_CLK_ON();
       GPIO_InitTypeDef gpio = {0};
       gpio.Pin = LEARN_JACK_Pin;
-      gpio.Mode = GPIO_MODE_INPUT;
+      gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
       gpio.Pull = GPIO_PULLDOWN;
       HAL_GPIO_Init(LEARN_JACK_GPIO_Port, &gpio);
+      filter_.Init(get());
     }
     bool get() { return !ReadPin(LEARN_JACK_GPIO_Port, LEARN_JACK_Pin); };
   } learn_;
 
-  struct Freeze : Debouncer<Freeze> {
-    uint8_t state_;
+  struct Freeze : Input<Freeze> {
     Freeze() {
       FREEZE_JACK_RCC_CLK_ON();
       GPIO_InitTypeDef gpio = {0};
       gpio.Pin = FREEZE_JACK_Pin;
-      gpio.Mode = GPIO_MODE_INPUT;
+      gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
       gpio.Pull = GPIO_PULLDOWN;
       HAL_GPIO_Init(FREEZE_JACK_GPIO_Port, &gpio);
+      filter_.Init(get());
     }
     bool get() { return ReadPin(FREEZE_JACK_GPIO_Port, FREEZE_JACK_Pin); };
   } freeze_;
 
-  void Debounce() {
-    learn_.Debounce();
-    freeze_.Debounce();
+  // above the control context, which reads the queues, and beside
+  // the DAC interrupt, which then cannot come in while an edge is
+  // being timestamped
+  Gates() {
+    instance_ = this;
+    register_gates_isr(ISR);
+    HAL_NVIC_SetPriority(GATES_EXTI_IRQn, 0, 1);
+    HAL_NVIC_EnableIRQ(GATES_EXTI_IRQn);
+  }
+
+private:
+  static Gates *instance_;
+
+  static void ISR() {
+    uint32_t now = AudioClock::now();
+    if (__HAL_GPIO_EXTI_GET_IT(LEARN_JACK_Pin)) {
+      __HAL_GPIO_EXTI_CLEAR_IT(LEARN_JACK_Pin);
+      instance_->learn_.Record(now);
+    }
+    if (__HAL_GPIO_EXTI_GET_IT(FREEZE_JACK_Pin)) {
+      __HAL_GPIO_EXTI_CLEAR_IT(FREEZE_JACK_Pin);
+      instance_->freeze_.Record(now);
+    }
   }
 };
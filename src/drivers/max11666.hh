@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include "numtypes.hh"
+
+// Command words and data stream of the MAX11666 dual-channel ADC (pitch
+// and root CV) when it is read by DMA. No HAL dependency, so that it
+// can be tested on the host.
+//
+// The word sent to the ADC selects the channel of the next
+// conversions. The transmit buffer holds a fixed sequence of frames,
+// one group of words per channel: each group switches channel, throws
+// away the first reads while the input settles, then keeps
+// kOversamplingAmount reads. The receive buffer follows the same
+// layout word for word, so the position of a word tells what it is.
+
+enum SpiAdcInput {
+  CV_PITCH,
+  CV_ROOT,
+  NUM_SPI_ADC_CHANNELS
+};
+
+enum max11666Commands {
+  MAX11666_SWITCH_TO_CH1 = 0x00FF,
+  MAX11666_CONTINUE_READING_CH1 = 0x0000,
+  MAX11666_SWITCH_TO_CH2 = 0xFF00,
+  MAX11666_CONTINUE_READING_CH2 = 0xFFFF,
+};
+
+const uint8_t kADCBitDepth = 12;
+
+//Oversample and average blocks of 2^oversampling_bitsize samples
+constexpr uint8_t kOversamplingAmountBits = 3;
+constexpr uint8_t kOversamplingAmount = (1<<kOversamplingAmountBits);
+const uint8_t kOversamplingThrowoutReads = 7;
+
+class Max11666Stream {
+public:
+  static constexpr int kGroupWords = kOversamplingThrowoutReads + kOversamplingAmount;
+  static constexpr int kFrameWords = NUM_SPI_ADC_CHANNELS * kGroupWords;
+  // long enough for the slowest reader (one control block of
+  // kMaxBlockSize samples) to never fall a whole buffer behind
+  static constexpr int kFrames = 8;
+  static constexpr int kWords = kFrames * kFrameWords;
+
+  static constexpr int value_bits = kADCBitDepth + kOversamplingAmountBits;
+  using sum_t = Fixed<UNSIGNED, 32 - value_bits, value_bits>; // OS=3 => u17_15
+
+  // fills the transmit buffer
+  static void Sequence(uint16_t (&tx)[kWords]) {
+    for (int i=0; i<kWords; i++) {
+      int chan = i % kFrameWords / kGroupWords;
+      bool first = i % kGroupWords == 0;
+      tx[i] = chan == CV_PITCH
+        ? (first ? MAX11666_SWITCH_TO_CH1 : MAX11666_CONTINUE_READING_CH1)
+        : (first ? MAX11666_SWITCH_TO_CH2 : MAX11666_CONTINUE_READING_CH2);
+    }
+  }
+
+  // decodes the words received since the last call, up to [end], the
+  // index of the next word the DMA will write. The sum of the last
+  // kOversamplingAmount reads of each channel is kept up to date one
+  // word at a time. A reader that fell a whole buffer behind only
+  // decodes fresh words at stale positions: the sums stay exact.
+  void Process(uint16_t const (&rx)[kWords], int end) {
+    while (pos_ != end) {
+      int offset = pos_ % kGroupWords - kOversamplingThrowoutReads;
+      if (offset >= 0) {
+        int chan = pos_ % kFrameWords / kGroupWords;
+        uint16_t x = rx[pos_] >> 2;
+        sums_[chan] += x;
+        sums_[chan] -= reads_[chan][offset];
+        reads_[chan][offset] = x;
+      }
+      if (++pos_ == kWords) pos_ = 0;
+    }
+  }
+
+  u0_16 get(uint8_t chan) {
+    return u0_16::wrap(sum_t::of_repr(sums_[chan]));
+  }
+
+private:
+  uint16_t reads_[NUM_SPI_ADC_CHANNELS][kOversamplingAmount] = {};
+  uint32_t sums_[NUM_SPI_ADC_CHANNELS] = {};
+  int pos_ = 0;
+};
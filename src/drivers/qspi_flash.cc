@@ -659,6 +659,24 @@ HAL_StatusTypeDef QSpiFlash::EnterMemory_QPI(void)
 	QSPI_AutoPollingTypeDef  s_config;
 	uint8_t	reg;
 
+	// QUADEN is non-volatile: once set, it is set at every power-on,
+	// and the write cycle (up to 40ms) can be skipped
+	s_command.Instruction       = READ_STATUS_REG_CMD;
+	s_command.AddressMode       = QSPI_ADDRESS_NONE;
+	s_command.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+	s_command.DataMode          = QSPI_DATA_1_LINE;
+	s_command.DummyCycles       = 0;
+	s_command.NbData            = 1;
+
+	if (HAL_QSPI_Command(&handle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+		return HAL_ERROR;
+
+	if (HAL_QSPI_Receive(&handle, &reg, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+		return HAL_ERROR;
+
+	if (reg & QSPI_SR_QUADEN)
+		return HAL_OK;
+
 	reg = QSPI_SR_QUADEN;
 
 	s_command.Instruction       = WRITE_ENABLE_CMD;
@@ -684,12 +702,11 @@ HAL_StatusTypeDef QSpiFlash::EnterMemory_QPI(void)
 	if (HAL_QSPI_Transmit(&handle, &reg, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
 		return HAL_ERROR;
 
-	/* 40ms  Write Status/Configuration Register Cycle Time */
-	HAL_Delay(8);
-
-	/* Configure automatic polling mode to wait the QUADEN bit=1 and WIP bit=0 */
+	/* Configure automatic polling mode to wait the QUADEN bit=1 and WIP
+	   bit=0, rather than the 40ms maximum Write Status Register Cycle
+	   Time */
 	s_config.Match           = QSPI_SR_QUADEN;
-	s_config.Mask            = QSPI_SR_QUADEN /*|QSPI_SR_WIP*/;
+	s_config.Mask            = QSPI_SR_QUADEN | QSPI_SR_WIP;
 	s_config.MatchMode       = QSPI_MATCH_MODE_AND;
 	s_config.StatusBytesSize = 1;
 	s_config.Interval        = 0x10;
@@ -2,84 +2,45 @@
 
 #include "hal.hh"
 #include "dsp.hh"
-
-enum SpiAdcInput {
-  CV_PITCH,
-  CV_ROOT,
-  NUM_SPI_ADC_CHANNELS
-};
-
-enum max11666Commands {
-  MAX11666_SWITCH_TO_CH1 = 0x00FF,
-  MAX11666_CONTINUE_READING_CH1 = 0x0000,
-  MAX11666_SWITCH_TO_CH2 = 0xFF00,
-  MAX11666_CONTINUE_READING_CH2 = 0xFFFF,
-};
+#include "max11666.hh"
 
 enum max11666Errors {
 	MAX11666_NO_ERR = 0,
 	MAX11666_SPI_INIT_ERR,
 };
 
-#define MAX11666_SPI_IRQHANDLER     SPI2_IRQHandler
-
-#define ADC_BIT_DEPTH 12
-const uint8_t kADCBitDepth = 12;
-
-//Oversample and average blocks of 2^oversampling_bitsize samples 
-//Todo: Template with oversampling amount?
-constexpr uint8_t kOversamplingAmountBits = 3;
-constexpr uint8_t kOversamplingAmount = (1<<kOversamplingAmountBits);
-constexpr uint8_t kOversamplingMask = kOversamplingAmount - 1;
-const uint8_t kOversamplingThrowoutReads = 7;
-
-// #define OVERSAMPLING_AMT_BITS   2
-// #define OVERSAMPLING_AMT (1<<OVERSAMPLING_AMT_BITS)
-// #define OVERSAMPLING_MASK (OVERSAMPLING_AMT-1)
-// #define OVERSAMPLEING_THROWOUT_READS  3 
+// SPI words per second, paced by TIM7
+constexpr uint32_t kSpiAdcWordRate = 96000;
 
+// Reads the MAX11666 without the CPU: TIM7 paces a circular DMA that
+// writes the command sequence into the SPI data register, and a second
+// circular DMA stores the words received. Process() then decodes what
+// arrived since its last call.
 struct SpiAdc : Nocopy {
 
-  static constexpr int value_bits = kADCBitDepth + kOversamplingAmountBits;
-  using value_t = Fixed<UNSIGNED, 16 - value_bits, value_bits>; // OS=3 => u1_15, OS=2 => u2_14
-  using sum_t = Fixed<UNSIGNED, 32 - value_bits, value_bits>; // OS=3 => u17_15, OS=2 => u18_14
-
 	SpiAdc() {
-    spiadc_instance_ = this;
-
     err = MAX11666_NO_ERR;
-    cur_chan = 0;
+
+    Max11666Stream::Sequence(tx_);
+    SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t*>(tx_), sizeof(tx_));
 
     assign_pins();
     SPI_disable();
     SPI_GPIO_init();
     SPI_init();
-    IRQ_init();
+    DMA_init();
     SPI_enable();
-
-    //Send one word to start
-    spih.Instance->DR = MAX11666_SWITCH_TO_CH1;
+    TIM_init();
   }
 
-  u0_16 get(uint8_t chan) {
-    sum_t avg = 0._u17_15;
-    for (int i=0; i<kOversamplingAmount; i++){
-      avg += sum_t(values[chan][i]);
-    }
-    return u0_16::wrap(avg);
+  // control context, once per block
+  void Process() {
+    SCB_InvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(rx_), sizeof(rx_));
+    stream_.Process(rx_, Max11666Stream::kWords - __HAL_DMA_GET_COUNTER(&hdma_rx_));
   }
 
-  void switch_channel(void) {
-    cur_chan = !cur_chan;
-    os_idx[cur_chan] = kOversamplingAmount + kOversamplingThrowoutReads - 1;
-    spiadc_instance_->spih.Instance->DR = cur_chan ? MAX11666_SWITCH_TO_CH2 : MAX11666_SWITCH_TO_CH1;
-  }
+  u0_16 get(uint8_t chan) { return stream_.get(chan); }
 
-  static SpiAdc *spiadc_instance_;
-  SPI_HandleTypeDef spih;
-  value_t values[NUM_SPI_ADC_CHANNELS][kOversamplingAmount];
-  static uint32_t os_idx[NUM_SPI_ADC_CHANNELS];
-  static uint8_t cur_chan;
   max11666Errors err;
 
 private:
@@ -91,8 +52,15 @@ private:
     uint8_t   af;
   } spiPin;
 
-  uint32_t      SPI_clk;
-  IRQn_Type     SPI_IRQn;
+  SPI_HandleTypeDef spih;
+  DMA_HandleTypeDef hdma_rx_;
+  DMA_HandleTypeDef hdma_tx_;
+  TIM_HandleTypeDef htim_;
+
+  alignas(32) uint16_t tx_[Max11666Stream::kWords];
+  alignas(32) uint16_t rx_[Max11666Stream::kWords];
+  Max11666Stream stream_;
+
   spiPin        SCK;
   spiPin        MISO;
   spiPin        CHSEL;
@@ -100,7 +68,6 @@ private:
 
   void assign_pins() {
     spih.Instance = SPI2;
-    SPI_IRQn = SPI2_IRQn;
 
     SCK.pin = GPIO_PIN_13;
     SCK.gpio = GPIOB;
@@ -145,15 +112,54 @@ private:
     spih.Instance->CR1 |= SPI_CR1_SPE;
   }
 
-  void IRQ_init()
-  {
-    HAL_NVIC_SetPriority(SPI_IRQn, 0, 1);
-    HAL_NVIC_EnableIRQ(SPI_IRQn);
+  // SPI2_RX on DMA1 stream 3, TIM7_UP on DMA1 stream 2: no interrupt
+  void DMA_init() {
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    hdma_rx_.Instance = DMA1_Stream3;
+    hdma_rx_.Init.Channel = DMA_CHANNEL_0;
+    hdma_rx_.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_rx_.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_rx_.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_rx_.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma_rx_.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_rx_.Init.Mode = DMA_CIRCULAR;
+    hdma_rx_.Init.Priority = DMA_PRIORITY_MEDIUM;
+    hdma_rx_.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    hal_assert(HAL_DMA_Init(&hdma_rx_));
+
+    hdma_tx_ = hdma_rx_;
+    hdma_tx_.Instance = DMA1_Stream2;
+    hdma_tx_.Init.Channel = DMA_CHANNEL_1;
+    hdma_tx_.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hal_assert(HAL_DMA_Init(&hdma_tx_));
+
+    uintptr_t dr = reinterpret_cast<uintptr_t>(&spih.Instance->DR);
+    hal_assert(HAL_DMA_Start(&hdma_rx_, dr, reinterpret_cast<uintptr_t>(rx_),
+                             Max11666Stream::kWords));
+    hal_assert(HAL_DMA_Start(&hdma_tx_, reinterpret_cast<uintptr_t>(tx_), dr,
+                             Max11666Stream::kWords));
+    SET_BIT(spih.Instance->CR2, SPI_CR2_RXDMAEN);
+  }
+
+  // each update event sends the next command word
+  void TIM_init() {
+    __HAL_RCC_TIM7_CLK_ENABLE();
+
+    // APB1 timers run at twice PCLK1 when it is divided
+    uint32_t clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1) clock *= 2;
 
-    // Enable the Rx buffer not empty interrupt
-    __HAL_SPI_ENABLE_IT(&spih, SPI_IT_RXNE);
+    htim_.Instance = TIM7;
+    htim_.Init.Prescaler = 0;
+    htim_.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim_.Init.Period = clock / kSpiAdcWordRate - 1;
+    htim_.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    htim_.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    hal_assert(HAL_TIM_Base_Init(&htim_));
 
-    __HAL_SPI_DISABLE_IT(&spih, SPI_IT_TXE);
+    __HAL_TIM_ENABLE_DMA(&htim_, TIM_DMA_UPDATE);
+    hal_assert(HAL_TIM_Base_Start(&htim_));
   }
 
   void SPI_GPIO_init()
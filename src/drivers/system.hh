@@ -1,9 +1,12 @@
 #include "hal.hh"
+#include "profile.hh"
 
 extern "C" {
   extern __IO uint32_t uwTick;
   void (*SysTick_ISR)();
   void RegisterSysTickISR(void f()) { SysTick_ISR = f; }
+  void (*PendSV_ISR)();
+  void RegisterPendSVISR(void f()) { PendSV_ISR = f; }
 }
 
 template<int SYSTICK_FREQ, class T>
@@ -24,6 +27,15 @@ struct System : crtp<T, System<SYSTICK_FREQ, T>>, Nocopy {
 
     FPU->FPDSCR |= FPU_FPDSCR_FZ_Msk;
     FPU->FPDSCR |= FPU_FPDSCR_DN_Msk;
+
+    // for the profiler and the CPU governor
+    ProfileClock::Init();
+  }
+
+  // runs PendSVCallback() as soon as no higher-priority interrupt is
+  // active; used to defer work out of the audio interrupt
+  static void TriggerPendSV() {
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
   }
 
 private:
@@ -35,6 +47,10 @@ private:
     (**instance_).SysTickCallback();
   }
 
+  static void PendSVISR() {
+    (**instance_).PendSVCallback();
+  }
+
   void SetVectorTable(uint32_t reset_address) {
     SCB->VTOR = reset_address & (uint32_t)0x1FFFFF80;
   }
@@ -78,6 +94,7 @@ private:
 
     // Configure the Systick interrupt time
     RegisterSysTickISR(&System::SysTickISR);
+    RegisterPendSVISR(&System::PendSVISR);
     HAL_SYSTICK_Config(HAL_RCC_GetHCLKFreq()/SYSTICK_FREQ);
     HAL_SYSTICK_CLKSourceConfig(SYSTICK_CLKSOURCE_HCLK);
 
@@ -88,12 +105,16 @@ private:
     HAL_NVIC_SetPriority(UsageFault_IRQn, 0, 0);
     HAL_NVIC_SetPriority(SVCall_IRQn, 0, 0);
     HAL_NVIC_SetPriority(DebugMonitor_IRQn, 0, 0);
-    HAL_NVIC_SetPriority(PendSV_IRQn, 0, 0);
     HAL_NVIC_SetPriority(SysTick_IRQn, 1, 0);
+    // below the audio DMA (0,x), same group as SysTick so
+    // that the two never preempt each other
+    HAL_NVIC_SetPriority(PendSV_IRQn, 1, 1);
   }
 
 };
 
+// the host simulation (test/simulator.cc) links with the C++ runtime
+#ifndef SIM
 namespace std {
   void __throw_bad_function_call() {
     assert_param(false);
@@ -101,6 +122,7 @@ namespace std {
 	while(1);
   };
 }
+#endif
 
 extern "C" {
   void SysTick_Handler(void) {
@@ -133,8 +155,10 @@ extern "C" {
   void UsageFault_Handler() { NVIC_SystemReset(); }
   void SVC_Handler() { NVIC_SystemReset(); }
   void DebugMon_Handler() { NVIC_SystemReset(); }
-  void PendSV_Handler() { NVIC_SystemReset(); }
+  void PendSV_Handler() { PendSV_ISR(); }
+#ifndef SIM
   void __cxa_pure_virtual() { NVIC_SystemReset(); }
   __weak void _init() {}
   __weak void main() {}
+#endif
 }
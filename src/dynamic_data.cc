@@ -3,83 +3,81 @@
 
 #include "dynamic_data.hh"
 
-/* triangles */
-Buffer<Buffer<s8_0, 9>, 8> triangles_12ths = {{{
-  {{{-12._s8_0, -9._s8_0, -6._s8_0, -3._s8_0, 0._s8_0, 3._s8_0, 6._s8_0, 9._s8_0, 12._s8_0, }}},
-  {{{-12._s8_0, -12._s8_0, -8._s8_0, -4._s8_0, 0._s8_0, 4._s8_0, 8._s8_0, 12._s8_0, 12._s8_0, }}},
-  {{{-12._s8_0, -12._s8_0, -12._s8_0, -6._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, }}},
-  {{{-12._s8_0, -12._s8_0, -12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, }}},
-  {{{-12._s8_0, -6._s8_0, -12._s8_0, -6._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, 6._s8_0, 12._s8_0, }}},
-  {{{-12._s8_0, -6._s8_0, -0._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, }}}, 
-  {{{-12._s8_0, -6._s8_0, 12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, -12._s8_0, 6._s8_0, 12._s8_0, }}},
-  {{{12._s8_0, -12._s8_0, 12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, -12._s8_0, 12._s8_0, -12._s8_0, }}},
-}}};
+// tables computed by the compiler are constant-initialized: const ones
+// go to flash, others to .data
 
+namespace tables {
+constexpr auto sine = Generate<SineEntries>([](auto& t) { FillSine(t); });
+constexpr auto cheby = Generate<ChebyEntries>([](auto& t) { FillCheby(t); });
+constexpr auto fold = Generate<FoldEntries>([](auto& t) { FillFold(t); });
+constexpr auto fold_max =
+  Generate<FoldMaxEntries>([](auto& t) { FillFoldMax(t); });
+constexpr auto triangles =
+  Generate<TrianglesEntries>([](auto& t) { FillTriangles(t); });
+}
 
-Buffer<std::pair<s1_15, s1_15>, sine_size> DynamicData::sine;
-Buffer<Buffer<f, cheby_size>, cheby_tables> DynamicData::cheby;
-Buffer<std::pair<f, f>, fold_size> DynamicData::fold;
-Buffer<f, (fold_size-1)/2 + 1> DynamicData::fold_max;
-Buffer<Buffer<f, 9>, 8> DynamicData::triangles;
-
-DynamicData::DynamicData() {
+#if SINE_TABLE == TABLE_BOOT
+SineTable DynamicData::sine;
+#else
+Table<SineTable, SINE_TABLE> DynamicData::sine =
+  tables::Compile<SineTable>(tables::sine);
+#endif
 
-  // sine + difference
-  { MagicSine magic(1_f / f(sine_size-1));
-    s1_15 previous = s1_15::inclusive(magic.Process());
-    for (auto& [v, d] : sine) {
-      v = previous;
-      previous = s1_15::inclusive(magic.Process());
-      d = previous - v;
-    }
-  }
+#if CHEBY_TABLE == TABLE_BOOT
+ChebyTable DynamicData::cheby;
+#else
+Table<ChebyTable, CHEBY_TABLE> DynamicData::cheby =
+  tables::Compile<ChebyTable>(tables::cheby);
+#endif
 
-  // cheby[1] = [-1..1]
-  for (int i=0; i<cheby_size; i++)
-    cheby[0][i] = f(i * 2)/f(cheby_size-1) - 1_f;
+#if FOLD_TABLE == TABLE_BOOT
+FoldTable DynamicData::fold;
+#else
+Table<FoldTable, FOLD_TABLE> DynamicData::fold =
+  tables::Compile<FoldTable>(tables::fold);
+#endif
 
-  // cheby[2] = 2 * cheby[1] * cheby[1] - 1
-  for (int i=0; i<cheby_size; i++)
-    cheby[1][i] = 2_f * cheby[0][i] * cheby[0][i] - 1_f;
+#if FOLD_MAX_TABLE == TABLE_BOOT
+FoldMaxTable DynamicData::fold_max;
+#else
+Table<FoldMaxTable, FOLD_MAX_TABLE> DynamicData::fold_max =
+  tables::Compile<FoldMaxTable>(tables::fold_max);
+#endif
 
-  // cheby[n] = 2 * cheby[1] * cheby[n-1] - cheby[n-2]
-  for (int n=2; n<cheby_tables; n++)
-    for (int i=0; i<cheby_size; i++)
-      cheby[n][i] = 2_f * cheby[0][i] * cheby[n-1][i] - cheby[n-2][i];
+#if TRIANGLES_TABLE == TABLE_BOOT
+TrianglesTable DynamicData::triangles;
+#else
+Table<TrianglesTable, TRIANGLES_TABLE> DynamicData::triangles =
+  tables::Compile<TrianglesTable>(tables::triangles);
+#endif
 
-  // fold
-  { f folds = 6_f;
-    f previous = 0_f;
-    for (int i=0; i<fold_size; ++i) {
-      // TODO: this -3 make the wavefolding curve symmetrical; why?
-      f x = f(i) / f(fold_size-3); // 0..1
-      x = folds * (2_f * x - 1_f); // -folds..folds
-      f g = 1_f / (1_f + x.abs()); // 0..0.5
-      f p = 16_f / (2_f * Math::pi) * x * g;
-      while(p > 1_f) p--;
-      while(p < 0_f) p++;
-      x = - g * (x + Math::fast_sine(p));
-      fold[i] = i==0 ? std::pair(x, 0_f) : std::pair(previous, x - previous);
-      previous = x;
-    }
-  }
+FoldBandsTable DynamicData::fold_bands;
+SegmentBandsTable DynamicData::segment_bands;
+std::atomic<bool> DynamicData::bands_ready {false};
 
-  // fold_max
-  { f max = 0_f;
-    int start = (fold_size-1) / 2;
-    for (int i=0; i<fold_max.size(); ++i) {
-      max = fold[i+start].first.abs().max(max);
-      // the attenuation factor accounts for interpolation error, so
-      // we don't overestimate the 1/x curve and amplify to clipping
-      fold_max[i] = 0.92_f / (max + 0.00001_f);
-    }
-  }
+// the others, from the same generators
+DynamicData::DynamicData() {
+#if SINE_TABLE == TABLE_BOOT
+  tables::FillSine(sine);
+#endif
+#if CHEBY_TABLE == TABLE_BOOT
+  tables::FillCheby(cheby);
+#endif
+#if FOLD_TABLE == TABLE_BOOT
+  tables::FillFold(fold);
+#endif
+#if FOLD_MAX_TABLE == TABLE_BOOT
+  tables::FillFoldMax(fold_max);
+#endif
+#if TRIANGLES_TABLE == TABLE_BOOT
+  tables::FillTriangles(triangles);
+#endif
+}
 
-  { //60 bytes of code
-    for (int i=0; i<8; i++)
-      for (int j=0; j<9; j++)
-        triangles[i][j] = (f)(triangles_12ths[i][j])/12.0_f;
-  }
+void DynamicData::FillBands() {
+  tables::FillFoldBands(fold_bands);
+  tables::FillSegmentBands(segment_bands);
+  bands_ready.store(true, std::memory_order_release);
 }
 
 #pragma GCC pop_options
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <utility>
+#include <type_traits>
 #include "dsp.hh"
 
 static constexpr int sine_size = 512 + 1;
@@ -7,11 +10,400 @@ static constexpr int cheby_tables = 16;
 static constexpr int cheby_size = 512 + 1;
 static constexpr int fold_size = 1024 + 1;
 
+// Where each table lives, chosen per table at build time, e.g. make
+// TABLES="-DCHEBY_TABLE=TABLE_RAM" (see makefile):
+// - TABLE_FLASH: computed by the compiler, const in flash. No RAM and
+//   no boot time, but the application only has 48K of flash
+// - TABLE_RAM: computed by the compiler, copied to RAM with .data at
+//   startup. Costs both, but reads at RAM speed
+// - TABLE_BOOT: computed into RAM by DynamicData(), at boot. Costs no
+//   flash
+//
+// Cheby and fold stay at boot by default, in f32: even in a compact
+// format (16K and 4K, see below) they would only go to flash once a
+// linker map shows room for them next to the code. To try it:
+// TABLES="-DCHEBY_TABLE=TABLE_FLASH -DCHEBY_FORMAT=FORMAT_S1_15
+// -DFOLD_TABLE=TABLE_FLASH -DFOLD_FORMAT=FORMAT_S1_15". The compact
+// formats move the output by a few bits: the golden checksums of make
+// check then differ
+#define TABLE_FLASH 0
+#define TABLE_RAM 1
+#define TABLE_BOOT 2
+
+#ifndef SINE_TABLE
+#define SINE_TABLE TABLE_FLASH
+#endif
+#ifndef CHEBY_TABLE
+#define CHEBY_TABLE TABLE_BOOT
+#endif
+#ifndef FOLD_TABLE
+#define FOLD_TABLE TABLE_BOOT
+#endif
+#ifndef FOLD_MAX_TABLE
+#define FOLD_MAX_TABLE TABLE_FLASH
+#endif
+#ifndef TRIANGLES_TABLE
+#define TRIANGLES_TABLE TABLE_FLASH
+#endif
+
+template<class T, int placement>
+using Table = std::conditional_t<placement == TABLE_FLASH, T const, T>;
+
+// How the cheby and fold tables store their values, chosen the same
+// way, e.g. TABLES="-DCHEBY_FORMAT=FORMAT_F16". The compact formats
+// halve the tables, so more of them stay in the data cache, for a few
+// bits (test/tables reports the error of each):
+// - FORMAT_F32: f
+// - FORMAT_F16: Float16, converted to f on reading
+// - FORMAT_S1_15: s1_15, to the scale of s1_15::inclusive
+// Cheby stores values; fold stores value+diff pairs, like sine.
+#define FORMAT_F32 0
+#define FORMAT_F16 1
+#define FORMAT_S1_15 2
+
+#ifndef CHEBY_FORMAT
+#define CHEBY_FORMAT FORMAT_F32
+#endif
+#ifndef FOLD_FORMAT
+#define FOLD_FORMAT FORMAT_F32
+#endif
+
+template<int format> struct TableFormat;
+template<> struct TableFormat<FORMAT_F32> { using type = f; };
+template<> struct TableFormat<FORMAT_F16> { using type = f16; };
+template<> struct TableFormat<FORMAT_S1_15> { using type = s1_15; };
+
+template<class T>
+using ChebyTableOf = Buffer<Buffer<T, cheby_size>, cheby_tables>;
+template<class T>
+using FoldTableOf = Buffer<std::pair<T, T>, fold_size>;
+
+using ChebyValue = TableFormat<CHEBY_FORMAT>::type;
+using FoldValue = TableFormat<FOLD_FORMAT>::type;
+
+using SineTable = Buffer<std::pair<s1_15, s1_15>, sine_size>;
+using ChebyTable = ChebyTableOf<ChebyValue>;
+using FoldTable = FoldTableOf<FoldValue>;
+using FoldMaxTable = Buffer<f, (fold_size-1)/2 + 1>;
+using TrianglesTable = Buffer<Buffer<f, 9>, 8>;
+
+// Band-limited levels of the fold and segment waveshapers, chosen per
+// voice from its frequency (see Antialias::band). On a sine of any
+// amplitude, the shaper of level [l] makes no harmonic above 1 << l:
+// it is the Chebyshev series of the full shaper, truncated to that
+// degree. Above the last level, the full tables. They would not fit in
+// flash, and take the compiler too long: FillBands computes them from
+// the main loop, once audio runs, and until it is done the voices use
+// the full tables. Whatever the format of the full tables, the bands
+// are stored in s1_15: fold is limited to -1..1, and segment, which
+// rings past it at its corners, is scaled down by band_segment_scale.
+// The segment shapes are odd: their bands only store 0..1, and read
+// -1..0 mirrored.
+static constexpr int kBandLevels = 7;           // 1..64 harmonics
+static constexpr int kBandHarmonics = 1 << (kBandLevels - 1);
+static constexpr int band_nodes = 256;          // of the Chebyshev series
+static constexpr int band_fold_size = 256 + 1;
+static constexpr int band_segment_size = 128 + 1; // over 0..1
+static constexpr f band_segment_scale = 2_f;
+
+using FoldBandsTable =
+  Buffer<Buffer<std::pair<s1_15, s1_15>, band_fold_size>, kBandLevels>;
+using SegmentBandsTable =
+  Buffer<Buffer<Buffer<s1_15, band_segment_size>, 8>, kBandLevels>;
+
 struct DynamicData {
   DynamicData();
-  static Buffer<std::pair<s1_15, s1_15>, sine_size> sine;
-  static Buffer<Buffer<f, cheby_size>, cheby_tables> cheby;
-  static Buffer<std::pair<f, f>, fold_size> fold;
-  static Buffer<f, (fold_size-1)/2 + 1> fold_max;
-  static Buffer<Buffer<f, 9>, 8> triangles;
+  static Table<SineTable, SINE_TABLE> sine;
+  static Table<ChebyTable, CHEBY_TABLE> cheby;
+  static Table<FoldTable, FOLD_TABLE> fold;
+  static Table<FoldMaxTable, FOLD_MAX_TABLE> fold_max;
+  static Table<TrianglesTable, TRIANGLES_TABLE> triangles;
+  static FoldBandsTable fold_bands;
+  static SegmentBandsTable segment_bands;
+  static std::atomic<bool> bands_ready;
+  static void FillBands();
 };
+
+// The generators fill either the tables themselves, at boot, or their
+// plain counterparts (Entries), for the compiler: a Buffer of f or
+// s1_15 cannot be default-constructed in a constant expression. The
+// entries are in full precision, and converted to the format of the
+// table as the tables are at boot. Both run the same operations; only
+// -ffast-math, which may reorder those at boot, tells them apart (see
+// test/tables.cc).
+namespace tables {
+
+template<class T, int N>
+struct Entries {
+  T v[N] {};
+  constexpr T& operator[](int i) { return v[i]; }
+  constexpr T const& operator[](int i) const { return v[i]; }
+};
+
+using SineEntries = Entries<std::pair<int16_t, int16_t>, sine_size>;
+using ChebyEntries = Entries<Entries<float, cheby_size>, cheby_tables>;
+using FoldEntries = Entries<std::pair<float, float>, fold_size>;
+using FoldMaxEntries = Entries<float, (fold_size-1)/2 + 1>;
+using TrianglesEntries = Entries<Entries<float, 9>, 8>;
+
+// [x] as stored in a table of T
+template<class T> constexpr T stored(f x);
+template<> constexpr f stored<f>(f x) { return x; }
+template<> constexpr f16 stored<f16>(f x) { return f16(x); }
+template<> constexpr s1_15 stored<s1_15>(f x) { return s1_15::inclusive(x); }
+
+// the value [a] and difference [d], as stored in a table of pairs of
+// T. In s1_15, the difference is taken after rounding, so that the
+// interpolation meets the next value; in f16, the difference is small
+// and keeps its own precision (and -ffast-math would fold away the
+// rounding of a round trip through f16 anyway)
+template<class T> constexpr std::pair<T, T> stored_pair(f a, f d) {
+  return {stored<T>(a), stored<T>(d)};
+}
+template<> constexpr std::pair<s1_15, s1_15> stored_pair<s1_15>(f a, f d) {
+  s1_15 x = stored<s1_15>(a), y = stored<s1_15>(a + d);
+  return {x, y - x};
+}
+
+// and back, to compute with
+constexpr f loaded(f x) { return x; }
+constexpr f loaded(f16 x) { return x.to_float(); }
+constexpr f loaded(s1_15 x) { return f::inclusive(x); }
+
+template<class T> constexpr void set(T& e, f x) { e = stored<T>(x); }
+constexpr void set(float& e, f x) { e = x.repr(); }
+// (member-wise: the assignment of std::pair is not constexpr in C++17)
+template<class T> constexpr void set(std::pair<T, T>& e, f a, f d) {
+  std::pair<T, T> p = stored_pair<T>(a, d);
+  e.first = p.first; e.second = p.second;
+}
+constexpr void set(std::pair<float, float>& e, f a, f d) {
+  e.first = a.repr(); e.second = d.repr();
+}
+constexpr void set(std::pair<s1_15, s1_15>& e, s1_15 a, s1_15 b) {
+  e.first = a; e.second = b;
+}
+constexpr void set(std::pair<int16_t, int16_t>& e, s1_15 a, s1_15 b) {
+  e.first = int16_t(a.repr()); e.second = int16_t(b.repr());
+}
+
+// sine + difference
+template<class T>
+constexpr void FillSine(T& sine) {
+  MagicSine magic(1_f / f(sine_size-1));
+  s1_15 previous = s1_15::inclusive(magic.Process());
+  for (int i=0; i<sine_size; i++) {
+    s1_15 v = previous;
+    previous = s1_15::inclusive(magic.Process());
+    set(sine[i], v, previous - v);
+  }
+}
+
+// point by point, so that the recurrence runs in full precision
+// whatever the format of the table
+template<class T>
+constexpr void FillCheby(T& cheby) {
+  for (int i=0; i<cheby_size; i++) {
+    // cheby[1] = [-1..1]
+    f x = f(i * 2)/f(cheby_size-1) - 1_f;
+    // cheby[2] = 2 * cheby[1] * cheby[1] - 1
+    f previous = x;
+    f current = 2_f * x * x - 1_f;
+    set(cheby[0][i], previous);
+    set(cheby[1][i], current);
+    // cheby[n] = 2 * cheby[1] * cheby[n-1] - cheby[n-2]
+    for (int n=2; n<cheby_tables; n++) {
+      f next = 2_f * x * current - previous;
+      set(cheby[n][i], next);
+      previous = current;
+      current = next;
+    }
+  }
+}
+
+// the wavefolding curve, [x] in 0..1
+constexpr f FoldShape(f x) {
+  f folds = 6_f;
+  x = folds * (2_f * x - 1_f); // -folds..folds
+  f g = 1_f / (1_f + x.abs()); // 0..0.5
+  f p = 16_f / (2_f * Math::pi) * x * g;
+  while(p > 1_f) p--;
+  while(p < 0_f) p++;
+  return - g * (x + Math::fast_sine(p));
+}
+
+// at point [i] of [fold]
+constexpr f FoldCurve(int i) {
+  // TODO: this -3 make the wavefolding curve symmetrical; why?
+  return FoldShape(f(i) / f(fold_size-3));
+}
+
+template<class T>
+constexpr void FillFold(T& fold) {
+  f previous = 0_f;
+  for (int i=0; i<fold_size; ++i) {
+    f x = FoldCurve(i);
+    if (i==0) set(fold[i], x, 0_f);
+    else set(fold[i], previous, x - previous);
+    previous = x;
+  }
+}
+
+// from the first half of the fold curve, in full precision
+template<class T>
+constexpr void FillFoldMax(T& fold_max) {
+  f max = 0_f;
+  int start = (fold_size-1) / 2;
+  for (int i=0; i<(fold_size-1)/2 + 1; ++i) {
+    f x = FoldCurve(i+start).abs();
+    if (x > max) max = x;
+    // the attenuation factor accounts for interpolation error, so
+    // we don't overestimate the 1/x curve and amplify to clipping
+    set(fold_max[i], 0.92_f / (max + 0.00001_f));
+  }
+}
+
+inline constexpr Buffer<Buffer<s8_0, 9>, 8> triangles_12ths = {{{
+  {{{-12._s8_0, -9._s8_0, -6._s8_0, -3._s8_0, 0._s8_0, 3._s8_0, 6._s8_0, 9._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -12._s8_0, -8._s8_0, -4._s8_0, 0._s8_0, 4._s8_0, 8._s8_0, 12._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -12._s8_0, -12._s8_0, -6._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -12._s8_0, -12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -6._s8_0, -12._s8_0, -6._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, 6._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -6._s8_0, -0._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, 0._s8_0, 6._s8_0, 12._s8_0, }}},
+  {{{-12._s8_0, -6._s8_0, 12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, -12._s8_0, 6._s8_0, 12._s8_0, }}},
+  {{{12._s8_0, -12._s8_0, 12._s8_0, -12._s8_0, 0._s8_0, 12._s8_0, -12._s8_0, 12._s8_0, -12._s8_0, }}},
+}}};
+
+template<class T>
+constexpr void FillTriangles(T& triangles) {
+  for (int i=0; i<8; i++)
+    for (int j=0; j<9; j++)
+      set(triangles[i][j], (f)(triangles_12ths[i][j])/12.0_f);
+}
+
+// cos(pi x), x in 0..1, to the precision of f
+constexpr f CosPi(f x) {
+  f y = Math::pi * (0.5_f - x); // sin(y), y in -pi/2..pi/2
+  f y2 = y * y;
+  return y * (1_f - y2 / 6_f * (1_f - y2 / 20_f * (1_f - y2 / 42_f *
+              (1_f - y2 / 72_f * (1_f - y2 / 110_f)))));
+}
+
+// adds to [c] the Chebyshev coefficients of [shape] on -1..1, up to
+// kBandHarmonics, from its values at band_nodes Chebyshev nodes
+template<class F>
+constexpr void ChebyshevSeries(F shape, float (&c)[kBandHarmonics + 1]) {
+  for (int j=0; j<band_nodes; j++) {
+    f x = CosPi((f(j) + 0.5_f) / f(band_nodes));
+    f y = shape(x) * 2_f / f(band_nodes);
+    c[0] += (y * 0.5_f).repr();
+    f t0 = 1_f, t1 = x;
+    for (int k=1; k<=kBandHarmonics; k++) {
+      c[k] += (y * t1).repr();
+      f t2 = 2_f * x * t1 - t0;
+      t0 = t1;
+      t1 = t2;
+    }
+  }
+}
+
+// the series [c] at the [size] points of -1..1, truncated to each
+// level: calls put(level, point, value)
+template<class F>
+constexpr void BandLevels(float const (&c)[kBandHarmonics + 1], int size, F put) {
+  for (int i=0; i<size; i++) {
+    f x = f(i * 2) / f(size-1) - 1_f;
+    f sum = f(c[0]) + f(c[1]) * x;
+    put(0, i, sum);
+    f t0 = 1_f, t1 = x;
+    int level = 1;
+    for (int k=2; k<=kBandHarmonics; k++) {
+      f t2 = 2_f * x * t1 - t0;
+      t0 = t1;
+      t1 = t2;
+      sum += f(c[k]) * t1;
+      if (k == 1 << level) put(level++, i, sum);
+    }
+  }
+}
+
+// as read by Distortion::warp<FOLD>, from a sample in -1..1, in value
+// + diff pairs like fold (limited to -1..1, for s1_15)
+template<class T>
+constexpr void FillFoldBands(T& bands) {
+  float c[kBandHarmonics + 1] {};
+  ChebyshevSeries([](f u) {
+    return FoldShape((u + 1_f) * 0.5_f * f(fold_size-1) / f(fold_size-3));
+  }, c);
+  float previous[kBandLevels] {};
+  BandLevels(c, band_fold_size, [&](int l, int i, f x) {
+    x = x > 1_f ? 1_f : x < -1_f ? -1_f : x;
+    if (i > 0) set(bands[l][i-1], f(previous[l]), x - f(previous[l]));
+    if (i == band_fold_size-1) set(bands[l][i], x, 0_f);
+    previous[l] = x.repr();
+  });
+}
+
+// the piecewise linear [triangles], as read by Distortion::warp<SEGMENT>:
+// the upper half of each, over 0..1, scaled down
+template<class T>
+constexpr void FillSegmentBands(T& bands) {
+  constexpr int half = band_segment_size - 1;
+  for (int s=0; s<8; s++) {
+    float c[kBandHarmonics + 1] {};
+    ChebyshevSeries([s](f u) {
+      f position = (u + 1_f) * 4_f; // 0..8
+      int j = int(position.repr());
+      if (j > 7) j = 7;
+      f a = (f)(triangles_12ths[s][j])/12.0_f;
+      f b = (f)(triangles_12ths[s][j+1])/12.0_f;
+      return a + (b - a) * (position - f(j));
+    }, c);
+    BandLevels(c, 2 * half + 1, [&](int l, int i, f x) {
+      if (i >= half) set(bands[l][s][i - half], x / band_segment_scale);
+    });
+  }
+}
+
+// Entries to tables
+
+template<class T> struct Tag {};
+
+template<class T>
+constexpr T convert(Tag<T>, float x) { return stored<T>(f(x)); }
+template<class T>
+constexpr std::pair<T, T> convert(Tag<std::pair<T, T>>, std::pair<float, float> x) {
+  return stored_pair<T>(f(x.first), f(x.second));
+}
+constexpr std::pair<s1_15, s1_15> convert(Tag<std::pair<s1_15, s1_15>>,
+                                          std::pair<int16_t, int16_t> x) {
+  return {s1_15::of_repr(x.first), s1_15::of_repr(x.second)};
+}
+
+template<class T, int N, class E, std::size_t... i>
+constexpr Buffer<T, N> expand(Entries<E, N> const& e, std::index_sequence<i...>);
+
+template<class T, int N, class E>
+constexpr Buffer<T, N> convert(Tag<Buffer<T, N>>, Entries<E, N> const& e) {
+  return expand<T, N>(e, std::make_index_sequence<N>());
+}
+
+template<class T, int N, class E, std::size_t... i>
+constexpr Buffer<T, N> expand(Entries<E, N> const& e, std::index_sequence<i...>) {
+  return Buffer<T, N> {{{ convert(Tag<T>(), e[i])... }}};
+}
+
+// [Table] as computed by the compiler from [entries]
+template<class Table, class E>
+constexpr Table Compile(E const& entries) {
+  return convert(Tag<Table>(), entries);
+}
+
+template<class E, class F>
+constexpr E Generate(F fill) {
+  E e {};
+  fill(e);
+  return e;
+}
+
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "dsp.hh"
+
+const f kCalibration2Volts = 2_f;
+const f kCalibration4Volts = 4_f;
+const f kCalibrationSuccessTolerance = 0.3_f;
+const f kCalibrationSuccessToleranceOffset = 0.1_f;
+
+const int kExtCVCalibrationIterations = 1024;
+
+enum CalibrationStepResult {
+  CAL_STEP_RESULT_NOT_BEGUN,
+  CAL_STEP_RESULT_IN_PROGRESS,
+  CAL_STEP_RESULT_SUCCESS,
+  CAL_STEP_RESULT_FAILURE,
+};
+
+enum CalibrationStep {
+  CALIBRATE_UNPATCHED,
+  CALIBRATE_C2,
+  CALIBRATE_C4
+};
+
+// [SOURCE] provides get(CHAN), like SpiAdc. In fast mode, the reading
+// goes through [FAST_FILTER] instead of [FILTER]
+template<int CHAN, class FILTER, class FAST_FILTER, class SOURCE>
+class ExtCVConditioner {
+  SOURCE& spi_adc_;
+  f& offset_;
+  f nominal_offset_;
+  f& slope_;
+  f nominal_slope_;
+  FILTER lp_;
+  FAST_FILTER fast_lp_;
+  bool fast_ = false;
+
+  f reading_at_C2;
+  f reading_unpatched;
+  int cal_i_;
+  bool is_calibrating_=false;
+  f cal_running_total_;
+
+  CalibrationStep cal_step_;
+
+  f last_raw_reading_;
+
+public:
+  ExtCVConditioner(f& o, f& s, SOURCE& spi_adc) :
+    offset_(o), nominal_offset_(o),
+    slope_(s), nominal_slope_(s),
+    spi_adc_(spi_adc) {}
+
+  void reset_calibration() {
+    is_calibrating_ = false;
+    cal_step_ = CALIBRATE_UNPATCHED;
+  }
+
+  void start_calibration(CalibrationStep step) {
+    cal_i_ = 0;
+    cal_step_ = step;
+    cal_running_total_ = 0_f;
+    is_calibrating_ = true;
+  }
+  auto process_calibration() {
+    CalibrationStepResult res;
+
+    cal_running_total_ += last_raw_reading_;
+
+    if (++cal_i_ >= kExtCVCalibrationIterations) {
+      is_calibrating_ = false;
+      cal_running_total_ /= f(kExtCVCalibrationIterations);
+
+      switch (cal_step_) {
+
+        case (CALIBRATE_UNPATCHED): {
+          reading_unpatched = cal_running_total_;
+          if ((reading_unpatched - nominal_offset_).abs() < kCalibrationSuccessToleranceOffset) {
+            res = CAL_STEP_RESULT_SUCCESS;
+           } else
+            res = CAL_STEP_RESULT_FAILURE;
+        } break;
+
+        case (CALIBRATE_C2): {
+          reading_at_C2 = cal_running_total_;
+          f octave = (reading_at_C2 - reading_unpatched) / kCalibration2Volts;
+          f slope = 12_f / octave;
+
+          if ((slope / nominal_slope_ - 1_f).abs() < kCalibrationSuccessTolerance)
+            res = CAL_STEP_RESULT_SUCCESS;
+          else
+            res = CAL_STEP_RESULT_FAILURE;
+        } break;
+
+        case (CALIBRATE_C4): {
+          f octave = (cal_running_total_ - reading_at_C2) / kCalibration2Volts;
+          f slope = 12_f / octave;
+
+          if ((slope / nominal_slope_ - 1_f).abs() < kCalibrationSuccessTolerance) {
+            slope_ = slope;
+            offset_ = reading_at_C2 - (kCalibration2Volts * 12_f / slope_);
+            res = CAL_STEP_RESULT_SUCCESS;
+          } else
+            res = CAL_STEP_RESULT_FAILURE;
+        } break;
+
+      }
+    }
+    else res = CAL_STEP_RESULT_IN_PROGRESS;
+
+    return res;
+  }
+
+  bool calibration_busy() {
+    return is_calibrating_;
+  }
+
+  void set_fast(bool fast) { fast_ = fast; }
+
+  void Process() {
+    u0_16 x = spi_adc_.get(CHAN);
+    if (fast_) fast_lp_.Process(x);
+    else lp_.Process(x);
+  }
+
+  f last() {
+    last_raw_reading_ = f::inclusive(fast_ ? fast_lp_.last() : lp_.last());
+    return (last_raw_reading_ - offset_) * slope_;
+  }
+};
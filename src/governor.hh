@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include "numtypes.hh"
+
+// Trades quality for CPU time when the audio block gets close to its
+// deadline, one level at a time, in this order:
+//   level 1: crossfade partners faded below kQuietFade are dropped
+//   level 2..numOsc: one more pair of voices is faded out from the top
+//   level numOsc+1: voices above kPlainFreq lose twist and warp
+// Levels are left one by one too, after the load has stayed low for a
+// while. Stepping down needs the previous step to have taken effect
+// (i.e. its fade to be finished), unless the block is already late.
+// Durations are counted in blocks of kBlockSize, whatever the actual
+// block size.
+class Governor {
+public:
+  static constexpr f kHighLoad = 0.85_f;
+  static constexpr f kLowLoad = 0.6_f;
+  static constexpr int kFadeBlocks = 64;          // to fade a pair out
+  static constexpr int kSettleBlocks = kFadeBlocks + 8;
+  static constexpr int kHoldBlocks = 1024;        // low load before stepping up
+
+  static constexpr f kQuietFade = 1_f / 64_f;
+  static constexpr f kPlainFreq = 1_f / 16_f;     // normalized
+
+  struct Counters {
+    uint32_t blocks;
+    uint32_t overloads;         // blocks over the deadline
+    uint32_t degraded_blocks;   // blocks at a level above 0
+    uint32_t step_downs;
+    uint32_t step_ups;
+    uint32_t max_level;
+  };
+
+private:
+  int level_ = 0;
+  int settle_ = 0;
+  int hold_ = 0;
+  Counters counters_ {};
+
+public:
+  // [load]: cost of the last block over its deadline; [numOsc]:
+  // number of pairs currently requested; [ticks]: length of the
+  // block, in blocks of kBlockSize
+  void Process(f load, int numOsc, int ticks = 1) {
+    int max_level = numOsc + 1;
+    if (level_ > max_level) level_ = max_level;
+
+    counters_.blocks++;
+    if (load > 1_f) counters_.overloads++;
+    if (level_ > 0) counters_.degraded_blocks++;
+    settle_ = settle_ > ticks ? settle_ - ticks : 0;
+
+    if (load > kHighLoad) {
+      hold_ = 0;
+      if (level_ < max_level && (settle_ == 0 || load > 1_f)) {
+        level_++;
+        settle_ = kSettleBlocks;
+        counters_.step_downs++;
+        if (uint32_t(level_) > counters_.max_level) counters_.max_level = level_;
+      }
+    } else if (load < kLowLoad && level_ > 0) {
+      if ((hold_ += ticks) >= kHoldBlocks) {
+        level_--;
+        hold_ = 0;
+        counters_.step_ups++;
+      }
+    } else {
+      hold_ = 0;
+    }
+  }
+
+  int level() const { return level_; }
+  bool drop_quiet_partners() const { return level_ >= 1; }
+  // number of pairs to fade out, out of [numOsc]
+  int shed_pairs(int numOsc) const {
+    int shed = level_ - 1;
+    return shed < 0 ? 0 : shed > numOsc - 1 ? numOsc - 1 : shed;
+  }
+  bool plain_high_voices(int numOsc) const { return level_ > numOsc; }
+
+  Counters const& counters() const { return counters_; }
+  void reset_counters() { counters_ = {}; }
+};
@@ -9,32 +9,58 @@ struct Main :
   System<kUiUpdateRate, Main>,
   Math,
   DynamicData,
+  BootMark<BOOT_TABLES>,
   QSpiFlash,
-  Dac<kSampleRate, kBlockSize, Main>,
-  Ui<kUiUpdateRate, kBlockSize> {
+  BootMark<BOOT_FLASH>,
+  Dac<kSampleRate, Main>,
+  BootMark<BOOT_DAC>,
+  Ui<kUiUpdateRate> {
 
   Main() {
-    //Start audio processing
-    Dac::Start();
+    BootStamp(BOOT_UI);
+    running_ = true;
+    //Start audio processing, on the default settings until the
+    //stored ones are loaded
+    Dac::Start(Ui::block_size());
+    Ui::LoadStored();
+    // band-limited waveshapers: the full ones until then
+    DynamicData::FillBands();
+    BootStamp(BOOT_BANDS);
     while(1) {
       Ui::Process();
+      // new block size: restart the DMA
+      if (Ui::block_size() != Dac::block_size())
+        Dac::Start(Ui::block_size());
       // TODO understand why this is crucial
       // just a "nop" is enough 
       __WFI();
     }
   }
 
+  // SysTick runs from the start of System, e.g. while the flash
+  // waits: the UI only exists once all bases are constructed
+  volatile bool running_ = false;
+
   void SysTickCallback() {
-    Ui::Update();
+    if (running_) Ui::Update();
+  }
+
+  // controls are polled once per block, after the audio interrupt
+  // returns; the new parameters are picked up by the next block
+  void PendSVCallback() {
+    Ui::Poll();
   }
   
   // Debug debug;
 
+  // one instantiation per block size (see Dac)
   template<int block_size>
-  void DacCallback(Buffer<Frame, block_size>& out) {
+  void DacCallback(Frame *out) {
     // debug.set(3, true);
-    Ui::Poll();
-    Ui::osc().Process(out);
+    Ui::AcquireParameters();
+    Ui::osc().Process<block_size>(out);
+    if (!boot_stamps[BOOT_FIRST_BLOCK]) BootStamp(BOOT_FIRST_BLOCK);
+    System::TriggerPendSV();
     // debug.set(3, false);
   }
 } _;
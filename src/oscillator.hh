@@ -4,110 +4,386 @@
 #include "distortion.hh"
 #include "dynamic_data.hh"
 
-class Phasor {
-  u0_32 phase_ = u0_32::of_repr(Random::Word());
+// A bank of [size] oscillators stored as a structure of arrays: each
+// field of the oscillators' state lives in its own array, and a block
+// is rendered for all voices by a single kernel specialized on the
+// twist and warp modes. The block size is an argument of the kernels:
+// specializing them on it too would build each of them once per
+// size, and the flash would not hold them
+template<int size>
+class OscillatorBank : Nocopy {
+  u0_32 phase_[size];
+  u0_32 freq_[size];            // at the end of the last block
+  IOnePoleLp<s1_15, 2> feedback_[size];
+  IFloat fade_[size], twist_[size], warp_[size], modulation_[size];
+  // the step of the last phase reset, eased out of the output over
+  // the next samples; and the last sample, for the next reset
+  f offset_[size], offset_step_[size], last_[size];
+  int declick_left_[size];
+  // phase reset of all voices in the next block (gate sync)
+  bool reset_ = false;
+  int reset_at_ = 0;
+  int declick_ = 0;
+
 public:
-  u0_32 Process(u0_32 freq) {
-    phase_ += freq;
-    return phase_;
+  // what to do with one voice during the next block
+  struct Voice {
+    f freq, twist, warp, modulation, fade, amplitude;
+    // faded out: keep the state running, but render nothing
+    bool silent;
+    // first voice of the block to accumulate into mod_out
+    bool clear_mod_out;
+    // only the first block_size samples are used
+    Buffer<u0_16, kMaxBlockSize> *mod_in, *mod_out;
+    Buffer<f, kMaxBlockSize> *sum_output;
+    // render a plain sine, without twist or warp (CPU governor);
+    // false when left out of the initializer
+    bool plain;
+    // ramp the frequency over the block from where the last block
+    // ended, instead of jumping to it (low-latency CV mode)
+    bool ramp_freq;
+    // samples at the start of the block that keep the frequency the
+    // last block ended with (Freeze released within the block);
+    // zero in a block with a reset (see Reset)
+    int hold;
+  };
+
+  OscillatorBank() {
+    for (int i=0; i<size; i++) {
+      phase_[i] = u0_32::of_repr(Random::Word());
+      freq_[i] = 0._u0_32;
+      offset_[i] = offset_step_[i] = last_[i] = 0_f;
+      declick_left_[i] = 0;
+    }
   }
 
-  void set(u0_32 phase) { phase_ = phase; }
-  u0_32 phase() { return phase_; }
-};
+  void sync(int i, int to) { phase_[i] = phase_[to]; }
 
-class SineShaper {
-  IOnePoleLp<s1_15, 2> lp_;
-public:
+  // restarts the phases of the voices rendered in the next block from
+  // zero at sample [at] (gate sync)
+  void Reset(int at) {
+    reset_ = true;
+    reset_at_ = at;
+  }
 
-  s1_15 Process(u0_32 phase, u0_16 feedback) {
-    s1_31 fb = lp_.state() * feedback.to_signed();
-    phase += fb.to_unsigned() + u0_32(feedback);
-    s1_15 sample = DynamicData::sine.interpolateDiff<s1_15>(phase);
-    lp_.Process(sample);
-    return sample;
+  // samples over which the step of a reset is eased out of the
+  // output, 0 for a hard reset. Voices then keep track of their last
+  // sample, through the slower loop (see ProcessSlow)
+  void set_declick(int samples) { declick_ = samples; }
+
+  // the phase of voice [i] as if restarted at sample [at] of the
+  // block it just skipped
+  void Restart(int i, int at, int block_size) {
+    phase_[i] = freq_[i] * (block_size - at - 1);
+    declick_left_[i] = 0;
+  }
+  void jump_twist(int i, f x) { twist_[i].jump(x); }
+  void jump_warp(int i, f x) { warp_[i].jump(x); }
+  void jump_modulation(int i, f x) { modulation_[i].jump(x); }
+
+  // keeps the phase running without rendering anything; the next
+  // block will fade in from silence
+  template<int block_size>
+  void Skip(int i, f const freq) {
+    freq_[i] = u0_32(freq);
+    phase_[i] += freq_[i] * block_size;
+    fade_[i].jump(0_f);
+    feedback_[i] = IOnePoleLp<s1_15, 2>();
   }
 
-  // without Feedback
-  s1_15 Process(u0_32 phase) {
-    return DynamicData::sine.interpolateDiff<s1_15>(phase);
+  // kernel variant for a twist or warp parameter at rest, where it
+  // leaves the sine untouched
+  static constexpr int kRest = 3;
+
+private:
+  // the sine at [phase], twisted by [twist_amount]
+  template<int twist>
+  static s1_15 Sine(u0_32 phase, IOnePoleLp<s1_15, 2>& lp, f twist_amount) {
+    if constexpr (twist != kRest)
+      phase = Distortion::twist<TwistMode(twist)>(phase, twist_amount);
+
+    s1_15 sine;
+    if constexpr (twist == FEEDBACK) {
+      u0_16 feedback = u0_16(twist_amount);
+      s1_31 fb = lp.state() * feedback.to_signed();
+      phase += fb.to_unsigned() + u0_32(feedback);
+      sine = DynamicData::sine.interpolateDiff<s1_15>(phase);
+      lp.Process(sine);
+    } else {
+      sine = DynamicData::sine.interpolateDiff<s1_15>(phase);
+    }
+    return sine;
   }
-};
 
-class Oscillator {
-  Phasor phasor_;
-  SineShaper sine_shaper_;
-  SimpleFloat amplitude_{0_f};
-  
-public:
-  IFloat fade_, twist_, warp_, modulation_;
+  // [level]: of the band-limited shapers, without crossfade
+  template<int twist, int warp, bool modulated>
+  static f Sample(u0_32& phasor, IOnePoleLp<s1_15, 2>& lp,
+                  u0_32 freq, u0_16 mod, f twist_amount, f warp_amount,
+                  int level) {
+    phasor += freq;
+    u0_32 phase = phasor;
+    if constexpr (modulated)
+      phase += u0_32(mod);
+    s1_15 sine = Sine<twist>(phase, lp, twist_amount);
+
+    if constexpr (warp == kRest)
+      return f::inclusive(sine);
+    else
+      return Distortion::warp<WarpMode(warp)>(sine, warp_amount, level);
+  }
 
-  void sync_to(Oscillator& that) {
-    this->phasor_.set(that.phasor_.phase());
+  // the same, with the modes as arguments, and the band crossfading
+  // its levels during a glide
+  static f Sample(int twist, int warp, u0_32& phasor, IOnePoleLp<s1_15, 2>& lp,
+                  u0_32 freq, u0_16 mod, f twist_amount, f warp_amount,
+                  Band band) {
+    phasor += freq;
+    u0_32 phase = phasor + u0_32(mod);
+    s1_15 sine =
+      twist == FEEDBACK ? Sine<FEEDBACK>(phase, lp, twist_amount) :
+      twist == PULSAR ? Sine<PULSAR>(phase, lp, twist_amount) :
+      twist == CRUSH ? Sine<CRUSH>(phase, lp, twist_amount) :
+      Sine<kRest>(phase, lp, twist_amount);
+
+    switch (warp) {
+    case FOLD: return Distortion::at_band<FOLD>(sine, warp_amount, band);
+    case CHEBY: return Distortion::warp<CHEBY>(sine, warp_amount, band.level);
+    case SEGMENT: return Distortion::at_band<SEGMENT>(sine, warp_amount, band);
+    default: return f::inclusive(sine);
+    }
   }
 
+  // The slower loop, shared by all the kernels, for the few voices
+  // that need it. Held voices jump to their frequency within the
+  // block, and reset ones restart their phase. With [declick_], the
+  // first sample after a reset starts from the last one before it,
+  // and the offset fades out linearly. During a glide, the band
+  // crossfades its levels. Picks up the ramps the kernel has set.
+  __attribute__((noinline))
+  void ProcessSlow(Voice const& v, int i, int block_size,
+                   int twist, int warp, bool modulated,
+                   u0_32 freq, u0_32 step, Band band) {
+    Buffer<u0_16, kMaxBlockSize>& mod_in = *v.mod_in;
+    Buffer<u0_16, kMaxBlockSize>& mod_out = *v.mod_out;
+    Buffer<f, kMaxBlockSize>& sum_output = *v.sum_output;
+    f const am = v.amplitude;
+
+    u0_32 ph = phase_[i];
+    IOnePoleLp<s1_15, 2> lp = feedback_[i];
+    IFloat fd=fade_[i], md=modulation_[i], tw=twist_[i], wa=warp_[i];
+    f offset = offset_[i], offset_step = offset_step_[i], last = last_[i];
+    int declick_left = declick_left_[i];
+    bool restarted = false;
+
+    auto render = [&](int begin, int end) {
+      for (int s=begin; s<end; s++) {
+        f t = twist != kRest ? tw.next() : 0_f;
+        f w = warp != kRest ? wa.next() : 0_f;
+        u0_16 m = modulated ? mod_in[s] : 0._u0_16;
+        f sample = Sample(twist, warp, ph, lp, freq, m, t, w, band);
+        freq += step;
+        if (restarted) {
+          restarted = false;
+          offset = last - sample;
+          offset_step = offset / f(declick_left);
+        }
+        if (declick_left) {
+          sample += offset;
+          offset -= offset_step;
+          declick_left--;
+        }
+        last = sample;
+        sample *= fd.next();
+        if (modulated)
+          mod_out[s] += u0_16((sample + 1_f) * md.next());
+        sum_output[s] += sample * am;
+      }
+    };
+
+    int cut = v.hold ? v.hold : reset_ ? reset_at_ : block_size;
+    render(0, cut);
+    if (v.hold) freq = freq_[i];
+    if (reset_) {
+      ph = 0._u0_32 - freq;   // sample [cut] is at phase zero
+      declick_left = declick_;
+      restarted = declick_;
+    }
+    render(cut, block_size);
+
+    phase_[i] = ph;
+    feedback_[i] = lp;
+    fade_[i] = fd;
+    modulation_[i] = md;
+    twist_[i] = tw;
+    warp_[i] = wa;
+    offset_[i] = offset;
+    offset_step_[i] = offset_step;
+    declick_left_[i] = declick_left;
+    last_[i] = last;
+  }
 
-  template<TwistMode twist_mode, WarpMode warp_mode>
-  static f Process(Phasor& ph, SineShaper& sh, u0_32 freq, u0_16 mod, f twist_amount, f warp_amount) {
-    u0_32 phase = ph.Process(freq);
-    phase += u0_32(mod);
-    phase = Distortion::twist<twist_mode>(phase, twist_amount);
+  // parameters at rest are neither antialiased nor ramped: their
+  // ramps stay where the last block left them, and resume from there
+  template<int twist, int warp, bool modulated>
+  void Process(Voice const *voices, int begin, int end, int block_size) {
+    for (int i=begin; i<end; i++) {
+      Voice const& v = voices[i];
+      Buffer<u0_16, kMaxBlockSize>& mod_in = *v.mod_in;
+      Buffer<u0_16, kMaxBlockSize>& mod_out = *v.mod_out;
+      Buffer<f, kMaxBlockSize>& sum_output = *v.sum_output;
+
+      // even unmodulated, keep the modulation blocks clean for when
+      // modulation comes back
+      if (v.clear_mod_out)
+        for (int s=0; s<block_size; s++) mod_out[s] = 0._u0_16;
+
+      // the step is zero unless ramping, which leaves freq untouched
+      u0_32 freq = u0_32(v.freq);
+      u0_32 step = 0._u0_32;
+      if (v.hold) {
+        freq = freq_[i];
+      } else if (v.ramp_freq) {
+        int32_t d = int32_t(freq.repr() - freq_[i].repr());
+        step = u0_32::of_repr(uint32_t(d / block_size));
+        freq = freq_[i];
+      }
+      freq_[i] = u0_32(v.freq);
+      f const am = v.amplitude;
+      f const fade = Antialias::freq(v.freq, v.fade);
+      f twist_amount = 0_f, warp_amount = 0_f;
+      Band band = {0, 0_f};
+
+      if constexpr (modulated)
+        modulation_[i].set(Antialias::modulation(v.freq, v.modulation), block_size);
+      if constexpr (twist != kRest)
+        twist_amount = Antialias::twist<TwistMode(twist)>(v.freq, v.twist);
+      if constexpr (warp != kRest) {
+        // of the highest frequency of the block
+        band = Antialias::band(std::max(freq, freq_[i]));
+        warp_amount = Antialias::warp<WarpMode(warp)>(band, v.warp);
+      }
+
+      if (v.silent) {
+        // the sample is zero: (sample + 1) * modulation = modulation
+        if constexpr (modulated)
+          for (int s=0; s<block_size; s++)
+            mod_out[s] += u0_16(modulation_[i].next());
+        phase_[i] += freq_[i] * block_size;
+        if (reset_) Restart(i, reset_at_, block_size);
+        fade_[i].jump(0_f);
+        if constexpr (twist != kRest) twist_[i].jump(twist_amount);
+        if constexpr (warp != kRest) warp_[i].jump(warp_amount);
+        // the feedback path has not followed the phase: start it over,
+        // as a fresh voice, rather than from a stale sample
+        feedback_[i] = IOnePoleLp<s1_15, 2>();
+        continue;
+      }
+
+      if constexpr (twist != kRest) twist_[i].set(twist_amount, block_size);
+      if constexpr (warp != kRest) warp_[i].set(warp_amount, block_size);
+      fade_[i].set(fade, block_size);
+
+      // the voices that need more than the common case (see
+      // ProcessSlow) leave the kernel; cheby reads no band level
+      bool glide = warp != CHEBY && band.mix > 0_f;
+      if (v.hold || reset_ || declick_ || declick_left_[i] || glide) {
+        ProcessSlow(v, i, block_size, twist, warp, modulated, freq, step, band);
+      } else {
+        u0_32 ph = phase_[i];
+        IOnePoleLp<s1_15, 2> lp = feedback_[i];
+        IFloat fd=fade_[i], md=modulation_[i], tw=twist_[i], wa=warp_[i];
+        for (int s=0; s<block_size; s++) {
+          f t = 0_f, w = 0_f;
+          if constexpr (twist != kRest) t = tw.next();
+          if constexpr (warp != kRest) w = wa.next();
+          u0_16 m = modulated ? mod_in[s] : 0._u0_16;
+          f sample = Sample<twist, warp, modulated>(ph, lp, freq, m, t, w, band.level);
+          freq += step;
+          sample *= fd.next();
+          if constexpr (modulated)
+            mod_out[s] += u0_16((sample + 1_f) * md.next());
+          sum_output[s] += sample * am;
+        }
+        phase_[i] = ph;
+        feedback_[i] = lp;
+        fade_[i] = fd;
+        modulation_[i] = md;
+        twist_[i] = tw;
+        warp_[i] = wa;
+      }
+
+      // force twist value to come back to its nominal value; fixes a
+      // float bug in Pulsar where it would rarely go beyond zero when
+      // turning knob CCW. TODO: check CPU time that this line adds.
+      if constexpr (twist != kRest) twist_[i].jump(twist_amount);
+    }
+  }
 
-    s1_15 sine = twist_mode == FEEDBACK ?
-      sh.Process(phase, u0_16(twist_amount)) :
-      sh.Process(phase);
+  using kernel_t = void (OscillatorBank::*)(Voice const *voices, int begin, int end,
+                                            int block_size);
 
-    return Distortion::warp<warp_mode>(sine, warp_amount);
+  // all combinations of twist (3 modes or rest), warp (3 modes or
+  // rest) and modulation (on or off)
+  template<int... k>
+  static constexpr std::array<kernel_t, sizeof...(k)>
+  make_kernels(std::integer_sequence<int, k...>) {
+    return {&OscillatorBank::Process<k / 8, k / 2 % 4, k % 2>...};
   }
 
-  template<TwistMode twist_mode, WarpMode warp_mode, int block_size>
-  void Process(f const freq,
-               f twist,
-               f warp,
-               f modulation,
-               f fade, f const amplitude,
-               Buffer<u0_16, block_size>& mod_in,
-               Buffer<u0_16, block_size>& mod_out,
-               Buffer<f, block_size>& sum_output) {
-
-    fade = Antialias::freq(freq, fade);
-    modulation = Antialias::modulation(freq, modulation);
-    twist = Antialias::twist<twist_mode>(freq, twist);
-    warp = Antialias::warp<warp_mode>(freq, warp);
-
-    twist_.set(twist, block_size);
-    warp_.set(warp, block_size);
-    modulation_.set(modulation, block_size);
-    amplitude_.set(amplitude, block_size);
-
-    u0_32 const fr = u0_32(freq);
-    Phasor ph = phasor_;
-    SineShaper sh = sine_shaper_;
-    IFloat fd=fade_, md=modulation_, tw=twist_, wa=warp_;
-    SimpleFloat am=amplitude_;
-
-    fd.set(fade, block_size);
-
-    for (auto [sum, m_in, m_out] : zip(sum_output, mod_in, mod_out)) {
-      f sample = Process<twist_mode, warp_mode>(ph, sh, fr, m_in, tw.next(), wa.next());
-      sample *= fd.next();
-      m_out += u0_16((sample + 1_f) * md.next());
-      sum += sample * am.next();
-    }
+  static kernel_t pick_kernel(int twist, int warp, bool modulated) {
+    static constexpr auto tab =
+      make_kernels(std::make_integer_sequence<int, 32>());
+    return tab[twist * 8 + warp * 2 + modulated];
+  }
 
-    // force twist value to come back to its nominal value; fixes a
-    // float bug in Pulsar where it would rarely go beyond zero when
-    // turning knob CCW. TODO: check CPU time that this line adds.
-    tw.jump(twist);
+public:
+  // renders the first [n] voices, in order; when [twist_rest] or
+  // [warp_rest] are set, the corresponding parameter of all voices
+  // must have been at its rest value for at least one block (same
+  // for modulation with zero when [modulated] is unset). Plain voices
+  // go through the kernel at rest, by runs of consecutive voices.
+  template<int block_size>
+  void Process(TwistMode twist_mode, bool twist_rest,
+               WarpMode warp_mode, bool warp_rest,
+               bool modulated,
+               Voice const *voices, int n) {
+    kernel_t kernel = pick_kernel(twist_rest ? kRest : twist_mode,
+                                  warp_rest ? kRest : warp_mode,
+                                  modulated);
+    kernel_t plain_kernel = pick_kernel(kRest, kRest, modulated);
+    for (int i=0; i<n; ) {
+      int j = i + 1;
+      while (j < n && voices[j].plain == voices[i].plain) j++;
+      (this->*(voices[i].plain ? plain_kernel : kernel))(voices, i, j, block_size);
+      i = j;
+    }
+    reset_ = false;
+  }
+};
 
-    phasor_ = ph;
-    sine_shaper_ = sh;
-    fade_ = fd;
-    amplitude_ = am;
-    modulation_ = md;
-    twist_ = tw;
-    warp_ = wa;
+// Hysteresis on the distance of a parameter to its rest value, at
+// which the kernels can skip the corresponding processing. At rest,
+// the parameter is pinned to its rest value, and the kernels skip it
+// once the ramps have had one block to get there.
+class RestDetector {
+  bool rest_ = false;
+  bool settled_ = false;
+public:
+  f Process(f x, f rest, f tolerance) {
+    f distance = (x - rest).abs();
+    if (rest_ ? distance > tolerance * 2_f : distance < tolerance) {
+      rest_ = !rest_;
+      settled_ = false;
+    } else {
+      settled_ = rest_;
+    }
+    return rest_ ? rest : x;
   }
+
+  // at rest for more than one block
+  bool settled() { return settled_; }
+
+  void reset() { rest_ = settled_ = false; }
 };
 
 struct FrequencyPair { f freq1, freq2, crossfade; };
@@ -116,49 +392,47 @@ class FrequencyState {
   OnePoleLp freq1_, freq2_, crossfade_;
   PositiveSlewLimiter<1024> coef_ {0_f};
 public:
-  FrequencyPair Process(f coef, FrequencyPair const p) {
-    coef = coef_.Process(coef);
-    freq1_.Process(coef, p.freq1);
-    freq2_.Process(coef, p.freq2);
-    crossfade_.Process(coef, p.crossfade);
+  // [ticks]: number of kBlockSize periods in the block
+  FrequencyPair Process(f coef, FrequencyPair const p, int ticks) {
+    for (int t=0; t<ticks; t++) {
+      f c = coef_.Process(coef);
+      freq1_.Process(c, p.freq1);
+      freq2_.Process(c, p.freq2);
+      crossfade_.Process(c, p.crossfade);
+    }
+    return {freq1_.state(), freq2_.state(), crossfade_.state()};
+  }
+  FrequencyPair state() {
     return {freq1_.state(), freq2_.state(), crossfade_.state()};
   }
 };
 
-template<int block_size>
+// Control part of a pair of oscillators crossfading between two
+// neighboring scale degrees; the oscillators themselves are voices
+// [v] and [v+1] of an OscillatorBank
 class OscillatorPair : Nocopy {
-  Oscillator osc_[2];
   FrequencyState freq_;
   OnePoleLp crossfade_lp_;
+  bool active_ = true;
 
 public:
-
-  using processor_t = void (Oscillator::*)(f const freq,
-                                           f twist,
-                                           f warp,
-                                           f modulation,
-                                           f fade, f const amplitude,
-                                           Buffer<u0_16, block_size>& mod_in,
-                                           Buffer<u0_16, block_size>& mod_out,
-                                           Buffer<f, block_size>& sum_output);
-
-  static processor_t pick_processor(TwistMode t, WarpMode m) {
-    static processor_t tab[3][3] = {
-      &Oscillator::Process<FEEDBACK, FOLD, block_size>,
-      &Oscillator::Process<FEEDBACK, CHEBY, block_size>,
-      &Oscillator::Process<FEEDBACK, SEGMENT, block_size>,
-      &Oscillator::Process<PULSAR, FOLD, block_size>,
-      &Oscillator::Process<PULSAR, CHEBY, block_size>,
-      &Oscillator::Process<PULSAR, SEGMENT, block_size>,
-      &Oscillator::Process<CRUSH, FOLD, block_size>,
-      &Oscillator::Process<CRUSH, CHEBY, block_size>,
-      &Oscillator::Process<CRUSH, SEGMENT, block_size>,
-    };
-    return tab[t][m];
+  using Bank = OscillatorBank<2 * kMaxNumOsc>;
+  using Voice = Bank::Voice;
+
+  // inaudible pair (above numOsc): only advance the phases at the
+  // last known frequencies
+  template<int block_size>
+  void Skip(Bank& bank, int v) {
+    FrequencyPair freq = freq_.state();
+    bank.Skip<block_size>(v, freq.freq1);
+    bank.Skip<block_size>(v+1, freq.freq2);
+    active_ = false;
   }
 
-  void Process(TwistMode twist_mode, bool twist_needs_jump,
-               WarpMode warp_mode, bool warp_needs_jump,
+  // prepares voices [v] and [v+1] of [bank] for the next block
+  template<int block_size>
+  void Process(Bank& bank, int v, Voice *voices,
+               bool twist_needs_jump, bool warp_needs_jump,
                FrequencyPair freq,
                bool frozen,
                f crossfade_factor,
@@ -166,47 +440,51 @@ public:
                f warp,
                f modulation, bool modulation_needs_jump,
                f const amplitude,
-               Buffer<u0_16, block_size>& mod_in, Buffer<u0_16, block_size>& mod_out,
-               Buffer<f, block_size>& sum_output) {
+               Buffer<u0_16, kMaxBlockSize>& mod_in, Buffer<u0_16, kMaxBlockSize>& mod_out,
+               Buffer<f, kMaxBlockSize>& sum_output) {
+    // smoothing is tuned per kBlockSize period
+    constexpr int ticks = block_size / kBlockSize;
 
     // filter frequencies and amplitudes to avoid clicks when out of
     // Freeze or when switching Scale
     f coef = frozen ? 0_f : 1_f;
-    auto [freq1, freq2, crossfade] = freq_.Process(coef, freq);
-
-    processor_t process = pick_processor(twist_mode, warp_mode);
+    auto [freq1, freq2, crossfade] = freq_.Process(coef, freq, ticks);
 
     // shape crossfade so notes are easier to find
-    crossfade = crossfade_lp_.Process(0.1_f, Signal::crop(crossfade_factor, crossfade));
-
-    if (twist_needs_jump) {
-      osc_[0].twist_.jump(twist);
-      osc_[1].twist_.jump(twist);
-    }
-
-    if (warp_needs_jump) {
-      osc_[0].warp_.jump(warp);
-      osc_[1].warp_.jump(warp);
+    f previous_crossfade = crossfade_lp_.state();
+    f target = Signal::crop(crossfade_factor, crossfade);
+    for (int t=0; t<ticks; t++)
+      crossfade = crossfade_lp_.Process(0.1_f, target);
+
+    // coming back from Skip: the ramps may be stale
+    if (!active_) {
+      twist_needs_jump = warp_needs_jump = modulation_needs_jump = true;
+      active_ = true;
     }
 
-    if (modulation_needs_jump) {
-      osc_[0].modulation_.jump(modulation);
-      osc_[1].modulation_.jump(modulation);
+    for (int i=v; i<v+2; i++) {
+      if (twist_needs_jump) bank.jump_twist(i, twist);
+      if (warp_needs_jump) bank.jump_warp(i, warp);
+      if (modulation_needs_jump) bank.jump_modulation(i, modulation);
     }
 
-    if (crossfade == 0_f) osc_[1].sync_to(osc_[0]);
-    if (crossfade == 1_f) osc_[0].sync_to(osc_[1]);
+    if (crossfade == 0_f) bank.sync(v+1, v);
+    if (crossfade == 1_f) bank.sync(v, v+1);
 
     f fade1 = 1_f - crossfade;
     f fade2 = crossfade;
 
-    // mod_out is accumulated in the two calls, so we need to zero it here
-    mod_out.fill(0._u0_16);
-    (osc_[0].*process)(freq1, twist, warp,
-                       modulation, fade1, amplitude,
-                       mod_in, mod_out, sum_output);
-    (osc_[1].*process)(freq2, twist, warp,
-                       modulation, fade2, amplitude,
-                       mod_in, mod_out, sum_output);
+    // when the crossfade stays pinned to one of the oscillators, the
+    // other one has finished fading out and need not be rendered
+    bool pinned = crossfade == previous_crossfade;
+
+    // mod_out is accumulated by the two voices, so the first one
+    // zeroes it
+    voices[v] = {freq1, twist, warp, modulation, fade1, amplitude,
+                 pinned && crossfade == 1_f, true,
+                 &mod_in, &mod_out, &sum_output};
+    voices[v+1] = {freq2, twist, warp, modulation, fade2, amplitude,
+                   pinned && crossfade == 0_f, false,
+                   &mod_in, &mod_out, &sum_output};
   }
 };
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <utility>
+#include <iterator>
+#include <type_traits>
 #include "numtypes.hh"
 
 constexpr struct Frame {
@@ -9,9 +12,39 @@ constexpr struct Frame {
 
 constexpr int kUiUpdateRate = 200; // Hz
 constexpr int kSampleRate = 48000; // Hz
-constexpr int kBlockSize = 8;
 constexpr int kMaxNumOsc = 16;
 
+// The audio path is compiled for each of kBlockSizes, except for the
+// oscillator kernels, which take the size as an argument (see
+// OscillatorBank), and the size is picked at boot. kBlockSize is the
+// default one, and the period that per-block smoothing is tuned for:
+// larger blocks step it several times per block.
+constexpr int kBlockSize = 8;
+constexpr int kBlockSizes[] = {8, 32, 64};
+constexpr int kMaxBlockSize = 64;
+
+// fade of the output in and out of a duck (see PolypticOscillator)
+constexpr int kDuckTime = 240; // samples, 5ms
+
+// calls [fn] with the block size [n] as a std::integral_constant, to
+// reach the instantiation compiled for it; nothing happens if [n] is
+// not one of kBlockSizes
+template<class F, std::size_t... i>
+void with_block_size(int n, F&& fn, std::index_sequence<i...>) {
+  ((n == kBlockSizes[i] &&
+    (fn(std::integral_constant<int, kBlockSizes[i]>()), true)) || ...);
+}
+
+template<class F>
+void with_block_size(int n, F&& fn) {
+  with_block_size(n, fn, std::make_index_sequence<std::size(kBlockSizes)>());
+}
+
+constexpr bool valid_block_size(int n) {
+  for (int b : kBlockSizes) if (b == n) return true;
+  return false;
+}
+
 enum TwistMode { FEEDBACK, PULSAR, CRUSH };
 enum WarpMode { FOLD, CHEBY, SEGMENT };
 enum ScaleMode { TWELVE, OCTAVE, FREE };
@@ -19,6 +52,36 @@ enum ModulationMode { ONE, TWO, THREE };
 
 enum SplitMode { ALTERNATE, LOW_HIGH, LOWEST_REST };
 
+// what the Freeze gate does: toggle Freeze on each edge, or restart
+// the phases of all oscillators on each rising edge, with or without
+// easing out the step
+enum SyncMode { SYNC_OFF, SYNC_HARD, SYNC_SMOOTH };
+
+// regions timed when built with PROFILE (see profile.hh)
+enum ProfileRegion {
+  PROFILE_BLOCK,                // PolypticOscillator::Process
+  PROFILE_OSCILLATORS,          // Oscillators::Process
+  PROFILE_PAIRS,                // per-pair control loop
+  PROFILE_BANK,                 // OscillatorBank render
+  PROFILE_OUTPUT,               // attenuation, DC blocking, packing
+  PROFILE_UI_POLL,
+  PROFILE_CONTROL_POLL,
+  kNumProfileRegions
+};
+
+// boot stages, stamped as each one ends (see profile.hh), from the
+// end of System (clocks and caches)
+enum BootStage {
+  BOOT_TABLES,                  // Math, DynamicData
+  BOOT_FLASH,                   // QSpiFlash
+  BOOT_DAC,                     // SAI and DMA set up
+  BOOT_UI,                      // Ui, on the default settings
+  BOOT_FIRST_BLOCK,             // first audio block rendered
+  BOOT_STORED,                  // stored settings swapped in
+  BOOT_BANDS,                   // band-limited waveshapers filled
+  kNumBootStages
+};
+
 struct SavedDualPotState {
   enum : uint32_t{ MainMode, CatchUpMode = 0x1234ABCD } restore_catchup_mode = MainMode;
   f restore_main_val = 0.5_f;
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 
 #include "dsp.hh"
+#include "profile.hh"
 #include "oscillator.hh"
 #include "quantizer.hh"
+#include "governor.hh"
+
+static_assert(kNumProfileRegions <= kMaxProfileRegions);
 
 class AmplitudeAccumulator {
   f amplitude = 1_f;
@@ -28,58 +33,98 @@ public:
   f sum() { return amplitudes; }
 };
 
-template<int block_size>
 class PreListenOscillators : Nocopy {
-  Oscillator oscs_[kMaxScaleSize];
-  Buffer<u0_16, block_size> dummy_block_;
+  using Bank = OscillatorBank<kMaxScaleSize>;
+  Bank bank_;
+  Bank::Voice voices_[kMaxScaleSize];
+  Buffer<u0_16, kMaxBlockSize> zero_block_;
+  Buffer<u0_16, kMaxBlockSize> dummy_block_;
   OnePoleLp amp_lp_;
 
 public:
-  void Process(Parameters const &params, PreScale &scale,
-               Buffer<f, block_size>& out1, Buffer<f, block_size>& out2) {
-    out1.fill(0_f);
-    out2.fill(0_f);
+  // renders the mono sum into the first [block_size] samples of
+  // [out], returns the attenuation to apply
+  template<int block_size>
+  f Process(Parameters const &params, PreScale &scale,
+            Buffer<f, kMaxBlockSize>& out) {
+    for (int s=0; s<block_size; s++) out[s] = 0_f;
 
     f twist = params.twist.value;
     f warp = params.warp.value;
-    f modulation = 0_f;    // no modulation in pre-listen
+    f modulation = 0_f;
 
-    f scale_size = amp_lp_.Process(0.05_f, f(scale.size()));
+    f scale_size;
+    for (int t=0; t<block_size / kBlockSize; t++)
+      scale_size = amp_lp_.Process(0.05_f, f(scale.size()));
     AmplitudeAccumulator amplitudes { 1_f, scale_size };
 
-    typename OscillatorPair<block_size>::processor_t process =
-      OscillatorPair<block_size>::pick_processor(params.twist.mode, params.warp.mode);
-
     for (int i=0; i<kMaxScaleSize; ++i) {
       f freq = Freq::of_pitch(scale.get(i)).repr();
-      (oscs_[i].*process)(freq, twist, warp,
-                          modulation, 1_f, amplitudes.next(),
-                          dummy_block_, dummy_block_, out1);
+      voices_[i] = {freq, twist, warp, modulation, 1_f, amplitudes.next(),
+                    false, false, &zero_block_, &dummy_block_, &out};
     }
 
+    // no modulation in pre-listen
+    bank_.Process<block_size>(params.twist.mode, false, params.warp.mode, false, false,
+                              voices_, kMaxScaleSize);
+
     f sum = amplitudes.sum();
     f atten = 0.5_f / sum;
     atten *= 1_f + Data::normalization_factors.interpolate_from_index(sum.max(f(kMaxNumOsc)));
-
-    for (auto [o1, o2] : zip(out1, out2)) {
-      o2 = o1 = o1 * atten;
-    }
+    return atten;
   }
 };
 
-template<int block_size>
 class Oscillators : Nocopy {
-  OscillatorPair<block_size> oscs_[kMaxNumOsc];
-  Buffer<u0_16, block_size> modulation_blocks_[kMaxNumOsc+1];
-  Buffer<u0_16, block_size> dummy_block_;
+  using Bank = OscillatorPair::Bank;
+  Bank bank_;
+  Bank::Voice voices_[2 * kMaxNumOsc];
+  OscillatorPair oscs_[kMaxNumOsc];
+  Buffer<u0_16, kMaxBlockSize> modulation_blocks_[kMaxNumOsc+1];
+  // modulation input of unmodulated oscillators, never written
+  Buffer<u0_16, kMaxBlockSize> zero_block_;
+  // modulation output of non-modulating oscillators, never read
+  Buffer<u0_16, kMaxBlockSize> dummy_block_;
   bool frozen_ = false;
+  bool rendered_frozen_ = false;  // during the last block
+  int freeze_at_ = 0;
   bool temp_frozen_ = false;
+  bool ramp_freq_ = false;
+  SyncMode sync_mode_ = SYNC_OFF;
+  bool sync_ = false;
+  int sync_at_ = 0;
+  // samples over which SYNC_SMOOTH eases out the step of a reset
+  static constexpr int kSyncDeclick = 32;
   f lowest_pitch_;
+  // how far each pair is faded out by the governor, 0..1
+  f shed_[kMaxNumOsc];
+
+public:
+  // what the last block rendered
+  struct RenderStats {
+    int pairs;
+    int silent_voices;
+    int plain_voices;
+  };
+
+private:
+  RenderStats render_stats_ {};
 
   TwistMode previous_twist_mode_;
   WarpMode previous_warp_mode_;
   ModulationMode previous_modulation_mode_;
 
+  RestDetector twist_rest_, warp_rest_, modulation_rest_;
+
+  // values of twist, warp and modulation at which they leave the
+  // sine untouched, per mode, and the tolerance around them below
+  // which they are considered at rest
+  static constexpr f twist_rest_value[3] = {0_f, 1_f, 0_f};
+  static constexpr f twist_tolerance[3] = {0.001_f, 0.01_f, 0.001_f};
+  static constexpr f warp_rest_value[3] = {0.004_f, 0_f, 0_f};
+  static constexpr f warp_tolerance[3] = {0.001_f, 0.001_f, 0.001_f};
+  static constexpr f modulation_tolerance = 0.001_f;
+
   static inline bool pick_split(SplitMode mode, int i, int numOsc) {
     return
       mode == ALTERNATE ? !(i&1) :
@@ -87,23 +132,23 @@ class Oscillators : Nocopy {
       i == 0;
   }
 
-  inline std::tuple<Buffer<u0_16, block_size>&, Buffer<u0_16, block_size>&>
+  inline std::tuple<Buffer<u0_16, kMaxBlockSize>&, Buffer<u0_16, kMaxBlockSize>&>
   pick_modulation_blocks(ModulationMode mode, int i, int numOsc) {
     if(mode == ONE) { //Up
       if (i==0) {
-        return std::forward_as_tuple(dummy_block_, modulation_blocks_[0]);
+        return std::forward_as_tuple(zero_block_, modulation_blocks_[0]);
       } else {
         return std::forward_as_tuple(modulation_blocks_[0], dummy_block_);
       }
     } else if (mode == TWO) { //All
       if (i==0) {
-        return std::forward_as_tuple(dummy_block_, modulation_blocks_[i+1]);
+        return std::forward_as_tuple(zero_block_, modulation_blocks_[i+1]);
       } else {
         return std::forward_as_tuple(modulation_blocks_[i], modulation_blocks_[i+1]);
       }
     } else { // mode == THREE //Down
       if (i==numOsc-1) {
-        return std::forward_as_tuple(dummy_block_, modulation_blocks_[0]);
+        return std::forward_as_tuple(zero_block_, modulation_blocks_[0]);
       } else {
         return std::forward_as_tuple(modulation_blocks_[0], dummy_block_);
       }
@@ -115,14 +160,16 @@ class Oscillators : Nocopy {
     f pitch;
     f spread;
     f detune;
-    f detune_accum = 0_f;
-    Scale const &scale;
+    f detune_accum;
+    IndexedScale const *scale;
   public:
-    FrequencyAccumulator(Scale const &g, f r, f p, f s, f d) :
-      scale(g), root(r), pitch(p), spread(s), detune(d) {}
+    void Reset(IndexedScale const *g, f r, f p, f s, f d) {
+      scale = g; root = r; pitch = p; spread = s; detune = d;
+      detune_accum = 0_f;
+    }
 
     f next_pitch() {
-      PitchPair p = scale.Process(root);
+      PitchPair p = scale->Process(root);
       f lowest = p.crossfade < 0.5_f ? p.p1 : p.p2;
       return lowest + pitch + detune_accum;
     }
@@ -130,7 +177,7 @@ class Oscillators : Nocopy {
     FrequencyPair next() {
 
       // root > 0
-      PitchPair p = scale.Process(root); // 2%
+      PitchPair p = scale->Process(root); // 2%
 
       p.p1 += pitch + detune_accum;
       p.p2 += pitch + detune_accum;
@@ -146,25 +193,83 @@ class Oscillators : Nocopy {
     }
   };
 
-public:
-  void Process(Parameters const &params, Scale const &scale,
-               Buffer<f, block_size>& out1, Buffer<f, block_size>& out2) {
-    out1.fill(0_f);
-    out2.fill(0_f);
+  // The frequencies and amplitudes of the pairs are cached from one
+  // block to the next. Frequencies are recomputed only when one of
+  // their inputs moved by more than its tolerance, and only for the
+  // active pairs; amplitudes only when balance or numOsc change.
+  static constexpr f kPitchTolerance = 0.001_f;  // semitones
+  static constexpr f kSpreadTolerance = 0.0001_f;
+  static constexpr f kBalanceTolerance = 0.0001_f;
+
+  FrequencyAccumulator frequency_;
+  FrequencyPair frequencies_[kMaxNumOsc];
+  int planned_frequencies_ = 0;
+  f planned_root_, planned_pitch_, planned_spread_, planned_detune_;
+  uint32_t planned_scale_;
+
+  f amplitudes_[kMaxNumOsc];
+  int planned_num_osc_ = -1;
+  f planned_balance_;
+  f atten_;
+
+  static bool moved(f x, f y, f tolerance) { return (x - y).abs() > tolerance; }
+
+  void PlanFrequencies(Parameters const &params, IndexedScale const &scale,
+                       int numOsc) {
+    if (planned_frequencies_ == 0 ||
+        scale.generation() != planned_scale_ ||
+        moved(params.root, planned_root_, kPitchTolerance) ||
+        moved(params.pitch, planned_pitch_, kPitchTolerance) ||
+        moved(params.spread, planned_spread_, kSpreadTolerance) ||
+        moved(params.detune, planned_detune_, kSpreadTolerance)) {
+      planned_root_ = params.root;
+      planned_pitch_ = params.pitch;
+      planned_spread_ = params.spread;
+      planned_detune_ = params.detune;
+      planned_scale_ = scale.generation();
+      frequency_.Reset(&scale, params.root, params.pitch,
+                       params.spread, params.detune);
+      lowest_pitch_ = frequency_.next_pitch();
+      planned_frequencies_ = 0;
+    }
 
-    int numOsc = params.alt.numOsc;
+    // more pairs than last time: carry on from where we stopped
+    while (planned_frequencies_ < numOsc)
+      frequencies_[planned_frequencies_++] = frequency_.next(); // 3%
+  }
+
+  void PlanAmplitudes(Parameters const &params, int numOsc) {
+    if (numOsc == planned_num_osc_ &&
+        !moved(params.balance, planned_balance_, kBalanceTolerance))
+      return;
+    planned_num_osc_ = numOsc;
+    planned_balance_ = params.balance;
 
     AmplitudeAccumulator amplitude {params.balance, f(numOsc)};
-    FrequencyAccumulator frequency {scale, params.root, params.pitch,
-                                    params.spread, params.detune};
+    for (int i=0; i<numOsc; ++i)
+      amplitudes_[i] = amplitude.next();
 
-    lowest_pitch_ = frequency.next_pitch();
+    atten_ = 1_f / amplitude.sum();
+    f balance = params.balance <= 1_f ? params.balance : 1_f / params.balance;
+    atten_ *= 0.5_f + (0.5_f + Data::normalization_factors[numOsc]) * balance;
+  }
+
+public:
+  // renders into the first [block_size] samples of [out1] and [out2]
+  template<int block_size>
+  std::pair<f, f> Process(Parameters const &params, IndexedScale const &scale,
+                          Governor const &governor,
+                          Buffer<f, kMaxBlockSize>& out1, Buffer<f, kMaxBlockSize>& out2) {
+    ProfileScope profile {PROFILE_OSCILLATORS};
+    for (int s=0; s<block_size; s++) out1[s] = out2[s] = 0_f;
+
+    int numOsc = params.alt.numOsc;
+
+    PlanFrequencies(params, scale, numOsc);
+    PlanAmplitudes(params, numOsc);
 
     TwistMode twist_mode = params.twist.mode;
     WarpMode warp_mode = params.warp.mode;
-    f twist = params.twist.value;
-    f warp = params.warp.value;
-    f modulation = params.modulation.value;
 
     f crossfade_factor = params.alt.crossfade_factor;
     SplitMode stereo_mode = params.alt.stereo_mode;
@@ -189,54 +294,141 @@ public:
       modulation_needs_jump = true;
     }
 
+    // rest values and tolerances depend on the mode
+    if (twist_needs_jump) twist_rest_.reset();
+    if (warp_needs_jump) warp_rest_.reset();
+
+    f twist = twist_rest_.Process(params.twist.value,
+                                  twist_rest_value[twist_mode],
+                                  twist_tolerance[twist_mode]);
+    f warp = warp_rest_.Process(params.warp.value,
+                                warp_rest_value[warp_mode],
+                                warp_tolerance[warp_mode]);
+    f modulation = modulation_rest_.Process(params.modulation.value,
+                                            0_f, modulation_tolerance);
+
+    // pairs shed by the governor fade out from the top, then stop
+    // being rendered; the modulation chain only spans the others
+    int active = numOsc - governor.shed_pairs(numOsc);
+    int rendered = numOsc;
     for (int i=0; i<kMaxNumOsc; ++i) {
-      FrequencyPair p = frequency.next(); // 3%
-      f amp = amplitude.next();
-      Buffer<f, block_size>& out = pick_split(stereo_mode, i, numOsc) ? out1 : out2;
-      auto [mod_in, mod_out] = pick_modulation_blocks(modulation_mode, i, numOsc);
-      dummy_block_.fill(0._u0_16);
-      bool frozen = (pick_split(freeze_mode, i, numOsc) && frozen_) || temp_frozen_;
-      oscs_[i].Process(twist_mode, twist_needs_jump, warp_mode, warp_needs_jump,
-                       p, frozen, crossfade_factor,
-                       twist, warp, modulation, modulation_needs_jump, amp,
-                       mod_in, mod_out, out);
+      if (i >= numOsc) {
+        shed_[i] = 0_f;
+        continue;
+      }
+      f step = f(block_size / kBlockSize) / f(Governor::kFadeBlocks);
+      shed_[i] = i < active ? (shed_[i] - step).max(0_f) : (shed_[i] + step).min(1_f);
+      if (shed_[i] == 1_f && i < rendered) rendered = i;
+    }
+    bool drop_quiet = governor.drop_quiet_partners();
+    bool plain = governor.plain_high_voices(numOsc);
+    render_stats_ = {rendered, 0, 0};
+
+    // Freeze changing at sample [at] of this block: the frequencies
+    // of this block are the last to move when freezing, and the
+    // first when unfreezing, after the voices held the frozen ones
+    int at = frozen_ != rendered_frozen_ ? freeze_at_ : 0;
+    rendered_frozen_ = frozen_;
+
+    // phase reset at sample [sync_at_] of this block
+    bool sync = sync_;
+    sync_ = false;
+    if (sync) bank_.Reset(sync_at_);
+    bank_.set_declick(sync_mode_ == SYNC_SMOOTH ? kSyncDeclick : 0);
+
+    { ProfileScope profile {PROFILE_PAIRS};
+      for (int i=0; i<kMaxNumOsc; ++i) {
+        if (i >= rendered) {
+          oscs_[i].Skip<block_size>(bank_, 2*i);
+          if (sync) {
+            bank_.Restart(2*i, sync_at_, block_size);
+            bank_.Restart(2*i+1, sync_at_, block_size);
+          }
+          continue;
+        }
+        FrequencyPair p = frequencies_[i];
+        f amp = amplitudes_[i];
+        Buffer<f, kMaxBlockSize>& out = pick_split(stereo_mode, i, numOsc) ? out1 : out2;
+        auto [mod_in, mod_out] = pick_modulation_blocks(modulation_mode, i, rendered);
+        bool split = pick_split(freeze_mode, i, numOsc);
+        bool frozen = (split && frozen_ && !at) || temp_frozen_;
+        int hold = split && !frozen_ && !temp_frozen_ && !sync ? at : 0;
+        oscs_[i].Process<block_size>(bank_, 2*i, voices_, twist_needs_jump, warp_needs_jump,
+                         p, frozen, crossfade_factor,
+                         twist, warp, modulation, modulation_needs_jump, amp,
+                         mod_in, mod_out, out);
+
+        for (int v=2*i; v<2*i+2; v++) {
+          voices_[v].fade *= 1_f - shed_[i];
+          voices_[v].ramp_freq = ramp_freq_;
+          voices_[v].hold = hold;
+          if (drop_quiet && voices_[v].fade < Governor::kQuietFade) voices_[v].silent = true;
+          if (plain && voices_[v].freq > Governor::kPlainFreq) voices_[v].plain = true;
+          render_stats_.silent_voices += voices_[v].silent;
+          render_stats_.plain_voices += voices_[v].plain && !voices_[v].silent;
+        }
+      }
+    }
+
+    { ProfileScope profile {PROFILE_BANK};
+      bank_.Process<block_size>(twist_mode, twist_rest_.settled(),
+                                warp_mode, warp_rest_.settled(),
+                                !modulation_rest_.settled(),
+                                voices_, 2 * rendered);
     }
 
     temp_frozen_ = false;
 
     f atten1, atten2;
-
-    f atten = 1_f / amplitude.sum();
-    f balance = params.balance <= 1_f ? params.balance : 1_f / params.balance;
-    atten *= 0.5_f + (0.5_f + Data::normalization_factors[numOsc]) * balance;
-
-    atten1 = atten2 = atten;
+    atten1 = atten2 = atten_;
 
     if (stereo_mode == LOWEST_REST) {
       // adjust attenuation to not clip the output
       atten1 = 0.7_f;
-      atten2 = 0.6_f * atten;
+      atten2 = 0.6_f * atten_;
     }
 
-    for (auto [o1, o2] : zip(out1, out2)) {
-      o1 *= atten1;
-      o2 *= atten2;
-    }
+    return {atten1, atten2};
   }
 
-  void set_freeze (bool frozen) { frozen_ = frozen; }
+  RenderStats const& render_stats() const { return render_stats_; }
+
+  // [at]: sample of the next block from which the change applies
+  void set_freeze (bool frozen, int at = 0) {
+    freeze_at_ = at;
+    frozen_ = frozen;
+  }
   void set_temporary_freeze() { temp_frozen_ = true; }
+  // restarts the phases at sample [at] of the next block; of several
+  // resets before that block, the last one wins
+  void sync(int at) {
+    sync_at_ = at;
+    sync_ = true;
+  }
+  void set_sync_mode(SyncMode mode) { sync_mode_ = mode; }
+  SyncMode sync_mode() { return sync_mode_; }
+  // ramp frequencies within blocks (see OscillatorBank::Voice)
+  void set_frequency_ramp(bool ramp) { ramp_freq_ = ramp; }
   bool frozen() { return frozen_; }
   f lowest_pitch() { return lowest_pitch_; }
 };
 
-template<int block_size>
-class PolypticOscillator : public Oscillators<block_size>, PreListenOscillators<block_size> {
+class PolypticOscillator : public Oscillators, PreListenOscillators {
   Parameters& params_;
   Quantizer quantizer_;
   PreScale pre_scale_;
   Scale *current_scale_;
+  IndexedScale indexed_scale_;
+  // edits of the scales by the control context, which leaves the
+  // indexing to the audio context (see IndexedScale::set)
+  std::atomic<uint32_t> scale_edits_ {0};
+  Governor governor_;
   DCBlocker dc_blocker1_, dc_blocker2_;
+  // channel sums, kept out of the audio interrupt stack
+  Buffer<f, kMaxBlockSize> sum1_, sum2_;
+  // output gain, ramped to silence when ducked
+  f gain_ = 1_f;
+  bool duck_ = false;
 
   bool learn_ = false;
   bool pre_listen_ = false;
@@ -245,6 +437,8 @@ class PolypticOscillator : public Oscillators<block_size>, PreListenOscillators<
 
   int previous_scale_index;
 
+  void edit_scales() { scale_edits_.fetch_add(1, std::memory_order_release); }
+
 public:
   PolypticOscillator(Parameters& params) : params_(params) {}
 
@@ -259,22 +453,27 @@ public:
     manual_learn_offset_ = this->lowest_pitch() - params_.root;
   }
 
-  bool disable_learn() {
+  // the learn and scale calls come from the control context: they
+  // take its [selected] scale, as [params_] belongs to audio
+  bool disable_learn(Parameters::Scale selected) {
     learn_ = false;
     disable_pre_listen();
-    current_scale_ = quantizer_.get_scale(params_.scale);
-    if (params_.scale.mode == TWELVE)
+    Scale *scale = quantizer_.get_scale(selected);
+    if (selected.mode == TWELVE)
       pre_scale_.quantize();
-    bool wrap_octave = params_.scale.mode == OCTAVE;
-    bool success = pre_scale_.copy_to(current_scale_, wrap_octave);
-    if (success) quantizer_.Save();
+    bool wrap_octave = selected.mode == OCTAVE;
+    bool success = pre_scale_.copy_to(scale, wrap_octave);
+    if (success) {
+      edit_scales();
+      quantizer_.Save();
+    }
     return success;
   }
 
   bool learn_mode() { return learn_; }
 
-  bool new_note(f x) {
-    if (params_.scale.mode == TWELVE)
+  bool new_note(Parameters::Scale selected, f x) {
+    if (selected.mode == TWELVE)
       x = x.integral();
     return pre_scale_.add(x);
   }
@@ -293,33 +492,85 @@ public:
     return pre_scale_.remove_last();
   }
 
-  void reset_current_scale() {
-    quantizer_.reset_scale(params_.scale);
+  void reset_current_scale(Parameters::Scale selected) {
+    quantizer_.reset_scale(selected);
+    edit_scales();
     quantizer_.Save();
   }
 
-  void Process(Buffer<Frame, block_size>& out) {
-    Buffer<f, block_size> out1;
-    Buffer<f, block_size> out2;
+  Governor const& governor() const { return governor_; }
+
+  // fades the output out, or back in, over kDuckTime
+  void duck(bool duck) { duck_ = duck; }
+  bool ducked() { return duck_ && gain_ <= 0_f; }
+
+  // stored scales (see Quantizer), swapped in from the control context
+  void LoadStored() { quantizer_.LoadStored(); }
+  void ApplyStored() {
+    quantizer_.ApplyStored();
+    edit_scales();
+  }
+
+  // renders [block_size] frames into [out], one of kBlockSizes. The
+  // host has no deadline to meet: there, the governor is only fed by
+  // explicit calls to Govern
+  template<int block_size>
+  void Process(Frame *out) {
+#ifdef TEST
+    Render<block_size>(out);
+#else
+    uint32_t start = ProfileClock::ticks();
+    Render<block_size>(out);
+    f deadline = f(ProfileClock::ticks_per_second()) * f(block_size) / f(kSampleRate);
+    Govern(f(ProfileClock::ticks() - start) / deadline, block_size);
+#endif
+  }
+
+  // [load]: cost of the last block of [block_size] over its deadline.
+  // Pre-listen renders a fixed number of voices, which the governor
+  // has no hold on
+  void Govern(f load, int block_size) {
+    if (!pre_listen_)
+      governor_.Process(load, params_.alt.numOsc, block_size / kBlockSize);
+  }
+
+private:
+  template<int block_size>
+  void Render(Frame *out) {
+    static_assert(block_size % kBlockSize == 0 && block_size <= kMaxBlockSize);
+    ProfileScope profile {PROFILE_BLOCK};
+    f atten1, atten2;
+    Buffer<f, kMaxBlockSize>* right = &sum2_;
 
     if (pre_listen_) {
       if (follow_new_note_)
         change_last_note(params_.new_note + manual_learn_offset_, params_.fine_tune);
-      PreListenOscillators<block_size>::Process(params_, pre_scale_, out1, out2);
+      atten1 = atten2 = PreListenOscillators::Process<block_size>(params_, pre_scale_, sum1_);
+      right = &sum1_;             // mono
     } else {
       if (previous_scale_index != params_.scale.value) {
-        Oscillators<block_size>::set_temporary_freeze();
+        Oscillators::set_temporary_freeze();
         previous_scale_index = params_.scale.value;
       }
       current_scale_ = quantizer_.get_scale(params_.scale);
-      Oscillators<block_size>::Process(params_, *current_scale_, out1, out2);
+      indexed_scale_.set(current_scale_, scale_edits_.load(std::memory_order_acquire));
+      std::tie(atten1, atten2) =
+        Oscillators::Process<block_size>(params_, indexed_scale_, governor_, sum1_, sum2_);
     }
 
-    for (auto [o1, o2, o] : zip(out1, out2, out)) {
-      o1 = dc_blocker1_.process(o1);
-      o2 = dc_blocker2_.process(o2);
-      o.l = s9_23::inclusive(o1.clip());
-      o.r = s9_23::inclusive(o2.clip());
+    // attenuation, ducking, DC blocking, clipping and packing in one
+    // pass, straight into the DMA buffer
+    ProfileScope profile_output {PROFILE_OUTPUT};
+    f step = f(block_size) / f(kDuckTime);
+    f target = duck_ ? (gain_ - step).max(0_f) : (gain_ + step).min(1_f);
+    f increment = (target - gain_) * (1_f / f(block_size));
+    for (int s=0; s<block_size; s++) {
+      gain_ += increment;
+      f l = dc_blocker1_.process(sum1_[s] * (atten1 * gain_));
+      f r = dc_blocker2_.process((*right)[s] * (atten2 * gain_));
+      out[s].l = s9_23::inclusive(l.clip());
+      out[s].r = s9_23::inclusive(r.clip());
     }
+    gain_ = target;
   }
 };
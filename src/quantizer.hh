@@ -17,6 +17,7 @@ class Scale {
   f scale_[kMaxScaleSize];
   int size_ = 0;
   friend class PreScale;
+  friend class IndexedScale;
 public:
   Scale() {}
   Scale(std::initializer_list<f> scale) {
@@ -67,6 +68,99 @@ public:
   }
 };
 
+// A Scale with a uniform grid over one period: each cell holds the
+// index of the highest degree at or below its lower bound, so that
+// quantizing a pitch takes a multiply, a table read and a correction
+// step. One step is enough when no two degrees share a cell, as in
+// every default scale; learned degrees can be as close as
+// kScaleUnicityThreshold, and take one more step for each degree
+// they crowd into a cell. The grid is not part of the (persisted)
+// Scale; it must be rebuilt whenever the scale changes (see [set]).
+class IndexedScale {
+  static constexpr int kGridSize = 64;
+  Scale const *scale_ = nullptr;
+  uint32_t edits_ = 0;
+  uint32_t generation_ = 0;
+  f max_, cells_per_semitone_, octaves_per_semitone_;
+  uint8_t grid_[kGridSize];
+
+  void Index(Scale const *scale, uint32_t edits) {
+    scale_ = scale;
+    edits_ = edits;
+    generation_++;
+    int size = scale->size_;
+    max_ = scale->scale_[size-1];
+    octaves_per_semitone_ = 1_f / max_;
+    cells_per_semitone_ = f(kGridSize) * octaves_per_semitone_;
+    f step = max_ / f(kGridSize);
+    for (int i=0; i<kGridSize; i++)
+      grid_[i] = uint8_t(binary_search(f(i) * step, scale->scale_, size));
+  }
+
+public:
+  // changes every time the scale is re-indexed
+  uint32_t generation() const { return generation_; }
+
+  // re-indexes only if [scale] is not the one already indexed, or
+  // was edited since: [edits] counts the edits of the scales. Only
+  // the context that calls Process may call it
+  void set(Scale const *scale, uint32_t edits) {
+    if (scale != scale_ || edits != edits_) Index(scale, edits);
+  }
+
+  f max() const { return max_; }
+
+  // over kScaleUnicityThreshold, bounds the degrees that can share a
+  // cell of the grid, hence the correction steps of [locate]
+  f cell_width() const { return max_ / f(kGridSize); }
+
+  // the degree below [semitones], in [0..max[, as read from the grid
+  int guess(f semitones) const {
+    int cell = (semitones * cells_per_semitone_).floor();
+    return grid_[cell < 0 ? 0 : cell >= kGridSize ? kGridSize-1 : cell];
+  }
+
+  // the degree below [semitones], in [0..max[
+  int locate(f semitones) const {
+    f const *notes = scale_->scale_;
+    int const size = scale_->size_;
+    // a grid indexed before the scale was edited can point past it
+    int index = std::min(guess(semitones), size-2);
+    // cells can be crossed by one or more degrees; rounding can
+    // also land us in the neighboring cell
+    while (index < size-2 && semitones >= notes[index+1]) index++;
+    while (index > 0 && semitones < notes[index]) index--;
+    return index;
+  }
+
+  // same as Scale::Process
+  PitchPair Process(f const pitch) const {
+    f const *notes = scale_->scale_;
+    int const size = scale_->size_;
+
+    f oct = (pitch * octaves_per_semitone_).integral();
+    f octaves = oct * max_;
+    f semitones = pitch - octaves;
+
+    int index = locate(semitones);
+
+    f p1 = notes[index];
+    f p2 = notes[index+1];
+    f crossfade = (semitones - p1) / (p2 - p1);
+    p1 += octaves;
+    p2 += octaves;
+
+    if ((index + (oct.floor() * (size+1))) & 1) {
+      crossfade = 1_f - crossfade;
+      f tmp = p1;
+      p1 = p2;
+      p2 = tmp;
+    }
+
+    return {p1, p2, crossfade};
+  }
+};
+
 class PreScale : Scale {
 public:
   bool add(f x) {
@@ -226,9 +320,15 @@ class Quantizer {
 
   ScaleTable scales_;
   Persistent<WearLevel<FlashBlock<2, ScaleTable>>> scales_storage_ {&scales_, default_scales_};
+  ScaleTable stored_scales_;
 
 public:
 
+  // the stored scales are read into a copy, in the background, then
+  // swapped in at once
+  void LoadStored() { scales_storage_.Load(&stored_scales_); }
+  void ApplyStored() { scales_ = stored_scales_; }
+
   void reset_scale(Parameters::Scale scale) {
     int i=scale.mode;
     int j=scale.value;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include "buttons.hh"
 #include "switches.hh"
 #include "leds.hh"
@@ -7,6 +8,7 @@
 #include "polyptic_oscillator.hh"
 #include "event_handler.hh"
 #include "bitfield.hh"
+#include "snapshot.hh"
 
 constexpr u1_7 kLedAdjustMin = 0.5_u1_7;
 constexpr u1_7 kLedAdjustMax = 1.5_u1_7;
@@ -71,7 +73,8 @@ private:
 };
 
 struct ButtonsEventSource : EventSource<Event>, Buttons {
-  void Poll(std::function<void(Event)> const& put) {
+  template<class Put>
+  void Poll(Put const& put) {
     Buttons::Debounce();
     if (Buttons::learn_.just_pushed()) put({ButtonPush, BUTTON_LEARN});
     else if (Buttons::learn_.just_released()) put({ButtonRelease, BUTTON_LEARN});
@@ -82,7 +85,8 @@ struct ButtonsEventSource : EventSource<Event>, Buttons {
 
 template<class Switch, EventType event>
 struct SwitchEventSource : EventSource<Event>, Switch {
-  void Poll(std::function<void(Event)> const& put) {
+  template<class Put>
+  void Poll(Put const& put) {
     Switch::Debounce();
     if (Switch::just_switched_up()) put({event, Switches::UP});
     else if (Switch::just_switched_mid()) put({event, Switches::MID});
@@ -97,7 +101,8 @@ struct SwitchesEventSource : EventSource<Event>, Switches {
   SwitchEventSource<Twist, SwitchTwist> twist_;
   SwitchEventSource<Warp, SwitchWarp> warp_;
 
-  void Poll(std::function<void(Event)> const& put) {
+  template<class Put>
+  void Poll(Put const& put) {
     scale_.Poll(put);
     mod_.Poll(put);
     twist_.Poll(put);
@@ -105,21 +110,42 @@ struct SwitchesEventSource : EventSource<Event>, Switches {
   }
 };
 
-template<int update_rate, int block_size>
-class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
+template<int update_rate>
+class Ui : public EventHandler<Ui<update_rate>, Event> {
   using Base = EventHandler<Ui, Event>;
   friend Base;
 
+  // params_ belongs to the control context (Poll, Handle); the audio
+  // context renders from its own copy, refreshed once per block from
+  // the last complete snapshot published by Poll
   Parameters params_;
+  Parameters audio_params_;
+  Snapshot<Parameters> params_snapshot_;
   Leds leds_;
-  PolypticOscillator<block_size> osc_ {params_};
+  PolypticOscillator osc_ {audio_params_};
 
   Persistent<WearLevel<FlashBlock<1, Parameters::AltParameters>>>
   alt_params_ {&params_.alt, params_.default_alt};
 
-  static constexpr int kProcessRate = kSampleRate / block_size;
-  static constexpr int kLongPressTime = 4.0f * kProcessRate; // sec
-  static constexpr int kNewNoteDelayTime = 0.01f * kProcessRate; // sec
+  // chosen by holding Learn at boot: the Twist switch then picks the
+  // audio block size among kBlockSizes (up, mid, down), and the Warp
+  // switch the low-latency CV mode (up) or the default one
+  struct AudioSettings {
+    int block_size;
+    int fast_cv;
+    bool validate() {
+      return valid_block_size(block_size) && (fast_cv == 0 || fast_cv == 1);
+    }
+  };
+  AudioSettings audio_settings_;
+  AudioSettings default_audio_settings_ = {kBlockSize, 0};
+
+  Persistent<WearLevel<FlashBlock<4, AudioSettings>>>
+  audio_settings_storage_ {&audio_settings_, default_audio_settings_};
+
+  // Poll runs once per block: delays are counted in blocks
+  int long_press_time() { return 4 * kSampleRate / block_size(); }
+  int new_note_delay_time() { return kSampleRate / 100 / block_size(); }
 
   f cached_pitch_base_;
 
@@ -146,6 +172,13 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
   Persistent<WearLevel<FlashBlock<3, LedCalibrationData>>>
   led_calibration_data_storage_ {&led_calibration_data_, default_led_calibration_data_};
 
+  // the stored settings, read by the main loop while audio runs on the
+  // defaults (see LoadStored)
+  Parameters::AltParameters stored_alt_;
+  LedCalibrationData stored_led_calibration_data_;
+  std::atomic<bool> stored_loaded_ {false};
+  bool stored_applied_ = false;
+
   LedManager<update_rate, Leds::Learn> learn_led_ {led_calibration_data_.led_learn_adjust};
   LedManager<update_rate, Leds::Freeze> freeze_led_ {led_calibration_data_.led_freeze_adjust};
 
@@ -153,13 +186,14 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
   typename Base::DelayedEventSource new_note_delay_;
   ButtonsEventSource buttons_;
   SwitchesEventSource switches_;
-  Control<block_size> control_ {params_, osc_};
+  Control control_ {params_, osc_};
 
-  EventSource<Event>* sources_[6] = {
-    &buttons_, &switches_,
-    &button_timeouts_[0], &button_timeouts_[1],
-    &control_, &new_note_delay_
-  };
+  // polled in this order
+  auto sources() {
+    return std::tie(buttons_, switches_,
+                    button_timeouts_[0], button_timeouts_[1],
+                    control_, new_note_delay_);
+  }
 
   enum Mode {
     NORMAL,
@@ -207,7 +241,7 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
         learn_led_.flash(Colors::white);
     } break;
     case ButtonPush: {
-      button_timeouts_[e1.data].trigger_after(kLongPressTime, {ButtonTimeout, e1.data});
+      button_timeouts_[e1.data].trigger_after(long_press_time(), {ButtonTimeout, e1.data});
     } break;
     case SwitchScale: {
       params_.scale.mode =
@@ -254,7 +288,7 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
             e2.type == ButtonPush &&
             e2.data == BUTTON_LEARN) {
           // long-press on Learn
-          osc_.reset_current_scale();
+          osc_.reset_current_scale(params_.scale);
           control_.all_main_function();
           learn_led_.flash(Colors::blue, 2_f);
         }
@@ -277,7 +311,7 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
           learn_led_.set_solid(Colors::dark_red);
           osc_.enable_learn();
           f cur_pitch = osc_.lowest_pitch();
-          osc_.new_note(cur_pitch);
+          osc_.new_note(params_.scale, cur_pitch);
           learn_led_.flash(Colors::white);
           mode_ = MANUAL_LEARN;
           learn_led_.set_glow(Colors::red, 3_f);
@@ -319,6 +353,11 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
             freeze_led_.set_solid(osc_.frozen() ? Colors::blue : Colors::black);
             mode_ = NORMAL;
             control_.all_main_function();
+          } else if (e2.type == ButtonTimeout &&
+                     e2.data == BUTTON_FREEZE) {
+            // Released after a long-press
+            mode_ = NORMAL;
+            control_.all_main_function();
           } else {
             // Released after a change
             mode_ = NORMAL;
@@ -338,6 +377,16 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
           freeze_led_.set_background(Colors::black);
           control_.calibration_reset();
           control_.next_calibration();
+        } else if (e1.data == BUTTON_FREEZE &&
+                   e2.type == ButtonPush &&
+                   e2.data == BUTTON_FREEZE) {
+          // long-press on Freeze: the Freeze gate toggles Freeze,
+          // then resets the phases (white), then resets them smoothly
+          // (cyan); not saved
+          SyncMode mode = SyncMode((osc_.sync_mode() + 1) % 3);
+          osc_.set_sync_mode(mode);
+          freeze_led_.flash(mode == SYNC_OFF ? Colors::black :
+                            mode == SYNC_HARD ? Colors::white : Colors::cyan, 2_f);
         }
       } break;
       case AltParamChange: {
@@ -349,10 +398,10 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
     case LEARN: {
       switch(e1.type) {
       case NewNoteAfterDelay: {
-        new_note_delay_.trigger_after(kNewNoteDelayTime, {NewNote, 0});
+        new_note_delay_.trigger_after(new_note_delay_time(), {NewNote, 0});
       } break;
       case NewNote: {
-        bool success = osc_.new_note(control_.pitch_cv() + cached_pitch_base_);
+        bool success = osc_.new_note(params_.scale, control_.pitch_cv() + cached_pitch_base_);
         osc_.enable_pre_listen();
         learn_led_.flash(success ? Colors::white : Colors::black);
       } break;
@@ -364,9 +413,9 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
           if (osc_.empty_pre_scale()) {
             // if scale is empty, add note with current pitch
             f cur_pitch = osc_.lowest_pitch();
-            osc_.new_note(cur_pitch);
+            osc_.new_note(params_.scale, cur_pitch);
           }
-          if (osc_.new_note(0_f)) {
+          if (osc_.new_note(params_.scale, 0_f)) {
             learn_led_.flash(Colors::white);
             mode_ = MANUAL_LEARN;
             learn_led_.set_glow(Colors::red, 3_f);
@@ -391,7 +440,7 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
             e2.data == BUTTON_LEARN) {
           // Learn pressed
           mode_ = NORMAL;
-          bool success = osc_.disable_learn();
+          bool success = osc_.disable_learn(params_.scale);
           if (success) learn_led_.flash(Colors::green, 2_f);
           control_.release_pitch_cv();
           control_.all_main_function();
@@ -505,8 +554,26 @@ class Ui : public EventHandler<Ui<update_rate, block_size>, Event> {
     }
   }
 
+  // control context: the stored settings replace the defaults once
+  // the output is silent, then it fades back in
+  void ApplyStored() {
+    osc_.duck(true);
+    if (!osc_.ducked()) return;
+    params_.alt = stored_alt_;
+    led_calibration_data_ = stored_led_calibration_data_;
+    control_.ApplyStored();
+    osc_.ApplyStored();
+    osc_.duck(false);
+    stored_applied_ = true;
+    BootStamp(BOOT_STORED);
+  }
+
 public:
   Ui() {
+    // the block size and CV mode are needed before audio starts; the
+    // other stores are loaded later (see LoadStored)
+    audio_settings_storage_.Load();
+
     // Initialize switches to their current positions
     Base::put({SwitchScale, switches_.scale_.get()});
     Base::put({SwitchMod, switches_.mod_.get()});
@@ -514,6 +581,16 @@ public:
     Base::put({SwitchWarp, switches_.warp_.get()});
     Base::Process();
 
+    // Pick the block size and CV mode if Learn is pushed
+    if (buttons_.learn_.pushed()) {
+      auto twist = switches_.twist_.get();
+      audio_settings_.fast_cv = switches_.warp_.get() == Switches::UP;
+      set_block_size(kBlockSizes[twist == Switches::UP ? 0 :
+                                 twist == Switches::MID ? 1 : 2]);
+      learn_led_.flash(Colors::white, 2_f);
+    }
+    control_.set_fast_cv(audio_settings_.fast_cv);
+    osc_.set_frequency_ramp(audio_settings_.fast_cv);
 
     // Enter LED calibration if Freeze is pushed and all switches are centered
     if (buttons_.freeze_.pushed() &&
@@ -527,14 +604,48 @@ public:
       learn_led_.set_background(Colors::lemon);
       freeze_led_.set_background(Colors::lemon);
     }
+
+    params_snapshot_.Write(params_);
+    audio_params_ = params_;
+  }
+
+  PolypticOscillator& osc() { return osc_; }
+
+  // block size the audio should run at; Main restarts the DAC when it
+  // changes
+  int block_size() { return audio_settings_.block_size; }
+
+  void set_block_size(int block_size) {
+    if (!valid_block_size(block_size)) return;
+    audio_settings_.block_size = block_size;
+    audio_settings_storage_.Save();
   }
 
-  PolypticOscillator<block_size>& osc() { return osc_; }
+  // main loop, once audio runs: reads the other stores, which scan the
+  // flash, into copies that Poll swaps in
+  void LoadStored() {
+    alt_params_.Load(&stored_alt_);
+    led_calibration_data_storage_.Load(&stored_led_calibration_data_);
+    control_.LoadStored();
+    osc_.LoadStored();
+    stored_loaded_.store(true, std::memory_order_release);
+  }
+
+  // audio context, at the start of each block
+  void AcquireParameters() {
+    audio_params_ = params_snapshot_.Read();
+  }
 
+  // control context, once per block, preemptible by audio
   void Poll() {
+    ProfileScope profile {PROFILE_UI_POLL};
+    if (!stored_applied_ && stored_loaded_.load(std::memory_order_acquire))
+      ApplyStored();
     control_.ProcessSpiAdcInput();
+    control_.set_block_size(block_size());
     Base::Poll();
     freeze_led_.set_solid(osc_.frozen() ? Colors::blue : Colors::black);
+    params_snapshot_.Write(params_);
   }
   
   void Update() {
@@ -0,0 +1,264 @@
+#include <cstdio>
+#include <cmath>
+#include <chrono>
+#include <complex>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "oscillator.hh"
+#include "check.hh"
+
+// Host measurement of the antialiasing of the warp modes. A voice
+// renders a warped sine whose period divides the analysis window
+// exactly, so that its harmonics fall on bins of their own: every
+// other bin is an alias. For each mode, amount and pitch, compares
+// the band-limited waveshapers to the frequency fades they replace
+// (the full shapers, with the amount faded out as the pitch rises),
+// on three counts: the aliases and the harmonics of the warp, both
+// relative to the whole signal, and the time per sample.
+//
+// Checks that the bands keep the aliases down everywhere, to the
+// floor of the tables themselves (their interpolation, at the lowest
+// pitch), and that below their limit they keep the harmonics of the
+// full shaper, as rendered at the lowest pitch. Only near full amount:
+// fold scales its input by the amount, and on a smaller sine the
+// truncated series, still band-limited, no longer matches the
+// harmonics of the full shaper.
+//
+// Then sweeps the pitch over the octaves of the bands, and checks that
+// the shapers never step: the bands must crossfade their levels, which
+// would otherwise switch at the top of each octave. A step keeps its
+// size at any resolution of the sweep, where a slope shrinks with it.
+
+constexpr int kWindow = 4096;
+constexpr int kBlock = 32;
+constexpr int kSettle = 8;      // blocks, for the ramps to settle
+constexpr int kRuns = 50;       // of the window, timed
+constexpr int kSweepOctaves = 8;        // from 47 Hz
+constexpr int kSweepPoints = 65;        // of the sine
+
+using Bank = OscillatorBank<1>;
+
+// the per-voice fades of the amount, before the bands
+namespace fudge {
+  f warp(WarpMode mode, f freq, f amount) {
+    switch (mode) {
+    case FOLD:
+      return (amount * (1_f - 8_f * freq).max(0_f).square().square()).max(0.004_f);
+    case CHEBY:
+      return amount * (1_f - 6_f * freq).max(0_f);
+    default:
+      return amount * (1_f - 4_f * freq).cube().max(0_f);
+    }
+  }
+}
+
+static f frequency(int bin) { return f(bin) / f(kWindow); }
+
+struct Render {
+  double out[kWindow];
+  double ns_per_sample;
+};
+
+// renders [bin] periods of the sine warped by [amount] in the window,
+// with the band-limited shapers or the full ones
+static void render(Render& r, WarpMode mode, f amount, int bin, bool bands) {
+  static Bank bank;
+  static Buffer<u0_16, kMaxBlockSize> mod_in, mod_out;
+  static Buffer<f, kMaxBlockSize> out;
+  for (auto& m : mod_in) m = 0._u0_16;
+
+  DynamicData::bands_ready.store(bands);
+  Bank::Voice v = {frequency(bin), 0_f, amount, 0_f, 1_f, 1_f, false, true,
+                   &mod_in, &mod_out, &out};
+
+  auto block = [&]() {
+    for (int s=0; s<kBlock; s++) out[s] = 0_f;
+    bank.Process<kBlock>(FEEDBACK, true, mode, false, false, &v, 1);
+  };
+
+  for (int b=0; b<kSettle; b++) block();
+  for (int b=0; b<kWindow / kBlock; b++) {
+    block();
+    for (int s=0; s<kBlock; s++)
+      r.out[b * kBlock + s] = out[s].repr();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i=0; i<kRuns * kWindow / kBlock; i++) block();
+  std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+  r.ns_per_sample = t.count() / (kRuns * kWindow);
+}
+
+static void fft(std::complex<double> *x, int n) {
+  for (int i=1, j=0; i<n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(x[i], x[j]);
+  }
+  for (int len=2; len<=n; len<<=1) {
+    std::complex<double> w = std::polar(1.0, -2 * M_PI / len);
+    for (int i=0; i<n; i+=len) {
+      std::complex<double> wk = 1;
+      for (int k=0; k<len/2; k++) {
+        auto a = x[i+k], b = x[i+k+len/2] * wk;
+        x[i+k] = a + b;
+        x[i+k+len/2] = a - b;
+        wk *= w;
+      }
+    }
+  }
+}
+
+static double dB(double x) { return 10 * std::log10(x + 1e-30); }
+
+struct Spectrum {
+  double magnitude[kWindow / 2];  // as if the voice was not faded
+  double aliases;               // dB, relative to the whole signal
+  double warp;                  // dB, harmonics above the fundamental
+
+  Spectrum(Render const& r, int bin) {
+    static std::complex<double> x[kWindow];
+    for (int i=0; i<kWindow; i++) x[i] = r.out[i];
+    fft(x, kWindow);
+    double const fade = Antialias::freq(frequency(bin), 1_f).repr();
+    double total = 0, alias = 0, harmonics = 0;
+    // DC and the harmonics fall on multiples of [bin]
+    for (int i=1; i<kWindow/2; i++) {
+      magnitude[i] = std::abs(x[i]) / fade;
+      double e = std::norm(x[i]);
+      total += e;
+      if (i % bin) alias += e;
+      else if (i > bin) harmonics += e;
+    }
+    aliases = dB(alias / total);
+    warp = dB(harmonics / total);
+  }
+
+  // error of the first [n] harmonics against [reference]'s, in dB
+  double error(int bin, Spectrum const& reference, int reference_bin, int n) const {
+    double e = 0, sum = 0;
+    for (int h=1; h<=n && h*bin < kWindow/2; h++) {
+      double a = magnitude[h * bin], r = reference.magnitude[h * reference_bin];
+      e += (a - r) * (a - r);
+      sum += r * r;
+    }
+    return dB(e / sum);
+  }
+};
+
+static Band band(f freq) {
+  DynamicData::bands_ready.store(true);
+  return Antialias::band(u0_32(freq));
+}
+
+static f warp(WarpMode mode, Band band, f amount) {
+  switch (mode) {
+  case FOLD: return Antialias::warp<FOLD>(band, amount);
+  case CHEBY: return Antialias::warp<CHEBY>(band, amount);
+  default: return Antialias::warp<SEGMENT>(band, amount);
+  }
+}
+
+static f shaper(WarpMode mode, s1_15 x, f amount, Band band) {
+  switch (mode) {
+  case FOLD: return Distortion::at_band<FOLD>(x, amount, band);
+  case CHEBY: return Distortion::warp<CHEBY>(x, amount, band.level);
+  default: return Distortion::at_band<SEGMENT>(x, amount, band);
+  }
+}
+
+// largest step of the shaper over the sine between two pitches
+// [cents] apart, with the bands as they are, or without their
+// crossfades
+static double sweep(WarpMode mode, f amount, bool crossfade, double cents) {
+  static f previous[kSweepPoints];
+  DynamicData::bands_ready.store(true);
+  double worst = 0;
+  int const steps = int(kSweepOctaves * 1200 / cents);
+  for (int c=0; c<=steps; c++) {
+    f freq = f(float(std::exp2(c * cents / 1200 - 10)));
+    Band b = band(freq);
+    if (!crossfade) b.mix = 0_f;
+    f a = warp(mode, b, amount);
+    for (int i=0; i<kSweepPoints; i++) {
+      s1_15 x = s1_15::of_repr(int16_t(-32767 + i * 65534 / (kSweepPoints - 1)));
+      f y = shaper(mode, x, a, b);
+      if (c) worst = std::max(worst, double((y - previous[i]).abs().repr()));
+      previous[i] = y;
+    }
+  }
+  return worst;
+}
+
+int main() {
+  Math math;
+  DynamicData dynamic_data;
+  DynamicData::FillBands();
+
+  struct { WarpMode mode; char const *name; } const modes[] = {
+    {FOLD, "fold"}, {CHEBY, "cheby"}, {SEGMENT, "segment"},
+  };
+  // odd bins, so that no alias lands on a harmonic
+  int const bins[] = {9, 37, 149, 301, 601};
+  int const lowest = bins[0];
+  static Render faded, banded, full;
+
+  for (auto [mode, name] : modes) {
+    double ns_faded = 0, ns_banded = 0;
+    double worst_faded = -1000, worst_banded = -1000, worst_error = -1000;
+    printf("\n%-7s %6s %8s %5s | %9s %9s | %9s %9s %9s\n", name, "amount", "pitch",
+           "band", "alias dB", "warp dB", "alias dB", "warp dB", "error dB");
+    printf("%-7s %6s %8s %5s | %19s | %29s\n", "", "", "", "", "fades", "bands");
+    for (f amount : {0.5_f, 0.99_f}) {
+      for (int bin : bins) {
+        Band const b = band(frequency(bin));
+        f const a = warp(mode, b, amount);
+        render(faded, mode, fudge::warp(mode, frequency(bin), amount), bin, false);
+        render(banded, mode, a, bin, true);
+        // the full shaper, where it does not alias
+        render(full, mode, a, lowest, false);
+        Spectrum sf(faded, bin), sb(banded, bin), reference(full, lowest);
+        // the bins are clear of the glides between levels
+        int const level = b.level;
+        int const harmonics = level < kBandLevels ? 1 << level : kWindow;
+        double const error = sb.error(bin, reference, lowest, harmonics);
+
+        double pitch = double(bin) * kSampleRate / kWindow;
+        printf("%-7s %6.2f %5.0f Hz %5d | %9.1f %9.1f | %9.1f %9.1f %9.1f\n", "",
+               double(amount.repr()), pitch, level, sf.aliases, sf.warp,
+               sb.aliases, sb.warp, error);
+        ns_faded += faded.ns_per_sample;
+        ns_banded += banded.ns_per_sample;
+        worst_faded = std::max(worst_faded, sf.aliases);
+        worst_banded = std::max(worst_banded, sb.aliases);
+        if (bin != lowest && amount > 0.5_f) worst_error = std::max(worst_error, error);
+      }
+    }
+    int n = 2 * sizeof(bins) / sizeof(*bins);
+    printf("%-7s worst aliases: fades %.1f dB, bands %.1f dB\n", "",
+           worst_faded, worst_banded);
+    printf("%-7s time per sample: fades %.2f ns, bands %.2f ns\n", "",
+           ns_faded / n, ns_banded / n);
+
+    char what[80];
+    snprintf(what, sizeof(what), "%s: aliases of the bands below -45 dB", name);
+    check(worst_banded < -45, what);
+    snprintf(what, sizeof(what), "%s: bands keep the harmonics below their limit", name);
+    check(worst_error < -30, what);
+
+    double step = 0, fine_step = 0, level_step = 0;
+    for (f amount : {0.5_f, 0.99_f}) {
+      step = std::max(step, sweep(mode, amount, true, 1));
+      fine_step = std::max(fine_step, sweep(mode, amount, true, 0.1));
+      level_step = std::max(level_step, sweep(mode, amount, false, 0.1));
+    }
+    printf("%-7s largest step per cent %.4f, per 0.1 cent %.4f "
+           "(%.4f with the levels alone)\n", "", step, fine_step, level_step);
+    snprintf(what, sizeof(what), "%s: bands sweep without steps", name);
+    check(fine_step < step / 5, what);
+  }
+
+  return report();
+}
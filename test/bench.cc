@@ -0,0 +1,311 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <new>
+#include <algorithm>
+#include <iterator>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "polyptic_oscillator.hh"
+
+// Host benchmark: renders every combination of twist/warp/modulation
+// mode, number of oscillators, freeze state and block size, plus a
+// plain sine cluster with all three at rest, and reports the cost of
+// one call to PolypticOscillator::Process as CSV. The same duration of
+// audio is rendered at each block size, so that ns_per_sample compares
+// their throughput.
+//
+// When built with PROFILE, the average cost of each profiled region
+// (see ProfileRegion) is appended to every row.
+//
+// The checksums double as a golden set: --golden writes those of a
+// subset of the configurations, and --check (run by make check)
+// renders them again and fails on any difference. They pin the output
+// of this host build, with the -ffast-math of the firmware: any change
+// to the rendering shows, on purpose, and must be written again with
+// make golden. Other compilers or flags may reassociate the float
+// arithmetic, and differ in the last bits.
+//
+// usage: bench [output.csv] [blocks of kBlockSize]
+//        bench --golden set.csv
+//        bench --check set.csv
+
+constexpr int kRepetitions = 5;
+constexpr int kWarmupBlocks = 1024;     // of kBlockSize
+constexpr int kGoldenBlocks = 8;        // of kBlockSize
+constexpr int kGoldenNumOsc[] = {1, 7, kMaxNumOsc};
+
+static char const *twist_names[] = {"feedback", "pulsar", "crush"};
+static char const *warp_names[] = {"fold", "cheby", "segment"};
+static char const *modulation_names[] = {"one", "two", "three"};
+
+// mid-course pot values, scaled like Control::Poll does
+static f twist_value(TwistMode mode) {
+  f x = 0.5_f;
+  return
+    mode == FEEDBACK ? x * x * 0.7_f :
+    mode == PULSAR ? Math::fast_exp2(x * x * 6_f) :
+    x * x * 0.5_f;
+}
+
+static f warp_value(WarpMode mode) {
+  f x = 0.5_f;
+  return mode == FOLD ? x * x * 0.9_f + 0.004_f : x;
+}
+
+static f modulation_value(ModulationMode mode, int numOsc) {
+  f x = 0.5_f * 6_f / f(numOsc);
+  return
+    mode == ONE ? x * 6_f :
+    mode == TWO ? x * 0.9_f :
+    x * 4_f;
+}
+
+struct Config {
+  TwistMode twist;
+  WarpMode warp;
+  ModulationMode modulation;
+  int numOsc;
+  bool frozen;
+  bool rest;
+  int block_size;
+};
+
+struct Result {
+  double ns_per_block;
+  uint32_t checksum;
+  ProfileCounter profile[kNumProfileRegions];
+};
+
+static char const *profile_names[] = {
+  "block", "oscillators", "pairs", "bank", "output",
+};
+
+template<int block_size>
+static Result run(Config const &c, int blocks) {
+  Parameters params = {
+    .balance = 1_f,
+    .root = 30_f,
+    .pitch = 30_f,
+    .spread = 3_f,
+    .detune = 0.05_f,
+    .modulation = {.mode = c.modulation,
+                   .value = c.rest ? 0_f : modulation_value(c.modulation, c.numOsc)},
+    .scale = {.mode = TWELVE, .value = 0},
+    .twist = {.mode = c.twist, .value = c.rest ? 0_f : twist_value(c.twist)},
+    .warp = {.mode = c.warp, .value = c.rest ? 0.004_f : warp_value(c.warp)},
+    .alt = {
+      .numOsc = c.numOsc,
+      .stereo_mode = ALTERNATE,
+      .freeze_mode = LOW_HIGH,
+      .crossfade_factor = 0.125_f,
+    },
+    .new_note = 42_f,
+    .fine_tune = 0.5_f,
+  };
+
+  // on the module, the oscillator lives in zero-initialized static
+  // memory; reproduce this so that results are deterministic
+  using Osc = PolypticOscillator;
+  alignas(Osc) static uint8_t storage[sizeof(Osc)];
+  memset(storage, 0, sizeof(storage));
+  // the compiler may otherwise drop the memset as a dead store before
+  // the constructor (-flifetime-dse)
+  asm volatile("" : : "r"(storage) : "memory");
+  Osc &osc = *new (storage) Osc(params);
+  osc.set_freeze(c.frozen);
+
+  Buffer<Frame, block_size> out;
+  uint32_t checksum = 0;
+  blocks = blocks * kBlockSize / block_size;
+
+  for (int i=0; i<kWarmupBlocks * kBlockSize / block_size; i++)
+    osc.Process<block_size>(out.data());
+  memset(profile_table, 0, sizeof(profile_table));
+
+  double best = 1e30;
+  for (int r=0; r<kRepetitions; r++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i=0; i<blocks; i++) {
+      osc.Process<block_size>(out.data());
+      for (auto o : out)
+        checksum = checksum * 31 + o.l.repr() * 7 + o.r.repr();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    best = std::min(best, ns / blocks);
+  }
+
+  Result result = {best, checksum};
+  std::copy_n(profile_table, kNumProfileRegions, result.profile);
+  return result;
+}
+
+static Result run(Config const &c, int blocks) {
+  Result result;
+  with_block_size(c.block_size, [&](auto size) {
+    result = run<decltype(size)::value>(c, blocks);
+  });
+  return result;
+}
+
+static char const *golden_header = "twist,warp,modulation,num_osc,frozen,block_size,checksum\n";
+
+// every mode, frozen or not, at every block size, for a few numbers
+// of oscillators; then the plain sine cluster
+template<class F>
+static void golden_configs(F f) {
+  for (int t=0; t<3; t++)
+    for (int w=0; w<3; w++)
+      for (int m=0; m<3; m++)
+        for (int n : kGoldenNumOsc)
+          for (int fr=0; fr<2; fr++)
+            for (int b : kBlockSizes)
+              f(Config{TwistMode(t), WarpMode(w), ModulationMode(m), n, bool(fr), false, b});
+  for (int n : kGoldenNumOsc)
+    for (int fr=0; fr<2; fr++)
+      for (int b : kBlockSizes)
+        f(Config{FEEDBACK, FOLD, TWO, n, bool(fr), true, b});
+}
+
+static void print_golden(FILE *out, Config const &c, uint32_t checksum) {
+  fprintf(out, "%s,%s,%s,%d,%d,%d,%08x\n",
+          c.rest ? "rest" : twist_names[c.twist],
+          c.rest ? "rest" : warp_names[c.warp],
+          c.rest ? "rest" : modulation_names[c.modulation],
+          c.numOsc, c.frozen, c.block_size, checksum);
+}
+
+static int golden(char const *filename) {
+  FILE *out = fopen(filename, "w");
+  if (out == NULL) {
+    fprintf(stderr, "cannot open %s\n", filename);
+    return 1;
+  }
+  fputs(golden_header, out);
+  golden_configs([&](Config const &c) {
+    print_golden(out, c, run(c, kGoldenBlocks).checksum);
+  });
+  fclose(out);
+  return 0;
+}
+
+static int lookup(char const *name, char const *const *names, int n) {
+  for (int i=0; i<n; i++)
+    if (strcmp(name, names[i]) == 0) return i;
+  return -1;
+}
+
+static int check(char const *filename) {
+  FILE *in = fopen(filename, "r");
+  if (in == NULL) {
+    fprintf(stderr, "cannot open %s\n", filename);
+    return 1;
+  }
+
+  char line[256];
+  int failures = 0, count = 0;
+  fgets(line, sizeof(line), in); // header
+  while (fgets(line, sizeof(line), in)) {
+    char t[16], w[16], m[16];
+    int n, frozen, b;
+    unsigned expected;
+    if (sscanf(line, "%15[^,],%15[^,],%15[^,],%d,%d,%d,%x",
+               t, w, m, &n, &frozen, &b, &expected) != 7) {
+      fprintf(stderr, "malformed line: %s", line);
+      fclose(in);
+      return 1;
+    }
+    bool rest = strcmp(t, "rest") == 0;
+    int ti = rest ? FEEDBACK : lookup(t, twist_names, 3);
+    int wi = rest ? FOLD : lookup(w, warp_names, 3);
+    int mi = rest ? TWO : lookup(m, modulation_names, 3);
+    if (ti < 0 || wi < 0 || mi < 0 || n < 1 || n > kMaxNumOsc ||
+        std::find(std::begin(kBlockSizes), std::end(kBlockSizes), b) == std::end(kBlockSizes)) {
+      fprintf(stderr, "malformed line: %s", line);
+      fclose(in);
+      return 1;
+    }
+    Config c = {TwistMode(ti), WarpMode(wi), ModulationMode(mi), n, bool(frozen), rest, b};
+    uint32_t checksum = run(c, kGoldenBlocks).checksum;
+    count++;
+    if (checksum != expected) {
+      printf("DIFFERS: %08x instead of ", checksum);
+      print_golden(stdout, c, expected);
+      failures++;
+    }
+  }
+  fclose(in);
+
+  printf("%d of %d configurations differ from %s\n", failures, count, filename);
+  printf(failures ? "FAIL\n" : "OK\n");
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+  Math math;
+  DynamicData dynamic_data;
+  // as once the main loop runs
+  DynamicData::FillBands();
+
+  if (argc > 1 && (strcmp(argv[1], "--golden") == 0 || strcmp(argv[1], "--check") == 0)) {
+    if (argc < 3) {
+      fprintf(stderr, "usage: %s %s set.csv\n", argv[0], argv[1]);
+      return 1;
+    }
+    return strcmp(argv[1], "--golden") == 0 ? golden(argv[2]) : check(argv[2]);
+  }
+
+  FILE *out = argc > 1 ? fopen(argv[1], "w") : stdout;
+  if (out == NULL) {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    return 1;
+  }
+  int blocks = argc > 2 ? atoi(argv[2]) : 1000;
+
+  fprintf(out, "twist,warp,modulation,num_osc,frozen,block_size,"
+          "ns_per_block,ns_per_sample,deadline_pct,checksum");
+#ifdef PROFILE
+  for (auto name : profile_names)
+    fprintf(out, ",%s_ns", name);
+#endif
+  fprintf(out, "\n");
+
+  auto print = [&](char const *t, char const *w, char const *m,
+                   Config const &c, Result const &r) {
+    double deadline = 1e9 * c.block_size / kSampleRate; // ns
+    fprintf(out, "%s,%s,%s,%d,%d,%d,%.1f,%.2f,%.2f,%08x",
+            t, w, m, c.numOsc, c.frozen, c.block_size,
+            r.ns_per_block, r.ns_per_block / c.block_size,
+            100.0 * r.ns_per_block / deadline,
+            r.checksum);
+#ifdef PROFILE
+    for (int i=0; i<int(std::size(profile_names)); i++)
+      fprintf(out, ",%u", r.profile[i].avg());
+#endif
+    fprintf(out, "\n");
+  };
+
+  for (int t=0; t<3; t++)
+    for (int w=0; w<3; w++)
+      for (int m=0; m<3; m++)
+        for (int n=1; n<=kMaxNumOsc; n++)
+          for (int fr=0; fr<2; fr++)
+            for (int b : kBlockSizes) {
+              Config c = {TwistMode(t), WarpMode(w), ModulationMode(m), n, bool(fr), false, b};
+              print(twist_names[t], warp_names[w], modulation_names[m], c, run(c, blocks));
+            }
+
+  // plain sine cluster
+  for (int n=1; n<=kMaxNumOsc; n++)
+    for (int fr=0; fr<2; fr++)
+      for (int b : kBlockSizes) {
+        Config c = {FEEDBACK, FOLD, TWO, n, bool(fr), true, b};
+        print("rest", "rest", "rest", c, run(c, blocks));
+      }
+
+  if (out != stdout) fclose(out);
+  return 0;
+}
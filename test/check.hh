@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdio>
+
+// Checks of the host unit tests: each one prints its outcome, and
+// main returns report(), which sums them up as OK or FAIL
+
+static int failures = 0;
+
+static void check(bool ok, char const *what) {
+  printf("%s: %s\n", ok ? "ok  " : "FAIL", what);
+  if (!ok) failures++;
+}
+
+static int report() {
+  printf(failures ? "FAIL\n" : "OK\n");
+  return failures ? 1 : 0;
+}
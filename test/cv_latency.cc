@@ -0,0 +1,150 @@
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <new>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "polyptic_oscillator.hh"
+#include "ext_cv_conditioner.hh"
+#include "simulated_spi.hh"
+#include "check.hh"
+
+// Host harness for the latency of the pitch CV, from the jack to the
+// oscillator. A step of one octave is fed into the simulated ADC; the
+// words are decoded, filtered and turned into a pitch with the
+// cadence and the filters of Control, and the parameters reach a
+// PolypticOscillator one block later, as when Poll runs after the
+// audio block. The frequency of the output is measured from its zero
+// crossings, and the time until it stays within a tenth of a semitone
+// of the new pitch is reported, in the default and the low-latency CV
+// modes.
+
+using Stream = Max11666Stream;
+
+// default calibration
+static f pitch_offset = 0.704_f, pitch_slope = -112.73_f;
+
+// ADC codes of the step: 12 semitones up, the CV being inverted
+constexpr int kCodeBefore = 0x800;
+constexpr int kCodeAfter = kCodeBefore - 436;
+
+// the step comes after a few blocks of recording
+constexpr int kRecordSamples = 4096;
+constexpr int kStepSample = 512;
+
+template<int block_size>
+static int latency(bool fast, f *octave) {
+  Parameters params = {
+    .balance = 1_f,
+    .root = 12_f,
+    .pitch = 53_f,
+    .spread = 0_f,
+    .detune = 0_f,
+    .modulation = {.mode = ONE, .value = 0_f},
+    .scale = {.mode = TWELVE, .value = 0},
+    .twist = {.mode = FEEDBACK, .value = 0_f},
+    .warp = {.mode = CHEBY, .value = 0_f},
+    .alt = {
+      .numOsc = 1,
+      .stereo_mode = ALTERNATE,
+      .freeze_mode = LOW_HIGH,
+      .crossfade_factor = 0.125_f,
+    },
+    .new_note = 0_f,
+    .fine_tune = 0_f,
+  };
+  f const base_pitch = params.pitch;
+
+  using Osc = PolypticOscillator;
+  alignas(Osc) static uint8_t storage[sizeof(Osc)];
+  memset(storage, 0, sizeof(storage));
+  asm volatile("" : : "r"(storage) : "memory");
+  Osc &osc = *new (storage) Osc(params);
+  osc.set_frequency_ramp(fast);
+
+  static SimulatedSpi spi;
+  static Stream stream;
+  spi = SimulatedSpi();
+  stream = Stream();
+  // the integrators of Average never forget their initial state,
+  // which the firmware gets zeroed
+  using Conditioner = ExtCVConditioner<CV_PITCH, Average<4, 4>, Average<3, 2>, Stream>;
+  alignas(Conditioner) static uint8_t cv_storage[sizeof(Conditioner)];
+  memset(cv_storage, 0, sizeof(cv_storage));
+  Conditioner &pitch_cv = *new (cv_storage) Conditioner(pitch_offset, pitch_slope, stream);
+  pitch_cv.set_fast(fast);
+  bool chan = false;
+
+  Buffer<Frame, block_size> out;
+  static float record[kRecordSamples];
+  int recorded = -1;
+
+  // 96k words per second, two per sample
+  auto run = [&](int blocks) {
+    for (int b=0; b<blocks; b++) {
+      osc.Process<block_size>(out.data());
+      if (recorded >= 0)
+        for (auto o : out)
+          if (recorded < kRecordSamples) record[recorded++] = o.l.repr();
+
+      for (int i=0; i<2*block_size; i++) spi.Tick();
+      stream.Process(spi.rx, spi.position());
+      // as Control::ProcessSpiAdcInput
+      if (fast || chan) pitch_cv.Process();
+      chan = !chan;
+      params.pitch = base_pitch + pitch_cv.last();
+    }
+  };
+
+  spi.codes[CV_PITCH] = kCodeBefore;
+  run(20000 * kBlockSize / block_size);
+  recorded = 0;
+  run(kStepSample / block_size);
+  spi.codes[CV_PITCH] = kCodeAfter;
+  run((kRecordSamples - kStepSample) / block_size);
+
+  // interpolated upward zero crossings
+  static float crossings[kRecordSamples];
+  int n = 0;
+  for (int s=1; s<kRecordSamples; s++)
+    if (record[s-1] < 0 && record[s] >= 0)
+      crossings[n++] = float(s-1) + record[s-1] / (record[s-1] - record[s]);
+
+  // the periods before the step, and the last ones
+  int step = 0;
+  while (crossings[step+1] < kStepSample) step++;
+  float before = (crossings[step] - crossings[0]) / float(step);
+  float period = (crossings[n-1] - crossings[n/2]) / float(n-1 - n/2);
+  *octave = f(12.0f * log2f(before / period));
+
+  float tolerance = exp2f(0.1f / 12.0f) - 1.0f;
+  int settled = 0;
+  for (int k=1; k<n; k++)
+    if (fabsf((crossings[k] - crossings[k-1]) / period - 1.0f) > tolerance)
+      settled = k;
+  return int(crossings[settled]) - kStepSample;
+}
+
+template<int block_size>
+static void compare() {
+  f octave_standard, octave_fast;
+  int standard = latency<block_size>(false, &octave_standard);
+  int fast = latency<block_size>(true, &octave_fast);
+  printf("      block size %d: %d samples (%.1f ms), low-latency %d samples (%.1f ms)\n",
+         block_size, standard, 1000.0 * standard / kSampleRate,
+         fast, 1000.0 * fast / kSampleRate);
+  check((octave_standard - 12_f).abs() < 0.1_f &&
+        (octave_fast - 12_f).abs() < 0.1_f, "steps by an octave");
+  check(fast < standard, "low-latency mode settles sooner");
+}
+
+int main() {
+  Math math;
+  DynamicData dynamic_data;
+
+  compare<kBlockSize>();
+  compare<kMaxBlockSize>();
+
+  return report();
+}
@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include "parameters.hh"
+#include "dac_monitor.hh"
+
+// Host test for DacMonitor: simulates the circular DMA of the DAC, one
+// time unit per item sent, with an interrupt at each half and wrap
+// point. Callbacks have random durations, a few of them too long; the
+// monitor's counters must match the overruns seen by the simulation.
+// Runs at each block size the audio path can use.
+//
+// usage: dac_monitor [callbacks] [seed]
+
+constexpr uint32_t kItemsPerFrame = 2;
+
+struct Rng {
+  uint32_t state;
+  uint32_t next() { return state = state * 1664525 + 1013904223; }
+  uint32_t below(uint32_t n) { return (next() >> 8) % n; }
+};
+
+static bool run(int block_size, int callbacks, Rng rng) {
+  uint32_t const half_items = block_size * kItemsPerFrame;
+  uint32_t const total = 2 * half_items;
+
+  DacMonitor monitor {block_size};
+  uint32_t expected_overruns = 0, expected_max = 0;
+  uint64_t exit = 0;
+
+  for (int k=1; k<=callbacks; k++) {
+    // event k: DMA reached the middle (odd k, fill half 0) or wrapped
+    // (even k, fill half 1); the interrupt cannot preempt itself, so
+    // it runs once the previous callback has returned
+    uint64_t event = uint64_t(k) * half_items;
+    int half = k & 1 ? 0 : 1;
+    uint64_t start = std::max(event, exit);
+
+    // mostly well under budget; one in 50 takes up to 1.5 halves, but
+    // never right after a late one, which could make it more than half
+    // a buffer late (see DacMonitor)
+    uint32_t duration = start == event && rng.below(50) == 0 ?
+      half_items / 2 + rng.below(half_items) :
+      rng.below(half_items / 4);
+    exit = start + duration;
+
+    // the half must be written before the DMA comes back to it
+    uint64_t deadline = event + half_items;
+    if (exit >= deadline) {
+      uint32_t lateness = uint32_t(exit - deadline) / kItemsPerFrame;
+      expected_overruns++;
+      expected_max = std::max(expected_max, lateness);
+    }
+
+    uint32_t ndtr = total - uint32_t(exit % total);
+    monitor.Check(half, ndtr);
+  }
+
+  auto s = monitor.stats();
+  printf("block size %d: %u blocks, %u overruns (expected %u), "
+         "max lateness %u frames (expected %u)\n",
+         block_size, s.blocks, s.overruns, expected_overruns,
+         s.max_lateness, expected_max);
+
+  bool ok = s.blocks == uint32_t(callbacks) &&
+    s.overruns == expected_overruns &&
+    s.max_lateness == expected_max &&
+    expected_overruns > 0;
+
+  monitor.reset();
+  return ok && monitor.stats().blocks == 0 && monitor.stats().overruns == 0;
+}
+
+int main(int argc, char *argv[]) {
+  int callbacks = argc > 1 ? atoi(argv[1]) : 100000;
+  Rng rng {argc > 2 ? uint32_t(atoi(argv[2])) : 1};
+
+  bool ok = true;
+  for (int block_size : kBlockSizes)
+    ok &= run(block_size, callbacks, rng);
+
+  printf(ok ? "OK\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "edge_filter.hh"
+#include "check.hh"
+
+// Host test for EdgeFilter, with synthetic edge sequences: glitches
+// and bounces, edges lost to a full queue, and the scheduling of the
+// edges to the frame when the control context runs once per block,
+// as the gate jacks are handled on the module.
+
+constexpr int kGlitch = 8;
+using Filter = EdgeFilter<kGlitch>;
+using Edge = Filter::Edge;
+
+// runs the filter at [now] on every edge so far
+static std::vector<Edge> kept(Filter& filter, uint32_t now, bool level) {
+  std::vector<Edge> edges;
+  filter.Process(now, now + 1, level, [&](Edge e) { edges.push_back(e); });
+  return edges;
+}
+
+static void glitches() {
+  {
+    Filter filter;
+    filter.Put(100, true);
+    auto edges = kept(filter, 104, true);
+    check(edges.empty(), "waits for the level to hold");
+    edges = kept(filter, 108, true);
+    check(edges.size() == 1 && edges[0].time == 100 && edges[0].level,
+          "keeps an edge once the level held, with its time");
+    filter.Put(200, false);
+    filter.Put(300, true);
+    edges = kept(filter, 400, true);
+    check(edges.size() == 2 && edges[0].time == 200 && edges[1].time == 300,
+          "keeps edges in order");
+  }
+  {
+    Filter filter;
+    filter.Put(100, true);
+    filter.Put(103, false);
+    auto edges = kept(filter, 1000, false);
+    check(edges.empty(), "drops a short pulse");
+  }
+  {
+    Filter filter;
+    for (uint32_t t : {100, 101, 102, 104, 105})
+      filter.Put(t, t & 1);
+    auto edges = kept(filter, 1000, true);
+    check(edges.size() == 1 && edges[0].time == 105 && edges[0].level,
+          "keeps the last edge of a bounce");
+  }
+  {
+    // about to wrap
+    Filter filter;
+    filter.Put(0xFFFFFFFC, true);
+    auto edges = kept(filter, 0xFFFFFFFF, true);
+    bool waits = edges.empty();
+    edges = kept(filter, 4, true);
+    check(waits && edges.size() == 1 && edges[0].time == 0xFFFFFFFC,
+          "compares times across the wrap");
+  }
+  {
+    // a full queue drops the newest edges: the level read when
+    // processing makes up for the last one
+    Filter filter;
+    for (int i=0; i<17; i++)
+      filter.Put(100 + 20 * i, !(i & 1));
+    auto edges = kept(filter, 500, true);
+    bool level = filter.level();
+    edges = kept(filter, 510, true);
+    check(!level && edges.size() == 1 && edges[0].level && filter.level(),
+          "catches up with the input after lost edges");
+  }
+}
+
+// The module: at frame T a block starts playing and the previous one
+// is rendered; the control context then runs at T + c and handles
+// the edges due in the block rendered next, which starts at T + 2N
+static void scheduling(int block_size) {
+  int const latency = 3 * block_size + kGlitch;   // Gates::latency
+  Filter filter;
+  bool level = false;
+
+  // random input with pulses from 2 to 100 frames, some glitches
+  std::vector<Edge> input;
+  for (uint32_t t = 1000; t < 2000000; ) {
+    level = !level;
+    input.push_back({t, level});
+    t += 2 + rand() % 100;
+  }
+
+  // what a glitch filter with no latency keeps, shifted by [latency]
+  std::vector<uint32_t> expected;
+  bool kept_level = false;
+  for (size_t i=0; i<input.size(); i++) {
+    bool held = i + 1 == input.size() || input[i+1].time - input[i].time >= kGlitch;
+    if (held && input[i].level != kept_level) {
+      expected.push_back(input[i].time + latency);
+      kept_level = input[i].level;
+    }
+  }
+
+  std::vector<uint32_t> effects;
+  bool exact = true;
+  size_t next = 0;
+  level = false;
+  for (uint32_t T = 0; T < 2100000; T += block_size) {
+    uint32_t now = T + rand() % block_size;
+    // the interrupt has queued every edge so far
+    while (next < input.size() && input[next].time <= now) {
+      filter.Put(input[next].time, input[next].level);
+      level = input[next].level;
+      next++;
+    }
+    uint32_t start = T + 2 * block_size;
+    filter.Process(now, start, block_size, latency, level, [&](Edge e, int at) {
+      effects.push_back(start + at);
+      exact &= start + at == e.time + latency;
+    });
+  }
+
+  printf("      block size %d: %zu edges kept out of %zu, %d frames of latency\n",
+         block_size, effects.size(), input.size(), latency);
+  check(effects == expected, "keeps the edges a glitch filter keeps");
+  check(exact, "each at its frame, after a fixed latency");
+}
+
+int main() {
+  glitches();
+  for (int block_size : {8, 32, 64})
+    scheduling(block_size);
+
+  return report();
+}
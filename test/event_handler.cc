@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+#include "event_handler.hh"
+#include "check.hh"
+
+// Host test for EventHandler and SpscQueue. First a handler with a
+// few sources: sources are polled in order, every event is handled
+// once and in order alongside the previous one, and a full queue
+// drops the newest events. Then a producer thread and a consumer
+// thread check that the queue neither loses nor reorders nor tears
+// events when it does not overflow.
+//
+// usage: event_handler [events]
+
+struct Event {
+  int type;
+  int data;
+};
+
+// puts [count] events of its type per poll
+struct Counter : EventSource<Event> {
+  int type, count = 1, next = 0;
+  explicit Counter(int t) : type(t) {}
+  template<class Put>
+  void Poll(Put const& put) {
+    for (int i=0; i<count; i++) put({type, next++});
+  }
+};
+
+struct Handler : EventHandler<Handler, Event> {
+  using Base = EventHandler<Handler, Event>;
+  friend Base;
+
+  Counter a_ {1}, b_ {2};
+  Base::DelayedEventSource delay_;
+
+  Event handled[64];
+  Event previous[64];
+  int num_handled = 0;
+
+  auto sources() { return std::tie(a_, delay_, b_); }
+
+  void Handle(Base::EventStack stack) {
+    if (num_handled < 64) {
+      handled[num_handled] = stack.get(0);
+      previous[num_handled] = stack.get(1);
+    }
+    num_handled++;
+  }
+};
+
+static void handler() {
+  static Handler h;
+
+  h.delay_.trigger_after(0, {3, 0});
+  h.Poll();
+  h.Process();
+  check(h.num_handled == 3 &&
+        h.handled[0].type == 1 && h.handled[1].type == 3 && h.handled[2].type == 2,
+        "polls the sources in order");
+  check(h.previous[0].type == 0 &&
+        h.previous[1].type == 1 && h.previous[2].type == 3,
+        "hands each event with the previous one");
+
+  h.Poll();
+  h.Process();
+  check(h.num_handled == 5 && h.handled[3].type == 1 && h.handled[3].data == 1 &&
+        h.previous[3].type == 2, "keeps the previous event across polls");
+
+  h.num_handled = 0;
+  h.a_.count = kEventBufferSize;
+  h.Poll();
+  h.Process();
+  check(h.num_handled == kEventBufferSize && h.handled[kEventBufferSize-1].type == 1,
+        "drops events when full");
+  h.Process();
+  check(h.num_handled == kEventBufferSize, "handles each event once");
+}
+
+struct Record {
+  uint32_t seq, check;
+};
+
+static void threads(uint32_t events) {
+  static SpscQueue<Record, kEventBufferSize> queue;
+  std::atomic<bool> ordered {true}, whole {true};
+
+  std::thread producer([&] {
+    for (uint32_t i=0; i<events; ) {
+      if (queue.Put({i, ~i})) i++;
+      else std::this_thread::yield();
+    }
+  });
+
+  std::thread consumer([&] {
+    Record r;
+    for (uint32_t expected=0; expected<events; ) {
+      if (!queue.Get(r)) { std::this_thread::yield(); continue; }
+      if (r.check != ~r.seq) whole = false;
+      if (r.seq != expected) ordered = false;
+      expected++;
+    }
+  });
+
+  producer.join();
+  consumer.join();
+  check(whole, "never tears an event");
+  check(ordered && queue.empty(), "never loses nor reorders events");
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t events = argc > 1 ? atoi(argv[1]) : 1000000;
+
+  handler();
+  threads(events);
+
+  return report();
+}
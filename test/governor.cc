@@ -0,0 +1,157 @@
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "polyptic_oscillator.hh"
+#include "check.hh"
+
+// Host test for the CPU governor. First the ladder and its hysteresis
+// on a bare Governor, then the governor driving a real
+// PolypticOscillator, fed with the load of a synthetic cost model
+// computed from what each block actually rendered.
+
+static void ladder() {
+  constexpr int numOsc = 4;
+  Governor g;
+
+  g.Process(0.5_f, numOsc);
+  check(g.level() == 0, "stays at full quality under low load");
+
+  g.Process(0.9_f, numOsc);
+  check(g.level() == 1 && g.drop_quiet_partners() && g.shed_pairs(numOsc) == 0,
+        "first drops quiet partners");
+
+  g.Process(0.9_f, numOsc);
+  check(g.level() == 1, "waits for a step to take effect");
+
+  g.Process(1.1_f, numOsc);
+  check(g.level() == 2 && g.shed_pairs(numOsc) == 1, "then sheds voices, at once if late");
+
+  for (int i=0; i<10 * Governor::kSettleBlocks; i++)
+    g.Process(0.9_f, numOsc);
+  check(g.level() == numOsc + 1 && g.shed_pairs(numOsc) == numOsc - 1 &&
+        g.plain_high_voices(numOsc), "keeps one pair, then simplifies antialiasing");
+
+  for (int i=0; i<10 * Governor::kHoldBlocks; i++)
+    g.Process(0.7_f, numOsc);
+  check(g.level() == numOsc + 1, "holds its level between the thresholds");
+
+  for (int i=0; i<Governor::kHoldBlocks - 1; i++)
+    g.Process(0.5_f, numOsc);
+  check(g.level() == numOsc + 1, "steps up only after a long low load");
+  g.Process(0.5_f, numOsc);
+  check(g.level() == numOsc && !g.plain_high_voices(numOsc), "steps up one level at a time");
+
+  g.Process(0.5_f, 2);
+  check(g.level() == 3, "follows a smaller numOsc");
+
+  auto c = g.counters();
+  check(c.step_downs == uint32_t(numOsc + 1) && c.step_ups == 1 &&
+        c.max_level == uint32_t(numOsc + 1) && c.overloads == 1,
+        "counts its decisions");
+
+  // blocks of 64 samples
+  Governor h;
+  h.Process(0.9_f, numOsc, 8);
+  for (int i=0; i<Governor::kHoldBlocks / 8 - 1; i++)
+    h.Process(0.5_f, numOsc, 8);
+  check(h.level() == 1, "larger blocks: holds for as long");
+  h.Process(0.5_f, numOsc, 8);
+  check(h.level() == 0, "larger blocks: steps up after as long");
+}
+
+// cost of a block, relative to its deadline: a fixed part plus each
+// voice, silent ones being almost free and plain ones cheaper
+struct CostModel {
+  f base, voice;
+  f operator()(Oscillators::RenderStats const &s) const {
+    int shaped = 2 * s.pairs - s.silent_voices - s.plain_voices;
+    return base + voice * (f(shaped) + 0.4_f * f(s.plain_voices) +
+                           0.1_f * f(s.silent_voices));
+  }
+};
+
+template<int block_size>
+static void closed_loop(ModulationMode modulation) {
+  Parameters params = {
+    .balance = 1_f,
+    .root = 30_f,
+    .pitch = 30_f,
+    .spread = 3_f,
+    .detune = 0.05_f,
+    .modulation = {.mode = modulation, .value = 0.2_f},
+    .scale = {.mode = TWELVE, .value = 0},
+    .twist = {.mode = PULSAR, .value = 8_f},
+    .warp = {.mode = FOLD, .value = 0.3_f},
+    .alt = {
+      .numOsc = kMaxNumOsc,
+      .stereo_mode = ALTERNATE,
+      .freeze_mode = LOW_HIGH,
+      .crossfade_factor = 0.125_f,
+    },
+    .new_note = 42_f,
+    .fine_tune = 0.5_f,
+  };
+
+  using Osc = PolypticOscillator;
+  alignas(Osc) static uint8_t storage[sizeof(Osc)];
+  memset(storage, 0, sizeof(storage));
+  asm volatile("" : : "r"(storage) : "memory");
+  Osc &osc = *new (storage) Osc(params);
+  Buffer<Frame, block_size> out;
+
+  // 32 fully rendered voices cost 1.3 deadlines
+  CostModel heavy {0.05_f, 1.25_f / 32_f};
+  CostModel light {0.05_f, 0.3_f / 32_f};
+
+  int silent_blocks = 0;
+  int late_after_settling = 0, changes_after_settling = 0;
+  int previous_level = 0, min_pairs = kMaxNumOsc;
+  auto run = [&](CostModel const &model, int blocks, bool settling) {
+    blocks = blocks * kBlockSize / block_size;
+    for (int i=0; i<blocks; i++) {
+      osc.Process<block_size>(out.data());
+      bool silent = true;
+      for (auto o : out)
+        silent &= o.l.repr() == 0 && o.r.repr() == 0;
+      silent_blocks += silent;
+      f load = model(osc.render_stats());
+      osc.Govern(load, block_size);
+      min_pairs = std::min(min_pairs, osc.render_stats().pairs);
+      if (!settling && i > blocks / 2) {
+        if (load > 1_f) late_after_settling++;
+        if (osc.governor().level() != previous_level) changes_after_settling++;
+      }
+      previous_level = osc.governor().level();
+    }
+  };
+
+  run(heavy, 20000, false);
+  printf("      block size %d, heavy: level %d, %d pairs rendered\n",
+         block_size, osc.governor().level(), osc.render_stats().pairs);
+  check(osc.governor().level() > 0 && min_pairs < kMaxNumOsc, "steps down under heavy load");
+  check(late_after_settling == 0, "no late block once settled");
+  check(changes_after_settling == 0, "no oscillation once settled");
+
+  run(light, 60000, true);
+  check(osc.governor().level() == 0 && osc.render_stats().pairs == kMaxNumOsc,
+        "back to full quality under light load");
+
+  auto c = osc.governor().counters();
+  check(c.step_ups == c.step_downs, "as many steps up as down");
+  check(silent_blocks < 100, "keeps sounding");
+}
+
+int main() {
+  Math math;
+  DynamicData dynamic_data;
+
+  ladder();
+  for (auto m : {ONE, TWO, THREE})
+    closed_loop<kBlockSize>(m);
+  closed_loop<kMaxBlockSize>(TWO);
+
+  return report();
+}
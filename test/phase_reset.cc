@@ -0,0 +1,104 @@
+#include <cstdio>
+#include <cmath>
+#include <new>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "oscillator.hh"
+#include "check.hh"
+
+// Host test for the gate-triggered phase reset of OscillatorBank. Two
+// banks start from different random phases and render the same plain
+// sine; a reset at any sample of a block must bring them in step from
+// that very sample on, with the same waveform. The smooth reset
+// must leave no step in the output, and catch up with the hard one
+// once its window has passed.
+
+constexpr int kDeclick = 32;
+constexpr int kBlocks = 8;      // recorded, the reset in the second one
+constexpr int kRecord = kBlocks * kMaxBlockSize;
+constexpr int kAfter = 48;      // compared after each reset
+
+using Bank = OscillatorBank<1>;
+
+struct Voice {
+  Bank bank;
+  Buffer<u0_16, kMaxBlockSize> mod_in, mod_out;
+  Buffer<f, kMaxBlockSize> out;
+  float record[kRecord];
+
+  // renders kBlocks blocks, resetting the phase at [at] in the second
+  template<int block_size>
+  void Run(int at, int declick) {
+    for (auto& m : mod_in) m = 0._u0_16;
+    bank.set_declick(declick);
+    for (int b=0; b<kBlocks; b++) {
+      for (int s=0; s<block_size; s++) out[s] = 0_f;
+      Bank::Voice v = {0.01_f, 0_f, 0_f, 0_f, 1_f, 1_f, false, true,
+                       &mod_in, &mod_out, &out};
+      if (b == 1) bank.Reset(at);
+      bank.Process<block_size>(FEEDBACK, true, CHEBY, true, false, &v, 1);
+      for (int s=0; s<block_size; s++)
+        record[b * block_size + s] = out[s].repr();
+    }
+  }
+};
+
+template<int block_size>
+static void reset(int at) {
+  static Voice a, b, smooth;
+  // fresh banks, with random phases that differ
+  new (&a.bank) Bank();
+  new (&b.bank) Bank();
+  new (&smooth.bank) Bank();
+  a.Run<block_size>(at, 0);
+  b.Run<block_size>(at, 0);
+  smooth.Run<block_size>(at, kDeclick);
+
+  int const cut = block_size + at;
+  int const end = kBlocks * block_size;
+  bool differ = false, same = true;
+  for (int s=0; s<cut; s++) differ |= a.record[s] != b.record[s];
+  for (int s=cut; s<end; s++) same &= a.record[s] == b.record[s];
+
+  char what[80];
+  snprintf(what, sizeof(what), "block size %d, reset at %d: in step from that sample",
+           block_size, at);
+  // the same waveform from the reset on, wherever it falls
+  static float reference[kAfter];
+  static bool has_reference = false;
+  bool aligned = true;
+  for (int s=0; s<kAfter; s++) {
+    if (!has_reference) reference[s] = a.record[cut + s];
+    aligned &= a.record[cut + s] == reference[s];
+  }
+  has_reference = true;
+  check(differ && same && aligned, what);
+
+  // the smooth reset repeats the sample before it, then fades its
+  // offset out
+  bool continuous = smooth.record[cut] == smooth.record[cut-1];
+  bool caught_up = true;
+  for (int s=cut + kDeclick; s<end; s++)
+    caught_up &= fabsf(smooth.record[s] - a.record[s]) < 1e-5f;
+  snprintf(what, sizeof(what), "block size %d, reset at %d: smooth, without a step",
+           block_size, at);
+  check(continuous && caught_up, what);
+}
+
+template<int block_size>
+static void resets() {
+  for (int at : {0, 1, block_size / 2, block_size - 1})
+    reset<block_size>(at);
+}
+
+int main() {
+  Math math;
+  DynamicData dynamic_data;
+
+  resets<8>();
+  resets<32>();
+  resets<64>();
+
+  return report();
+}
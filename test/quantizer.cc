@@ -0,0 +1,95 @@
+#include <cstdio>
+#include <cmath>
+#include <random>
+#include "parameters.hh"
+#include "quantizer.hh"
+#include "check.hh"
+
+// Host test of IndexedScale against Scale::Process, over the default
+// scales and random learned ones, at random pitches. Both must give
+// the same pitch: only where a pitch falls on a degree, up to
+// rounding, may they pick the pairs on either side of it.
+//
+// Also counts the correction steps from the grid's guess to the
+// degree: at most one for the default scales, and for learned scales
+// at most one per degree that can share a cell (see IndexedScale).
+
+constexpr int kPitches = 20000;
+constexpr int kLearnedScales = 500;
+constexpr float kTolerance = 1e-4f;    // semitones
+
+static std::mt19937 rng(1);
+
+static float uniform(float lo, float hi) {
+  return std::uniform_real_distribution<float>(lo, hi)(rng);
+}
+
+static f pitch(PitchPair p) { return p.p1 + (p.p2 - p.p1) * p.crossfade; }
+
+struct Result {
+  int mismatches = 0;
+  int steps = 0;             // the most taken
+  int max_steps;             // the most allowed
+};
+
+static Result compare(Scale const *scale, bool learned) {
+  IndexedScale indexed;
+  indexed.set(scale, 0);
+  f const max = indexed.max();
+  f const octaves_per_semitone = 1_f / max;
+  Result r;
+  r.max_steps = learned
+    ? int((indexed.cell_width() / kScaleUnicityThreshold).floor()) + 2
+    : 1;
+
+  for (int i=0; i<kPitches; i++) {
+    f x = f(uniform(0.0f, 150.0f));
+    if (std::abs((pitch(scale->Process(x)) - pitch(indexed.Process(x))).repr()) > kTolerance)
+      r.mismatches++;
+    // as in IndexedScale::Process
+    f semitones = x - (x * octaves_per_semitone).integral() * max;
+    r.steps = std::max(r.steps, std::abs(indexed.locate(semitones) - indexed.guess(semitones)));
+  }
+  return r;
+}
+
+int main() {
+  Quantizer quantizer;
+
+  int mismatches = 0, steps = 0;
+  for (int mode=0; mode<kBankNr; mode++) {
+    for (int value=0; value<kScaleNr; value++) {
+      Result r = compare(quantizer.get_scale({ScaleMode(mode), value}), false);
+      mismatches += r.mismatches;
+      steps = std::max(steps, r.steps);
+      if (r.steps > r.max_steps)
+        printf("scale %d/%d: %d correction steps\n", mode, value, r.steps);
+    }
+  }
+  printf("default scales: %d mismatches, at most %d correction steps\n",
+         mismatches, steps);
+  check(mismatches == 0, "default scales: same pitches as Scale");
+  check(steps <= 1, "default scales: at most one correction step");
+
+  int learned = 0, over = 0;
+  mismatches = steps = 0;
+  for (int k=0; k<kLearnedScales; k++) {
+    PreScale pre;
+    int n = std::uniform_int_distribution<int>(1, kMaxScaleSize-2)(rng);
+    float range = uniform(1.0f, 120.0f);
+    for (int i=0; i<n; i++) pre.add(f(uniform(0.0f, range)));
+    Scale scale;
+    if (!pre.copy_to(&scale, k & 1)) continue;
+    Result r = compare(&scale, true);
+    learned++;
+    mismatches += r.mismatches;
+    steps = std::max(steps, r.steps);
+    if (r.steps > r.max_steps) over++;
+  }
+  printf("%d learned scales: %d mismatches, at most %d correction steps\n",
+         learned, mismatches, steps);
+  check(mismatches == 0, "learned scales: same pitches as Scale");
+  check(over == 0, "learned scales: one correction step per degree in a cell");
+
+  return report();
+}
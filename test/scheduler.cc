@@ -0,0 +1,110 @@
+#include <cstdio>
+#include <cstdlib>
+#include "scheduler.hh"
+#include "filter.hh"
+#include "check.hh"
+
+// Host test for StaggeredScheduler and for the rate compensation of
+// the control filters, with the periods Control uses.
+
+constexpr int kNumTasks = 9;
+constexpr int kMaxPeriod = 8;
+constexpr int kPeriods[kNumTasks] = {8, 2, 2, 2, 2, 2, 8, 1, 1};
+
+static void staggering() {
+  StaggeredScheduler<kNumTasks, kMaxPeriod> s {kPeriods};
+  int runs[kNumTasks] = {};
+  int min_load = kNumTasks, max_load = 0;
+  bool elapsed_ok = true;
+
+  constexpr int kTicks = 64 * kMaxPeriod;
+  for (int t=0; t<kTicks; t++) {
+    int load = 0;
+    s.Process(1, [&](int task, int elapsed) {
+      runs[task]++;
+      load++;
+      elapsed_ok &= elapsed == kPeriods[task];
+    });
+    min_load = std::min(min_load, load);
+    max_load = std::max(max_load, load);
+  }
+
+  bool rates_ok = true;
+  for (int i=0; i<kNumTasks; i++)
+    rates_ok &= runs[i] == kTicks / kPeriods[i];
+  check(rates_ok, "runs each task at its period");
+  check(elapsed_ok, "reports its period as elapsed");
+  printf("      %d to %d tasks per tick, instead of %d\n", min_load, max_load, kNumTasks);
+  check(max_load - min_load <= 1, "spreads the tasks evenly");
+
+  // several ticks per call, as with larger audio blocks
+  for (int ticks : {4, 8}) {
+    StaggeredScheduler<kNumTasks, kMaxPeriod> s {kPeriods};
+    int elapsed_sum[kNumTasks] = {};
+    bool once = true;
+    for (int t=0; t<kTicks; t+=ticks) {
+      int calls[kNumTasks] = {};
+      s.Process(ticks, [&](int task, int elapsed) {
+        calls[task]++;
+        elapsed_sum[task] += elapsed;
+      });
+      for (int c : calls) once &= c <= 1;
+    }
+    bool covered = true;
+    for (int i=0; i<kNumTasks; i++)
+      covered &= std::abs(elapsed_sum[i] - kTicks) < kMaxPeriod;
+    check(once, "runs a task at most once per call");
+    check(covered, "accounts for every tick elapsed");
+  }
+}
+
+// time for a quadratic filter run every [period] samples to get 99% of
+// the way through a step of [height]
+template<int divisor>
+static int settling_time(f height, int period) {
+  QuadraticOnePoleLp<divisor> lp;
+  int t = 0;
+  while ((lp.last() - height).abs() > 0.01_f * height && t < 1000000) {
+    lp.Process(height, period);
+    t += period;
+  }
+  return t;
+}
+
+static void compensation() {
+  QuadraticOnePoleLp<2> a, b;
+  bool same = true;
+  for (int i=0; i<1000; i++) {
+    f x = f(i % 37) / 37_f;
+    same &= a.Process(x) == b.Process(x, 1);
+  }
+  check(same, "is unchanged at every sample");
+
+  // within 5% of the settling time at every sample
+  auto close = [](int t, int reference) {
+    return std::abs(t - reference) * 20 <= reference;
+  };
+  bool ok = true;
+  for (f height : {0.02_f, 0.1_f, 0.3_f}) {
+    int t1 = settling_time<1>(height, 1);
+    int t2 = settling_time<2>(height, 1);
+    for (int period : {2, 4, 8}) {
+      ok &= close(settling_time<1>(height, period), t1);
+      ok &= close(settling_time<2>(height, period), t2);
+    }
+  }
+  check(ok, "keeps the time constant at lower rates");
+
+  QuadraticOnePoleLp<1> lp;
+  bool overshoot = false;
+  for (int i=0; i<100; i++)
+    overshoot |= lp.Process(1_f, 8) > 1_f;
+  check(!overshoot, "does not overshoot");
+}
+
+int main() {
+  staggering();
+  compensation();
+
+  return report();
+}
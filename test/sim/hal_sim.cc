@@ -0,0 +1,1213 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <vector>
+#include <algorithm>
+#include "stm32f7xx.h"
+#include "simulation.hh"
+
+// Models of the peripherals of the module behind the HAL stand-in of
+// stm32f7xx.h, an NVIC, and a virtual clock driven by the stimuli of
+// a script.
+//
+// Time is counted in CPU cycles. It advances as the firmware runs on
+// the host, scaled by SimOptions::slowdown, and jumps to the next
+// event when the firmware waits for an interrupt. Handlers run one at
+// a time on the host: an interrupt that would have preempted a
+// handler runs after it returns, but is accounted at the time it
+// would have started, and pushes back the end of the handler it
+// preempted. Its latency, response time and deadline are thus those
+// of the module, as long as the handlers do not depend on each other
+// within a block.
+
+extern "C" {
+  void SysTick_Handler();
+  void PendSV_Handler();
+  void DMA2_Stream1_IRQHandler();
+  void EXTI9_5_IRQHandler();
+  void QUADSPI_IRQHandler();
+}
+
+SimOptions sim_options;
+
+uint32_t SystemCoreClock = 216000000;
+__IO uint32_t uwTick;
+
+SCB_Type sim_scb;
+FPU_Type sim_fpu;
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+GPIO_TypeDef sim_gpio[9];
+DMA_TypeDef sim_dma[2];
+SPI_TypeDef sim_spi2;
+TIM_TypeDef sim_tim1, sim_tim3, sim_tim7;
+ADC_TypeDef sim_adc1, sim_adc3;
+SAI_Block_TypeDef sim_sai1_block_a;
+QUADSPI_TypeDef sim_quadspi;
+RCC_TypeDef sim_rcc;
+EXTI_TypeDef sim_exti;
+
+namespace {
+
+using Time = uint64_t;
+using HostClock = std::chrono::steady_clock;
+
+constexpr int kThread = -1;
+constexpr int kNumGpios = 5;            // A to E
+constexpr int kIrqOffset = 16;          // of the first system exception
+constexpr int kNumContexts = kSimNumIrqs + kIrqOffset;
+
+// DMA interrupt flags of stream 0, in LISR; the other streams have
+// them shifted
+constexpr uint32_t kDmaHalf = 0x10;
+constexpr uint32_t kDmaComplete = 0x20;
+constexpr int kDmaFlagShift[4] = {0, 6, 16, 22};
+
+// IS25LQ020B
+constexpr uint32_t kFlashSize = 0x40000;
+constexpr uint8_t kFlashBusy = 0x01, kFlashWriteEnabled = 0x02;
+
+enum QspiDone { QSPI_NONE, QSPI_RX, QSPI_TX, QSPI_MATCH };
+
+struct Irq {
+  char const *name = nullptr;
+  void (*handler)() = nullptr;
+  uint32_t preempt = 0, sub = 0;        // as on reset
+  bool enabled = false;
+  bool pending = false;
+  Time pended_at = 0;
+  Time deadline = 0;                    // of the pending call, 0 if none
+  // statistics
+  uint64_t count = 0, late = 0, lost = 0;
+  Time cost = 0, max_cost = 0, max_latency = 0, max_response = 0;
+};
+
+struct Event {
+  std::function<void()> action;
+  int tag;
+};
+
+// what a pin is wired to
+enum NetKind { ANALOG, SPI_ADC, BUTTON, SWITCH, GATE };
+
+struct Net {
+  char const *name;
+  NetKind kind;
+  int port, pin;                        // SPI_ADC: the channel
+  int port2 = 0, pin2 = 0;              // SWITCH: the bottom pin
+  bool inverted = false;                // GATE: through a transistor
+};
+
+enum { A, B, C, D, E };
+
+Net const nets[] = {
+  {"warp_pot", ANALOG, A, 3},
+  {"detune_pot", ANALOG, A, 4},
+  {"mod_pot", ANALOG, A, 5},
+  {"root_pot", ANALOG, A, 6},
+  {"scale_pot", ANALOG, A, 7},
+  {"pitch_pot", ANALOG, C, 4},
+  {"spread_pot", ANALOG, C, 5},
+  {"balance_pot", ANALOG, B, 0},
+  {"twist_pot", ANALOG, B, 1},
+  {"scale_cv", ANALOG, A, 0},
+  {"spread_cv", ANALOG, A, 1},
+  {"warp_cv", ANALOG, A, 2},
+  {"mod_cv_1", ANALOG, C, 0},
+  {"twist_cv", ANALOG, C, 1},
+  {"mod_cv_2", ANALOG, C, 2},
+  {"balance_cv", ANALOG, C, 3},
+  {"pitch_cv", SPI_ADC, 0, 0},
+  {"root_cv", SPI_ADC, 1, 0},
+  {"learn_button", BUTTON, C, 9},
+  {"freeze_button", BUTTON, A, 11},
+  {"mod_switch", SWITCH, E, 14, E, 15},
+  {"scale_switch", SWITCH, B, 10, B, 11},
+  {"twist_switch", SWITCH, D, 14, D, 15},
+  {"warp_switch", SWITCH, A, 15, C, 10},
+  {"learn_gate", GATE, B, 8, 0, 0, true},
+  {"freeze_gate", GATE, B, 9},
+};
+
+// ADC channels 0 to 15
+constexpr int kAdcPort[16] = {A, A, A, A, A, A, A, A, B, B, C, C, C, C, C, C};
+constexpr int kAdcPin[16] = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 0, 1, 2, 3, 4, 5};
+
+int index(IRQn_Type irq) { return irq + kIrqOffset; }
+
+int port_of(GPIO_TypeDef *gpio) { return int(gpio - sim_gpio); }
+
+int stream_of(DMA_Stream_TypeDef *s, DMA_TypeDef **dma) {
+  for (auto& d : sim_dma) {
+    if (s >= d.stream && s < d.stream + 8) {
+      *dma = &d;
+      return int(s - d.stream);
+    }
+  }
+  return -1;
+}
+
+class Simulation {
+public:
+  static Simulation& instance() {
+    static Simulation s;
+    return s;
+  }
+
+  // Clock
+
+  // stops the clock while the simulation does its own work
+  struct Pause {
+    Pause() { instance().Stop(); }
+    ~Pause() { instance().Start(); }
+  };
+
+  Time Now() {
+    if (stopped_) return now_;
+    return now_ + Scale(HostClock::now() - mark_);
+  }
+
+  // NVIC
+
+  void SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub) {
+    irqs_[index(irq)].preempt = preempt;
+    irqs_[index(irq)].sub = sub;
+  }
+
+  // as on the NVIC, the stretch so far runs first, with the previous
+  // state, and an interrupt left pending is taken as soon as enabled
+  void Enable(IRQn_Type irq, bool enabled) {
+    Sync();
+    Irq& i = irqs_[index(irq)];
+    // the latency of a line held off counts from its enabling
+    if (enabled && !i.enabled && i.pending) i.pended_at = now_;
+    i.enabled = enabled;
+    Sync();
+  }
+
+  void ClearPending(IRQn_Type irq) {
+    Sync();
+    irqs_[index(irq)].pending = false;
+  }
+
+  // [deadline]: time by which the handler must have returned, if any
+  void Pend(IRQn_Type irq, Time deadline = 0) {
+    Irq& i = irqs_[index(irq)];
+    if (i.pending) {
+      if (i.enabled) i.lost++;
+      return;
+    }
+    i.pending = true;
+    i.pended_at = Now();
+    i.deadline = deadline;
+  }
+
+  // Waiting for the hardware
+
+  // the current context busy-waits until [done] or [until],
+  // serving the interrupts that can preempt it meanwhile
+  template<class F>
+  void Wait(F&& done, Time until = ~Time(0)) {
+    Pause p;
+    Interleave(segment_, now_);
+    Time limit = now_ + Time(SystemCoreClock) * 60;
+    for (;;) {
+      Serve();
+      if (done()) break;
+      if (events_.empty() || events_.begin()->first >= until) {
+        if (until != ~Time(0) && until > now_) {
+          Charge(until - now_);
+          now_ = until;
+        }
+        break;
+      }
+      if (events_.begin()->first > now_) Charge(events_.begin()->first - now_);
+      Fire();
+      if (now_ > limit) Abort("waiting for more than a minute");
+    }
+    segment_ = now_;
+  }
+
+  void Sync() {
+    Wait([] { return true; });
+  }
+
+  void Busy(Time duration) {
+    Wait([] { return false; }, Now() + duration);
+  }
+
+  // the thread sleeps until an interrupt has been served
+  void Sleep() {
+    Pause p;
+    if (!booted_) {
+      booted_ = true;
+      boot_time_ = now_;
+    }
+    Interleave(segment_, now_);
+    while (Preemptor() < 0) {
+      if (events_.empty()) Abort("nothing left to wake up the thread");
+      Time t = events_.begin()->first;
+      if (t > now_) {
+        idle_ += t - now_;
+        now_ = t;
+      }
+      Fire();
+    }
+    Serve();
+    segment_ = now_;
+  }
+
+  // Peripherals
+
+  void StartSysTick(uint32_t period) {
+    Pause p;
+    Cancel(TAG_SYSTICK);
+    systick_period_ = period;
+    Schedule(now_ + period, TAG_SYSTICK, [this] { SysTick(); });
+  }
+
+  uint32_t ApbDivider() { return apb1_divider_; }
+  void SetApbDivider(uint32_t d) { apb1_divider_ = d; }
+
+  uint32_t Read(SimRegister const *r);
+  void Write(SimRegister *r, uint32_t x);
+
+  void GpioInit(GPIO_TypeDef *gpio, GPIO_InitTypeDef *init);
+
+  void AdcChannel(ADC_HandleTypeDef *h, ADC_ChannelConfTypeDef *config) {
+    Adc& adc = adc_of(h);
+    if (config->Rank >= 1 && config->Rank <= 16)
+      adc.ranks[config->Rank - 1] = config->Channel;
+  }
+
+  void AdcStart(ADC_HandleTypeDef *h, uint32_t *data, uint32_t length) {
+    Adc& adc = adc_of(h);
+    adc.data = reinterpret_cast<uint16_t*>(data);
+    adc.length = std::min<uint32_t>(length, 16);
+    Convert();
+  }
+
+  void DmaStart(DMA_HandleTypeDef *h, uintptr_t src, uintptr_t dst, uint32_t length);
+
+  void TimerStart(TIM_HandleTypeDef *h);
+
+  void SaiStart(SAI_HandleTypeDef *h, uint16_t size);
+  void SaiStop(SAI_HandleTypeDef *h);
+
+  // Flash
+
+  void QspiCommand(QSPI_HandleTypeDef *h, QSPI_CommandTypeDef *cmd);
+  void QspiTransmit(QSPI_HandleTypeDef *h, uint8_t *data, bool it);
+  void QspiReceive(QSPI_HandleTypeDef *h, uint8_t *data, bool it);
+  bool QspiPoll(QSPI_HandleTypeDef *h, QSPI_AutoPollingTypeDef *config, bool it);
+
+  [[noreturn]] void Abort(char const *why) {
+    fprintf(stderr, "simulator: %s at %.3f ms\n", why, Ms(now_));
+    exit(1);
+  }
+
+private:
+  enum Tag { TAG_NONE, TAG_SYSTICK, TAG_SAI };
+
+  struct Adc {
+    uint32_t ranks[16] = {};
+    uint16_t *data = nullptr;
+    uint32_t length = 0;
+  };
+
+  struct Sai {
+    bool running = false;
+    Time start = 0;
+    uint32_t items = 0;                 // in the circular buffer
+    uint32_t rate = 0;                  // items per second
+    DMA_Stream_TypeDef *stream = nullptr;
+  };
+
+  struct Spi {
+    bool running = false;
+    Time start = 0, period = 0;         // per word
+    uint64_t done = 0;                  // words transferred
+    uint16_t *tx = nullptr, *rx = nullptr;
+    uint32_t length = 0;
+    int chan = 0, since_switch = 0;
+  };
+
+  struct Flash {
+    std::vector<uint8_t> image = std::vector<uint8_t>(kFlashSize, 0xFF);
+    uint8_t status = 0;
+    Time busy_until = 0;
+  };
+
+  // clock
+  Time now_ = 0;
+  HostClock::time_point mark_ = HostClock::now();
+  int stopped_ = 0;
+  double cycles_per_ns_;
+  Time cycle_offset_ = 0;
+
+  // scheduler
+  Irq irqs_[kNumContexts];
+  uint32_t level_ = ~0u;                // preemption priority running
+  int current_ = kThread;
+  Time segment_ = 0;                    // start of the current stretch
+  std::multimap<Time, Event> events_;
+  Time thread_busy_ = 0, idle_ = 0;
+  bool booted_ = false;
+  Time boot_time_ = 0;
+
+  // peripherals
+  uint32_t systick_period_ = 0;
+  uint32_t apb1_divider_ = RCC_HCLK_DIV1;
+  uint32_t modes_[kNumGpios][16] = {};
+  uint32_t pulls_[kNumGpios][16] = {};
+  int8_t driven_[kNumGpios][16];
+  float analog_[kNumGpios][16];
+  int spi_codes_[2] = {0x800, 0x800};
+  Adc adcs_[2];
+  Sai sai_;
+  Spi spi_;
+  Flash flash_;
+
+  Simulation() {
+    cycles_per_ns_ = SystemCoreClock * 1e-9 * sim_options.slowdown;
+    memset(driven_, -1, sizeof(driven_));
+    for (auto& port : analog_)
+      for (auto& v : port) v = 0.5f;
+    Register(SysTick_IRQn, "SysTick", SysTick_Handler);
+    Register(PendSV_IRQn, "PendSV", PendSV_Handler);
+    Register(DMA2_Stream1_IRQn, "DMA2_Stream1 (DAC)", DMA2_Stream1_IRQHandler);
+    Register(EXTI9_5_IRQn, "EXTI9_5 (gates)", EXTI9_5_IRQHandler);
+    Register(QUADSPI_IRQn, "QUADSPI", QUADSPI_IRQHandler);
+    // system exceptions cannot be disabled
+    irqs_[index(SysTick_IRQn)].enabled = true;
+    irqs_[index(PendSV_IRQn)].enabled = true;
+    LoadFlash();
+    LoadScript();
+    Schedule(Time(sim_options.seconds * SystemCoreClock), TAG_NONE,
+             [this] { Finish(); });
+  }
+
+  void Register(IRQn_Type irq, char const *name, void (*handler)()) {
+    irqs_[index(irq)].name = name;
+    irqs_[index(irq)].handler = handler;
+  }
+
+  Time Scale(HostClock::duration d) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    return Time(llround(double(ns) * cycles_per_ns_));
+  }
+
+  double Us(Time t) { return double(t) * 1e6 / SystemCoreClock; }
+  double Ms(Time t) { return double(t) * 1e3 / SystemCoreClock; }
+  Time Cycles(double seconds) { return Time(seconds * SystemCoreClock); }
+
+  void Charge(Time d) {
+    if (current_ == kThread) thread_busy_ += d;
+    else irqs_[current_].cost += d;
+  }
+
+  // charges the time since the last mark to the context running
+  void Fold() {
+    Time d = Scale(HostClock::now() - mark_);
+    now_ += d;
+    Charge(d);
+  }
+
+  void Stop() { if (stopped_++ == 0) Fold(); }
+  void Start() { if (--stopped_ == 0) mark_ = HostClock::now(); }
+
+  // Events
+
+  void Schedule(Time t, int tag, std::function<void()> action) {
+    events_.emplace(t, Event {std::move(action), tag});
+  }
+
+  void Cancel(int tag) {
+    for (auto it = events_.begin(); it != events_.end(); )
+      it = it->second.tag == tag ? events_.erase(it) : std::next(it);
+  }
+
+  // runs the next event, at its time
+  void Fire() {
+    auto it = events_.begin();
+    now_ = std::max(now_, it->first);
+    auto action = std::move(it->second.action);
+    events_.erase(it);
+    action();
+  }
+
+  // Scheduler
+
+  // the pending interrupt that can preempt the current context
+  int Preemptor() {
+    int best = -1;
+    for (int i=0; i<kNumContexts; i++) {
+      Irq& irq = irqs_[i];
+      if (!irq.pending || !irq.enabled || irq.preempt >= level_) continue;
+      if (best < 0 || irq.preempt < irqs_[best].preempt ||
+          (irq.preempt == irqs_[best].preempt && irq.sub < irqs_[best].sub))
+        best = i;
+    }
+    return best;
+  }
+
+  void Serve() {
+    for (int n; (n = Preemptor()) >= 0; ) Enter(n);
+  }
+
+  // the interrupts that would have preempted the stretch of the
+  // current context from [from] to [to], at their own time; returns
+  // with the clock at the end of the stretch, pushed back by them
+  void Interleave(Time from, Time to) {
+    Time cursor = from;
+    for (;;) {
+      int n = Preemptor();
+      if (n >= 0) {
+        Time start = std::max(cursor, irqs_[n].pended_at);
+        now_ = start;
+        Enter(n);
+        to += now_ - start;
+        cursor = now_;
+        continue;
+      }
+      if (events_.empty() || events_.begin()->first >= to) break;
+      cursor = std::max(cursor, events_.begin()->first);
+      now_ = cursor;
+      Fire();
+    }
+    now_ = to;
+  }
+
+  // runs interrupt [n] from now, and what would have preempted it
+  void Enter(int n) {
+    Irq& irq = irqs_[n];
+    if (!irq.handler) {
+      irq.pending = false;
+      return;
+    }
+    uint32_t level = level_;
+    int current = current_;
+    Time start = now_;
+    Time pended = irq.pended_at;    // the handler may pend it again
+    Time cost = irq.cost;
+    irq.pending = false;
+    level_ = irq.preempt;
+    current_ = n;
+    segment_ = start;
+
+    int stopped = stopped_;
+    stopped_ = 0;
+    mark_ = HostClock::now();
+    irq.handler();
+    Fold();
+    stopped_ = stopped;
+
+    Interleave(segment_, now_);
+
+    Time own = irq.cost - cost;
+    irq.count++;
+    irq.max_cost = std::max(irq.max_cost, own);
+    irq.max_latency = std::max(irq.max_latency, start - pended);
+    irq.max_response = std::max(irq.max_response, now_ - pended);
+    if (irq.deadline && now_ > irq.deadline) irq.late++;
+
+    level_ = level;
+    current_ = current;
+    // level-sensitive lines stay pending while their flags are set
+    if (Asserted(n)) Pend(IRQn_Type(n - kIrqOffset));
+  }
+
+  bool Asserted(int n) {
+    if (n == index(DMA2_Stream1_IRQn))
+      return sim_dma[1].LISR & ((kDmaHalf | kDmaComplete) << kDmaFlagShift[1]);
+    if (n == index(EXTI9_5_IRQn))
+      return sim_exti.PR.value & 0x03E0;
+    return false;
+  }
+
+  void SysTick() {
+    Pend(SysTick_IRQn);
+    Schedule(now_ + systick_period_, TAG_SYSTICK, [this] { SysTick(); });
+  }
+
+  // Board
+
+  void Recompute(int port) {
+    uint32_t idr = 0;
+    for (int pin=0; pin<16; pin++) {
+      bool level =
+        driven_[port][pin] >= 0 ? driven_[port][pin] :
+        modes_[port][pin] == GPIO_MODE_OUTPUT_PP ? (sim_gpio[port].ODR >> pin) & 1 :
+        pulls_[port][pin] == GPIO_PULLUP;
+      idr |= uint32_t(level) << pin;
+    }
+    sim_gpio[port].IDR = idr;
+  }
+
+  void Drive(int port, int pin, bool level) {
+    bool before = (sim_gpio[port].IDR >> pin) & 1;
+    driven_[port][pin] = level;
+    Recompute(port);
+    if (level == before) return;
+    uint32_t mode = modes_[port][pin];
+    bool edge = level ? mode & 0x00100000 : mode & 0x00200000;
+    if ((mode & 0x10000000) && edge) {
+      sim_exti.PR.value |= 1u << pin;
+      if (pin >= 5 && pin <= 9) Pend(EXTI9_5_IRQn);
+    }
+  }
+
+  void Set(Net const& net, float value) {
+    switch (net.kind) {
+    case ANALOG:
+      analog_[net.port][net.pin] = std::clamp(value, 0.f, 1.f);
+      Convert();
+      break;
+    case SPI_ADC:
+      spi_codes_[net.port] = std::clamp(int(lroundf(value * 4095.f)), 0, 4095);
+      break;
+    case BUTTON:                        // pulled up, pushed to ground
+      Drive(net.port, net.pin, value == 0.f);
+      break;
+    case SWITCH:                        // up: 1, middle: 0, down: -1
+      Drive(net.port, net.pin, value <= 0.f);
+      Drive(net.port2, net.pin2, value >= 0.f);
+      break;
+    case GATE:
+      Drive(net.port, net.pin, (value != 0.f) != net.inverted);
+      break;
+    }
+  }
+
+  float Get(Net const& net) {
+    if (net.kind == ANALOG) return analog_[net.port][net.pin];
+    if (net.kind == SPI_ADC) return spi_codes_[net.port] / 4095.f;
+    return 0.f;
+  }
+
+  // ADC: the DMA keeps the buffers up to date
+  Adc& adc_of(ADC_HandleTypeDef *h) { return adcs_[h->Instance == ADC3]; }
+
+  void Convert() {
+    for (auto& adc : adcs_) {
+      if (!adc.data) continue;
+      for (uint32_t i=0; i<adc.length; i++) {
+        uint32_t ch = adc.ranks[i] & 15;
+        int code = int(lroundf(analog_[kAdcPort[ch]][kAdcPin[ch]] * 4095.f));
+        adc.data[i] = uint16_t(code << 4);     // left-aligned
+      }
+    }
+  }
+
+  // DAC: the SAI sends [rate] items per second from a circular buffer
+
+  uint32_t SaiCounter() {
+    uint64_t sent = (Now() - sai_.start) * sai_.rate / SystemCoreClock;
+    return sai_.items - uint32_t(sent % sai_.items);
+  }
+
+  Time SaiTime(uint64_t items) {
+    return sai_.start + items * SystemCoreClock / sai_.rate;
+  }
+
+  // the DMA reaches half [k] of the buffer (counted from the start)
+  void SaiHalf(uint64_t k) {
+    uint32_t half = sai_.items / 2;
+    uint32_t flag = k & 1 ? kDmaHalf : kDmaComplete;
+    sim_dma[1].LISR |= flag << kDmaFlagShift[1];
+    Pend(DMA2_Stream1_IRQn, SaiTime((k + 1) * half));
+    Schedule(SaiTime((k + 1) * half), TAG_SAI, [this, k] { SaiHalf(k + 1); });
+  }
+
+  // SPI ADC: TIM7 paces the words, the MAX11666 answers (see
+  // test/simulated_spi.hh)
+
+  static constexpr int kSettleWords = 5;
+
+  void SpiCatchUp() {
+    if (!spi_.running || !spi_.tx || !spi_.rx) return;
+    uint64_t due = (Now() - spi_.start) / spi_.period;
+    if (due - spi_.done > spi_.length) {
+      spi_.done = due - spi_.length;
+      spi_.since_switch = 0;
+    }
+    for (; spi_.done < due; spi_.done++) {
+      uint32_t i = spi_.done % spi_.length;
+      uint16_t command = spi_.tx[i];
+      if (command == 0x00FF) { spi_.chan = 0; spi_.since_switch = 0; }
+      if (command == 0xFF00) { spi_.chan = 1; spi_.since_switch = 0; }
+      int code = spi_.since_switch < kSettleWords ? rand() & 0xFFF : spi_codes_[spi_.chan];
+      spi_.rx[i] = uint16_t(code << 2);
+      spi_.since_switch++;
+    }
+  }
+
+  uint32_t SpiCounter() {
+    SpiCatchUp();
+    return spi_.length - uint32_t(spi_.done % spi_.length);
+  }
+
+  // Flash
+
+  uint8_t FlashStatus() {
+    uint8_t s = flash_.status;
+    if (Now() < flash_.busy_until) s |= kFlashBusy;
+    return s;
+  }
+
+  // the chip is busy for [duration] from now
+  void FlashProgram(Time duration) {
+    flash_.status &= ~kFlashWriteEnabled;
+    flash_.busy_until = Now() + duration;
+  }
+
+  // QUADSPI transfer, as measured on the module: ~760us per sector
+  Time QspiTransfer(uint32_t bytes) { return Cycles(bytes * 0.19e-6); }
+
+  void QspiComplete(QSPI_HandleTypeDef *h, int done) {
+    h->Done = done;
+    Pend(QUADSPI_IRQn);
+  }
+
+  void LoadFlash() {
+    if (!sim_options.flash) return;
+    if (FILE *f = fopen(sim_options.flash, "rb")) {
+      size_t n = fread(flash_.image.data(), 1, kFlashSize, f);
+      // then the non-volatile bits of the status register
+      if (n == kFlashSize && fread(&flash_.status, 1, 1, f) == 1)
+        flash_.status &= 0xFC;
+      fclose(f);
+    }
+  }
+
+  void SaveFlash() {
+    if (!sim_options.flash) return;
+    if (FILE *f = fopen(sim_options.flash, "wb")) {
+      fwrite(flash_.image.data(), 1, kFlashSize, f);
+      uint8_t status = flash_.status & 0xFC;
+      fwrite(&status, 1, 1, f);
+      fclose(f);
+    }
+  }
+
+  // Script
+
+  Net const *FindNet(char const *name) {
+    for (auto& net : nets)
+      if (!strcmp(net.name, name)) return &net;
+    return nullptr;
+  }
+
+  static bool ParseValue(char const *s, float *v) {
+    if (!strcmp(s, "up")) *v = 1.f;
+    else if (!strcmp(s, "mid")) *v = 0.f;
+    else if (!strcmp(s, "down")) *v = -1.f;
+    else {
+      char *end;
+      *v = strtof(s, &end);
+      return end != s && *end == 0;
+    }
+    return true;
+  }
+
+  // <ms> <net> <value>
+  // <ms> <net> ramp <to> <duration ms>
+  // <ms> <net> pulses <count> <period ms>
+  // <ms> end
+  void LoadScript() {
+    if (!sim_options.script) return;
+    FILE *f = fopen(sim_options.script, "r");
+    if (!f) {
+      fprintf(stderr, "simulator: cannot open %s\n", sim_options.script);
+      exit(1);
+    }
+    char line[256];
+    for (int n=1; fgets(line, sizeof(line), f); n++) {
+      if (char *c = strchr(line, '#')) *c = 0;
+      char name[64], verb[64];
+      double ms;
+      float a = 0.f, b = 0.f;
+      int fields = sscanf(line, "%lf %63s %63s %f %f", &ms, name, verb, &a, &b);
+      if (fields <= 0) continue;
+      Time t = Cycles(ms * 1e-3);
+      if (fields == 2 && !strcmp(name, "end")) {
+        Schedule(t, TAG_NONE, [this] { Finish(); });
+        continue;
+      }
+      Net const *net = fields >= 3 ? FindNet(name) : nullptr;
+      float value;
+      if (net && fields == 5 && !strcmp(verb, "ramp")) {
+        Schedule(t, TAG_NONE, [this, net, t, a, b] { Ramp(*net, t, a, b); });
+      } else if (net && fields == 5 && !strcmp(verb, "pulses")) {
+        Time period = Cycles(double(b) * 1e-3);
+        for (int i=0; i<int(a); i++) {
+          Schedule(t + i * period, TAG_NONE, [this, net] { Set(*net, 1.f); });
+          Schedule(t + i * period + period / 2, TAG_NONE, [this, net] { Set(*net, 0.f); });
+        }
+      } else if (net && fields == 3 && ParseValue(verb, &value)) {
+        // the state at power-on
+        if (t == 0) Set(*net, value);
+        else Schedule(t, TAG_NONE, [this, net, value] { Set(*net, value); });
+      } else {
+        fprintf(stderr, "simulator: %s:%d: cannot parse\n", sim_options.script, n);
+        exit(1);
+      }
+    }
+    fclose(f);
+  }
+
+  // from the current value to [to] in [ms], by steps of a millisecond
+  void Ramp(Net const& net, Time t, float to, float ms) {
+    float from = Get(net);
+    int steps = std::max(1, int(ms));
+    for (int i=1; i<=steps; i++) {
+      float v = from + (to - from) * float(i) / float(steps);
+      Schedule(t + Cycles(i * 1e-3), TAG_NONE, [this, &net, v] { Set(net, v); });
+    }
+  }
+
+  // Report
+
+  [[noreturn]] void Finish() {
+    Time total = now_;
+    printf("simulated %.3f s, host time x %.2f\n", Ms(total) / 1e3, sim_options.slowdown);
+    if (booted_) printf("boot: %.1f ms to the main loop\n", Ms(boot_time_));
+    printf("\n%-20s %5s %8s %8s %8s %12s %12s %6s %6s %7s\n", "context", "prio",
+           "count", "avg us", "max us", "max lat us", "max resp us", "late",
+           "lost", "load %");
+    std::vector<int> order;
+    for (int i=0; i<kNumContexts; i++)
+      if (irqs_[i].name && irqs_[i].count) order.push_back(i);
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+      return irqs_[a].preempt != irqs_[b].preempt
+        ? irqs_[a].preempt < irqs_[b].preempt : irqs_[a].sub < irqs_[b].sub;
+    });
+    for (int i : order) {
+      Irq& irq = irqs_[i];
+      char prio[16];
+      snprintf(prio, sizeof(prio), "%u.%u", irq.preempt, irq.sub);
+      printf("%-20s %5s %8llu %8.2f %8.2f %12.2f %12.2f %6llu %6llu %7.2f\n",
+             irq.name, prio, (unsigned long long)irq.count,
+             Us(irq.cost) / double(irq.count), Us(irq.max_cost),
+             Us(irq.max_latency), Us(irq.max_response),
+             (unsigned long long)irq.late, (unsigned long long)irq.lost,
+             100. * double(irq.cost) / double(total));
+    }
+    printf("%-20s %5s %8s %8s %8s %12s %12s %6s %6s %7.2f\n", "thread", "", "",
+           "", "", "", "", "", "", 100. * double(thread_busy_) / double(total));
+    printf("%-20s %5s %8s %8s %8s %12s %12s %6s %6s %7.2f\n", "idle", "", "",
+           "", "", "", "", "", "", 100. * double(idle_) / double(total));
+    if (sim_options.report) sim_options.report();
+    SaveFlash();
+    fflush(stdout);
+    exit(0);
+  }
+};
+
+Simulation& sim() { return Simulation::instance(); }
+
+}  // namespace
+
+// Registers
+
+SimRegister::operator uint32_t() const { return sim().Read(this); }
+
+SimRegister& SimRegister::operator=(uint32_t x) {
+  sim().Write(this, x);
+  return *this;
+}
+
+uint32_t Simulation::Read(SimRegister const *r) {
+  if (r == &DMA2_Stream1->NDTR && sai_.running) {
+    Pause p;
+    return SaiCounter();
+  }
+  if (r == &DMA1_Stream3->NDTR || r == &DMA1_Stream2->NDTR) {
+    Pause p;
+    if (spi_.running) return SpiCounter();
+  }
+  if (r == &DWT->CYCCNT) return uint32_t(Now() - cycle_offset_);
+  return r->value;
+}
+
+void Simulation::Write(SimRegister *r, uint32_t x) {
+  if (r == &SCB->ICSR) {
+    if (x & SCB_ICSR_PENDSVSET_Msk) Pend(PendSV_IRQn);
+  } else if (r == &DWT->CYCCNT) {
+    cycle_offset_ = Now() - x;
+  } else if (r == &EXTI->PR) {
+    r->value &= ~x;                     // write 1 to clear
+  } else if (r == &DMA1->LIFCR || r == &DMA2->LIFCR) {
+    (r == &DMA1->LIFCR ? DMA1 : DMA2)->LISR &= ~x;
+  } else if (r == &DMA1->HIFCR || r == &DMA2->HIFCR) {
+    (r == &DMA1->HIFCR ? DMA1 : DMA2)->HISR &= ~x;
+  } else {
+    for (auto& gpio : sim_gpio) {
+      if (r == &gpio.BSRR) {
+        gpio.ODR = (gpio.ODR | (x & 0xFFFF)) & ~(x >> 16);
+        return;
+      }
+    }
+    r->value = x;
+  }
+}
+
+// Peripherals
+
+void Simulation::GpioInit(GPIO_TypeDef *gpio, GPIO_InitTypeDef *init) {
+  int port = port_of(gpio);
+  if (port < 0 || port >= kNumGpios) return;
+  for (int pin=0; pin<16; pin++) {
+    if (!(init->Pin & (1u << pin))) continue;
+    modes_[port][pin] = init->Mode;
+    pulls_[port][pin] = init->Pull;
+  }
+  Recompute(port);
+}
+
+void Simulation::DmaStart(DMA_HandleTypeDef *h, uintptr_t src, uintptr_t dst,
+                          uint32_t length) {
+  Pause p;
+  h->Instance->NDTR.value = length;
+  if (h->Instance == DMA1_Stream3) {
+    spi_.rx = reinterpret_cast<uint16_t*>(dst);
+    spi_.length = length;
+  } else if (h->Instance == DMA1_Stream2) {
+    spi_.tx = reinterpret_cast<uint16_t*>(src);
+  }
+}
+
+void Simulation::TimerStart(TIM_HandleTypeDef *h) {
+  if (h->Instance != TIM7) return;
+  Pause p;
+  // APB1 timers run at twice PCLK1 when it is divided
+  uint32_t clock = HAL_RCC_GetPCLK1Freq();
+  if (apb1_divider_ != RCC_HCLK_DIV1) clock *= 2;
+  uint64_t ticks = uint64_t(h->Init.Period + 1) * (h->Init.Prescaler + 1);
+  spi_.period = std::max<uint64_t>(1, ticks * SystemCoreClock / clock);
+  spi_.start = now_;
+  spi_.done = 0;
+  spi_.running = true;
+}
+
+void Simulation::SaiStart(SAI_HandleTypeDef *h, uint16_t size) {
+  Pause p;
+  Cancel(TAG_SAI);
+  sai_.stream = h->hdmatx->Instance;
+  sai_.stream->CR |= DMA_IT_TC | DMA_IT_HT;
+  sai_.items = size;
+  sai_.rate = 2 * h->Init.AudioFrequency;      // two slots per frame
+  sai_.start = now_;
+  sai_.running = true;
+  Schedule(SaiTime(size / 2), TAG_SAI, [this] { SaiHalf(1); });
+}
+
+void Simulation::SaiStop(SAI_HandleTypeDef *h) {
+  Pause p;
+  Cancel(TAG_SAI);
+  sai_.running = false;
+  DMA2->LISR &= ~((kDmaHalf | kDmaComplete) << kDmaFlagShift[1]);
+}
+
+// Flash: IS25LQ020B, with the timings measured on the module where
+// there are some (see qspi_flash.cc), typical ones otherwise
+
+void Simulation::QspiCommand(QSPI_HandleTypeDef *h, QSPI_CommandTypeDef *cmd) {
+  Pause p;
+  h->Command = *cmd;
+  if (cmd->DataMode != QSPI_DATA_NONE) return;
+  bool enabled = flash_.status & kFlashWriteEnabled;
+  uint32_t erase = 0;
+  Time duration = 0;
+  switch (cmd->Instruction) {
+  case 0x06: flash_.status |= kFlashWriteEnabled; break;
+  case 0x99: flash_.status &= ~kFlashWriteEnabled; break;
+  case 0x20: erase = 0x1000; duration = Cycles(38e-3); break;
+  case 0x52: erase = 0x8000; duration = Cycles(150e-3); break;
+  case 0xD8: erase = 0x10000; duration = Cycles(300e-3); break;
+  case 0xC7: erase = kFlashSize; duration = Cycles(1.); break;
+  }
+  if (erase && enabled) {
+    uint32_t base = cmd->Instruction == 0xC7 ? 0 : (cmd->Address % kFlashSize) & ~(erase - 1);
+    std::fill_n(flash_.image.begin() + base, erase, 0xFF);
+    FlashProgram(duration);
+  }
+}
+
+void Simulation::QspiTransmit(QSPI_HandleTypeDef *h, uint8_t *data, bool it) {
+  Pause p;
+  QSPI_CommandTypeDef& cmd = h->Command;
+  Busy(QspiTransfer(cmd.NbData));
+  switch (cmd.Instruction) {
+  case 0x01:                            // status register, typical tW
+    if (flash_.status & kFlashWriteEnabled) {
+      flash_.status = (flash_.status & 0x03) | (data[0] & 0xFC);
+      FlashProgram(Cycles(2e-3));
+    }
+    break;
+  case 0x02: case 0x38:                 // program, within a page
+    if (flash_.status & kFlashWriteEnabled) {
+      for (uint32_t i=0; i<cmd.NbData; i++) {
+        uint32_t a = (cmd.Address & ~0xFFu) | ((cmd.Address + i) & 0xFF);
+        flash_.image[a % kFlashSize] &= data[i];
+      }
+      FlashProgram(Cycles(330e-6));
+    }
+    break;
+  }
+  if (it) {
+    QspiComplete(h, QSPI_TX);
+    Wait([] { return true; });
+  }
+}
+
+void Simulation::QspiReceive(QSPI_HandleTypeDef *h, uint8_t *data, bool it) {
+  Pause p;
+  QSPI_CommandTypeDef& cmd = h->Command;
+  Busy(QspiTransfer(cmd.NbData));
+  if (cmd.Instruction == 0x05) {
+    data[0] = FlashStatus();
+  } else {
+    for (uint32_t i=0; i<cmd.NbData; i++)
+      data[i] = flash_.image[(cmd.Address + i) % kFlashSize];
+  }
+  if (it) {
+    QspiComplete(h, QSPI_RX);
+    Wait([] { return true; });
+  }
+}
+
+// polls the status register until it matches; completes the
+// interrupt-driven variant right away, with the interrupt served,
+// which is what the callers wait for anyway
+bool Simulation::QspiPoll(QSPI_HandleTypeDef *h, QSPI_AutoPollingTypeDef *config, bool it) {
+  Pause p;
+  auto match = [&] { return (FlashStatus() & config->Mask) == config->Match; };
+  Wait(match, std::max(flash_.busy_until, now_));
+  if (!match()) return false;
+  if (it) {
+    QspiComplete(h, QSPI_MATCH);
+    Wait([] { return true; });
+  }
+  return true;
+}
+
+// HAL: common
+
+HAL_StatusTypeDef HAL_Init(void) { return HAL_OK; }
+HAL_StatusTypeDef HAL_DeInit(void) { return HAL_OK; }
+
+// waits one more tick than asked, as the HAL does
+void HAL_Delay(uint32_t delay) {
+  uint32_t start = uwTick;
+  sim().Wait([=] { return uwTick - start >= delay + 1; });
+}
+
+uint32_t HAL_GetTick(void) { return uwTick; }
+
+void __WFI(void) { sim().Sleep(); }
+
+void NVIC_SystemReset(void) { sim().Abort("system reset"); }
+void HAL_NVIC_SystemReset(void) { sim().Abort("system reset"); }
+
+// HAL: clocks
+
+HAL_StatusTypeDef HAL_RCC_DeInit(void) { return HAL_OK; }
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *init) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *init, uint32_t latency) {
+  sim().SetApbDivider(init->APB1CLKDivider);
+  RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PPRE1) | init->APB1CLKDivider;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *init) { return HAL_OK; }
+HAL_StatusTypeDef HAL_PWREx_EnableOverDrive(void) { return HAL_OK; }
+void HAL_RCCEx_DisablePLLI2S(void) {}
+void HAL_RCCEx_DisablePLLSAI(void) {}
+void HAL_RCC_EnableCSS(void) {}
+uint32_t HAL_RCC_GetHCLKFreq(void) { return SystemCoreClock; }
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+  switch (sim().ApbDivider()) {
+  case RCC_HCLK_DIV2: return SystemCoreClock / 2;
+  case RCC_HCLK_DIV4: return SystemCoreClock / 4;
+  case RCC_HCLK_DIV8: return SystemCoreClock / 8;
+  case RCC_HCLK_DIV16: return SystemCoreClock / 16;
+  default: return SystemCoreClock;
+  }
+}
+
+// HAL: interrupts
+
+void HAL_NVIC_SetPriorityGrouping(uint32_t group) {}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub) {
+  sim().SetPriority(irq, preempt, sub);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) { sim().Enable(irq, true); }
+void HAL_NVIC_DisableIRQ(IRQn_Type irq) { sim().Enable(irq, false); }
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq) { sim().ClearPending(irq); }
+
+uint32_t HAL_SYSTICK_Config(uint32_t ticks) {
+  sim().StartSysTick(ticks);
+  return 0;
+}
+
+void HAL_SYSTICK_CLKSourceConfig(uint32_t source) {}
+
+// HAL: GPIO
+
+void HAL_GPIO_Init(GPIO_TypeDef *gpio, GPIO_InitTypeDef *init) { sim().GpioInit(gpio, init); }
+void HAL_GPIO_DeInit(GPIO_TypeDef *gpio, uint32_t pins) {}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *gpio, uint16_t pin, GPIO_PinState state) {
+  gpio->BSRR = state == GPIO_PIN_RESET ? uint32_t(pin) << 16 : pin;
+}
+
+// HAL: DMA
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uintptr_t src, uintptr_t dst,
+                                uint32_t length) {
+  sim().DmaStart(hdma, src, dst, length);
+  return HAL_OK;
+}
+
+// a full sequence of conversions: at most 16 of 156 ADC cycles, at
+// PCLK2 / 8 = 13.5MHz
+HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma,
+                                          HAL_DMA_LevelCompleteTypeDef level,
+                                          uint32_t timeout) {
+  sim().Busy(16 * 156 * 16);
+  return HAL_OK;
+}
+
+uint32_t SimDmaFlag(DMA_HandleTypeDef *hdma, uint32_t flag0) {
+  DMA_TypeDef *dma;
+  int stream = stream_of(hdma->Instance, &dma);
+  return stream < 0 ? 0 : flag0 << kDmaFlagShift[stream % 4];
+}
+
+void SimDmaClearFlag(DMA_HandleTypeDef *hdma, uint32_t flag) {
+  DMA_TypeDef *dma;
+  int stream = stream_of(hdma->Instance, &dma);
+  if (stream < 0) return;
+  if (stream < 4) dma->LIFCR = flag;
+  else dma->HIFCR = flag;
+}
+
+// HAL: ADC
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *config) {
+  sim().AdcChannel(hadc, config);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length) {
+  sim().AdcStart(hadc, data, length);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc) { return HAL_OK; }
+
+// HAL: SPI and timers
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi) { return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim) {
+  sim().TimerStart(htim);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *config,
+                                            uint32_t channel) {
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel) { return HAL_OK; }
+
+// HAL: SAI
+
+HAL_StatusTypeDef HAL_SAI_InitProtocol(SAI_HandleTypeDef *hsai, uint32_t protocol,
+                                       uint32_t datasize, uint32_t nbslot) {
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SAI_DeInit(SAI_HandleTypeDef *hsai) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_SAI_Transmit_DMA(SAI_HandleTypeDef *hsai, uint8_t *data, uint16_t size) {
+  sim().SaiStart(hsai, size);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai) {
+  sim().SaiStop(hsai);
+  return HAL_OK;
+}
+
+// HAL: QSPI
+
+HAL_StatusTypeDef HAL_QSPI_Init(QSPI_HandleTypeDef *hqspi) { return HAL_OK; }
+HAL_StatusTypeDef HAL_QSPI_DeInit(QSPI_HandleTypeDef *hqspi) { return HAL_OK; }
+
+HAL_StatusTypeDef HAL_QSPI_Command(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                   uint32_t timeout) {
+  sim().QspiCommand(hqspi, cmd);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_QSPI_Transmit(QSPI_HandleTypeDef *hqspi, uint8_t *data, uint32_t timeout) {
+  sim().QspiTransmit(hqspi, data, false);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_QSPI_Receive(QSPI_HandleTypeDef *hqspi, uint8_t *data, uint32_t timeout) {
+  sim().QspiReceive(hqspi, data, false);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_QSPI_Transmit_IT(QSPI_HandleTypeDef *hqspi, uint8_t *data) {
+  sim().QspiTransmit(hqspi, data, true);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_QSPI_Receive_IT(QSPI_HandleTypeDef *hqspi, uint8_t *data) {
+  sim().QspiReceive(hqspi, data, true);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_QSPI_AutoPolling(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                       QSPI_AutoPollingTypeDef *config, uint32_t timeout) {
+  hqspi->Command = *cmd;
+  return sim().QspiPoll(hqspi, config, false) ? HAL_OK : HAL_TIMEOUT;
+}
+
+HAL_StatusTypeDef HAL_QSPI_AutoPolling_IT(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                          QSPI_AutoPollingTypeDef *config) {
+  hqspi->Command = *cmd;
+  return sim().QspiPoll(hqspi, config, true) ? HAL_OK : HAL_ERROR;
+}
+
+void HAL_QSPI_IRQHandler(QSPI_HandleTypeDef *hqspi) {
+  int done = hqspi->Done;
+  hqspi->Done = QSPI_NONE;
+  switch (done) {
+  case QSPI_RX: HAL_QSPI_RxCpltCallback(hqspi); break;
+  case QSPI_TX: HAL_QSPI_TxCpltCallback(hqspi); break;
+  case QSPI_MATCH: HAL_QSPI_StatusMatchCallback(hqspi); break;
+  }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// Options of the host simulation of the module (see
+// test/simulator.cc), set before the firmware starts.
+struct SimOptions {
+  char const *script = nullptr; // stimuli, see test/sim/default.sim
+  char const *flash = nullptr;  // flash image, loaded and saved back
+  double seconds = 2.;          // unless the script ends first
+  // target time per host time: how much slower the module runs the
+  // same code than the host
+  double slowdown = 1.;
+  // prints the statistics of the firmware, after those of the simulation
+  void (*report)() = nullptr;
+};
+
+extern SimOptions sim_options;
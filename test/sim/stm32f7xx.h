@@ -0,0 +1,604 @@
+#pragma once
+
+// Host stand-in for the CMSIS device header and for the part of the
+// STM32F7 HAL that the drivers use, so that the firmware builds as is
+// for the simulation of the module (see test/simulator.cc). The HAL
+// calls act on the peripheral models of hal_sim.cc. Registers are
+// plain memory, except the few that the hardware changes behind the
+// firmware's back or that act when written (DMA counters and flags,
+// EXTI flags, PendSV, cycle counter, GPIO set/reset): these are
+// SimRegisters, computed by the models when they are accessed.
+
+#include <stdint.h>
+#include <stddef.h>
+
+extern "C" {
+
+#define __IO volatile
+#define __I volatile const
+#define __weak __attribute__((weak))
+#define UNUSED(X) (void)X
+#define SET_BIT(REG, BIT) ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT) ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT) ((REG) & (BIT))
+
+// as on the module, built without USE_FULL_ASSERT
+#define assert_param(expr) ((void)0U)
+
+extern "C++" {
+struct SimRegister {
+  uint32_t value;
+  operator uint32_t() const;
+  SimRegister& operator=(uint32_t x);
+  SimRegister& operator|=(uint32_t x) { return *this = uint32_t(*this) | x; }
+  SimRegister& operator&=(uint32_t x) { return *this = uint32_t(*this) & x; }
+};
+}
+
+extern uint32_t SystemCoreClock;
+extern __IO uint32_t uwTick;
+
+// Core
+
+typedef enum {
+  MemoryManagement_IRQn = -12,
+  BusFault_IRQn = -11,
+  UsageFault_IRQn = -10,
+  SVCall_IRQn = -5,
+  DebugMonitor_IRQn = -4,
+  PendSV_IRQn = -2,
+  SysTick_IRQn = -1,
+  DMA1_Stream2_IRQn = 13,
+  DMA1_Stream3_IRQn = 14,
+  EXTI9_5_IRQn = 23,
+  DMA2_Stream0_IRQn = 56,
+  DMA2_Stream1_IRQn = 57,
+  DMA2_Stream4_IRQn = 60,
+  QUADSPI_IRQn = 92,
+  kSimNumIrqs = 98,
+} IRQn_Type;
+
+typedef struct {
+  uint32_t CPUID;
+  SimRegister ICSR;
+  uint32_t VTOR, AIRCR, SCR, CCR;
+  uint32_t CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR;
+} SCB_Type;
+
+typedef struct { uint32_t FPCCR, FPCAR, FPDSCR; } FPU_Type;
+typedef struct { uint32_t CTRL; SimRegister CYCCNT; uint32_t LAR; } DWT_Type;
+typedef struct { uint32_t DEMCR; } CoreDebug_Type;
+
+extern SCB_Type sim_scb;
+extern FPU_Type sim_fpu;
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_core_debug;
+
+#define SCB (&sim_scb)
+#define FPU (&sim_fpu)
+#define DWT (&sim_dwt)
+#define CoreDebug (&sim_core_debug)
+
+#define SCB_ICSR_PENDSVSET_Msk (1UL << 28)
+#define FPU_FPDSCR_FZ_Msk (1UL << 24)
+#define FPU_FPDSCR_DN_Msk (1UL << 25)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+// sleeps until an interrupt: this is where the simulation serves them
+void __WFI(void);
+void NVIC_SystemReset(void);
+
+inline void SCB_EnableICache(void) {}
+inline void SCB_EnableDCache(void) {}
+inline void SCB_InvalidateICache(void) {}
+inline void SCB_InvalidateDCache(void) {}
+inline void SCB_CleanDCache_by_Addr(uint32_t *addr, int32_t size) {}
+inline void SCB_InvalidateDCache_by_Addr(uint32_t *addr, int32_t size) {}
+
+// Peripherals
+
+typedef struct {
+  uint32_t MODER, OTYPER, OSPEEDR, PUPDR;
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+  SimRegister BSRR;
+  uint32_t LCKR, AFR[2];
+} GPIO_TypeDef;
+
+typedef struct {
+  uint32_t CR;
+  SimRegister NDTR;
+  uint32_t PAR, M0AR, M1AR, FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+  __IO uint32_t LISR, HISR;
+  SimRegister LIFCR, HIFCR;
+  DMA_Stream_TypeDef stream[8];
+} DMA_TypeDef;
+
+typedef struct { uint32_t CR1, CR2, SR, DR; } SPI_TypeDef;
+typedef struct { uint32_t CR1, CR2, SR, ARR, PSC, CCR1, CCR2, CCR3, CCR4; } TIM_TypeDef;
+typedef struct { uint32_t SR, CR1, CR2, DR; } ADC_TypeDef;
+typedef struct { uint32_t CR1, CR2, FRCR, SLOTR; } SAI_Block_TypeDef;
+typedef struct { uint32_t CR, DCR, SR; } QUADSPI_TypeDef;
+typedef struct { uint32_t CR, PLLCFGR; __IO uint32_t CFGR; } RCC_TypeDef;
+typedef struct { uint32_t IMR, EMR, RTSR, FTSR, SWIER; SimRegister PR; } EXTI_TypeDef;
+
+extern GPIO_TypeDef sim_gpio[9];
+extern DMA_TypeDef sim_dma[2];
+extern SPI_TypeDef sim_spi2;
+extern TIM_TypeDef sim_tim1, sim_tim3, sim_tim7;
+extern ADC_TypeDef sim_adc1, sim_adc3;
+extern SAI_Block_TypeDef sim_sai1_block_a;
+extern QUADSPI_TypeDef sim_quadspi;
+extern RCC_TypeDef sim_rcc;
+extern EXTI_TypeDef sim_exti;
+
+#define GPIOA (&sim_gpio[0])
+#define GPIOB (&sim_gpio[1])
+#define GPIOC (&sim_gpio[2])
+#define GPIOD (&sim_gpio[3])
+#define GPIOE (&sim_gpio[4])
+#define DMA1 (&sim_dma[0])
+#define DMA2 (&sim_dma[1])
+#define DMA1_Stream2 (&sim_dma[0].stream[2])
+#define DMA1_Stream3 (&sim_dma[0].stream[3])
+#define DMA2_Stream0 (&sim_dma[1].stream[0])
+#define DMA2_Stream1 (&sim_dma[1].stream[1])
+#define DMA2_Stream4 (&sim_dma[1].stream[4])
+#define SPI2 (&sim_spi2)
+#define TIM1 (&sim_tim1)
+#define TIM3 (&sim_tim3)
+#define TIM7 (&sim_tim7)
+#define ADC1 (&sim_adc1)
+#define ADC3 (&sim_adc3)
+#define SAI1_Block_A (&sim_sai1_block_a)
+#define QUADSPI (&sim_quadspi)
+#define RCC (&sim_rcc)
+#define EXTI (&sim_exti)
+
+#define SPI_CR1_SPE (1UL << 6)
+#define SPI_CR2_RXDMAEN (1UL << 0)
+#define RCC_CFGR_PPRE1 0x00001C00UL
+
+// HAL: common
+
+typedef enum { HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { DISABLE = 0, ENABLE = 1 } FunctionalState;
+
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+HAL_StatusTypeDef HAL_Init(void);
+HAL_StatusTypeDef HAL_DeInit(void);
+void HAL_Delay(uint32_t delay);
+uint32_t HAL_GetTick(void);
+
+// HAL: clocks and power
+
+typedef struct {
+  uint32_t PLLState, PLLSource, PLLM, PLLN, PLLP, PLLQ;
+} RCC_PLLInitTypeDef;
+
+typedef struct {
+  uint32_t OscillatorType, HSEState, LSEState, HSIState;
+  uint32_t HSICalibrationValue, LSIState;
+  RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct {
+  uint32_t ClockType, SYSCLKSource;
+  uint32_t AHBCLKDivider, APB1CLKDivider, APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+typedef struct { uint32_t PLLI2SN, PLLI2SP, PLLI2SQ, PLLI2SR; } RCC_PLLI2SInitTypeDef;
+
+typedef struct {
+  uint32_t PeriphClockSelection;
+  RCC_PLLI2SInitTypeDef PLLI2S;
+  uint32_t PLLI2SDivQ;
+  uint32_t Sai1ClockSelection;
+} RCC_PeriphCLKInitTypeDef;
+
+#define RCC_OSCILLATORTYPE_HSE 0x1U
+#define RCC_HSE_ON 0x1U
+#define RCC_PLL_ON 0x2U
+#define RCC_PLLSOURCE_HSE 0x1U
+#define RCC_PLLP_DIV2 0x2U
+#define RCC_CLOCKTYPE_SYSCLK 0x1U
+#define RCC_CLOCKTYPE_HCLK 0x2U
+#define RCC_CLOCKTYPE_PCLK1 0x4U
+#define RCC_CLOCKTYPE_PCLK2 0x8U
+#define RCC_SYSCLKSOURCE_PLLCLK 0x2U
+#define RCC_SYSCLK_DIV1 0x0U
+#define RCC_HCLK_DIV1 0x0000U
+#define RCC_HCLK_DIV2 0x1000U
+#define RCC_HCLK_DIV4 0x1400U
+#define RCC_HCLK_DIV8 0x1800U
+#define RCC_HCLK_DIV16 0x1C00U
+#define RCC_PERIPHCLK_SAI1 0x1U
+#define RCC_SAI1CLKSOURCE_PLLI2S 0x1U
+#define FLASH_LATENCY_7 0x7U
+#define PWR_REGULATOR_VOLTAGE_SCALE1 0x3U
+
+HAL_StatusTypeDef HAL_RCC_DeInit(void);
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *init);
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *init, uint32_t latency);
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *init);
+HAL_StatusTypeDef HAL_PWREx_EnableOverDrive(void);
+void HAL_RCCEx_DisablePLLI2S(void);
+void HAL_RCCEx_DisablePLLSAI(void);
+void HAL_RCC_EnableCSS(void);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+
+#define __HAL_RCC_PWR_CLK_ENABLE() do {} while (0)
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(X) do {} while (0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_GPIOD_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_GPIOE_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_DMA1_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_DMA2_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_DMA2_CLK_DISABLE() do {} while (0)
+#define __HAL_RCC_ADC1_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_ADC3_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_SPI2_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_TIM1_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_TIM3_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_TIM7_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_SAI1_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_SAI1_CLK_DISABLE() do {} while (0)
+#define __HAL_RCC_QSPI_CLK_ENABLE() do {} while (0)
+#define __HAL_RCC_QSPI_CLK_DISABLE() do {} while (0)
+#define __HAL_RCC_QSPI_FORCE_RESET() do {} while (0)
+#define __HAL_RCC_QSPI_RELEASE_RESET() do {} while (0)
+
+// HAL: interrupts
+
+#define NVIC_PRIORITYGROUP_2 0x5U
+#define SYSTICK_CLKSOURCE_HCLK 0x4U
+
+void HAL_NVIC_SetPriorityGrouping(uint32_t group);
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub);
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+void HAL_NVIC_DisableIRQ(IRQn_Type irq);
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq);
+void HAL_NVIC_SystemReset(void);
+uint32_t HAL_SYSTICK_Config(uint32_t ticks);
+void HAL_SYSTICK_CLKSourceConfig(uint32_t source);
+
+// HAL: GPIO and EXTI
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct {
+  uint32_t Pin, Mode, Pull, Speed, Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIO_PIN_0 0x0001U
+#define GPIO_PIN_1 0x0002U
+#define GPIO_PIN_2 0x0004U
+#define GPIO_PIN_3 0x0008U
+#define GPIO_PIN_4 0x0010U
+#define GPIO_PIN_5 0x0020U
+#define GPIO_PIN_6 0x0040U
+#define GPIO_PIN_7 0x0080U
+#define GPIO_PIN_8 0x0100U
+#define GPIO_PIN_9 0x0200U
+#define GPIO_PIN_10 0x0400U
+#define GPIO_PIN_11 0x0800U
+#define GPIO_PIN_12 0x1000U
+#define GPIO_PIN_13 0x2000U
+#define GPIO_PIN_14 0x4000U
+#define GPIO_PIN_15 0x8000U
+
+#define GPIO_MODE_INPUT 0x00000000U
+#define GPIO_MODE_OUTPUT_PP 0x00000001U
+#define GPIO_MODE_AF_PP 0x00000002U
+#define GPIO_MODE_ANALOG 0x00000003U
+#define GPIO_MODE_IT_RISING 0x10110000U
+#define GPIO_MODE_IT_FALLING 0x10210000U
+#define GPIO_MODE_IT_RISING_FALLING 0x10310000U
+#define GPIO_NOPULL 0x0U
+#define GPIO_PULLUP 0x1U
+#define GPIO_PULLDOWN 0x2U
+#define GPIO_SPEED_FREQ_LOW 0x0U
+#define GPIO_SPEED_FREQ_MEDIUM 0x1U
+#define GPIO_SPEED_FREQ_HIGH 0x2U
+#define GPIO_SPEED_FREQ_VERY_HIGH 0x3U
+
+#define GPIO_AF1_TIM1 0x1U
+#define GPIO_AF2_TIM3 0x2U
+#define GPIO_AF5_SPI2 0x5U
+#define GPIO_AF6_SAI1 0x6U
+#define GPIO_AF9_QUADSPI 0x9U
+#define GPIO_AF10_QUADSPI 0xAU
+
+void HAL_GPIO_Init(GPIO_TypeDef *gpio, GPIO_InitTypeDef *init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *gpio, uint32_t pins);
+void HAL_GPIO_WritePin(GPIO_TypeDef *gpio, uint16_t pin, GPIO_PinState state);
+
+#define __HAL_GPIO_EXTI_GET_IT(PIN) (EXTI->PR & (PIN))
+#define __HAL_GPIO_EXTI_CLEAR_IT(PIN) (EXTI->PR = (PIN))
+
+// HAL: DMA
+
+typedef struct {
+  uint32_t Channel, Direction, PeriphInc, MemInc;
+  uint32_t PeriphDataAlignment, MemDataAlignment;
+  uint32_t Mode, Priority, FIFOMode, FIFOThreshold, MemBurst, PeriphBurst;
+} DMA_InitTypeDef;
+
+typedef struct {
+  DMA_Stream_TypeDef *Instance;
+  DMA_InitTypeDef Init;
+  void *Parent;
+} DMA_HandleTypeDef;
+
+typedef enum { HAL_DMA_FULL_TRANSFER, HAL_DMA_HALF_TRANSFER } HAL_DMA_LevelCompleteTypeDef;
+
+#define DMA_CHANNEL_0 0x00000000U
+#define DMA_CHANNEL_1 0x02000000U
+#define DMA_CHANNEL_2 0x04000000U
+#define DMA_PERIPH_TO_MEMORY 0x00000000U
+#define DMA_MEMORY_TO_PERIPH 0x00000040U
+#define DMA_PINC_DISABLE 0x0U
+#define DMA_MINC_ENABLE 0x00000400U
+#define DMA_PDATAALIGN_HALFWORD 0x00000800U
+#define DMA_PDATAALIGN_WORD 0x00001000U
+#define DMA_MDATAALIGN_HALFWORD 0x00002000U
+#define DMA_CIRCULAR 0x00000100U
+#define DMA_PRIORITY_MEDIUM 0x00010000U
+#define DMA_PRIORITY_HIGH 0x00020000U
+#define DMA_FIFOMODE_DISABLE 0x0U
+#define DMA_MBURST_SINGLE 0x0U
+#define DMA_PBURST_SINGLE 0x0U
+
+// stream control bits and the flags of stream 1 (or 5), as on the chip
+#define DMA_IT_HT 0x00000008U
+#define DMA_IT_TC 0x00000010U
+#define DMA_FLAG_FEIF1_5 0x00000040U
+#define DMA_FLAG_DMEIF1_5 0x00000100U
+#define DMA_FLAG_TEIF1_5 0x00000200U
+#define DMA_FLAG_HTIF1_5 0x00000400U
+#define DMA_FLAG_TCIF1_5 0x00000800U
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uintptr_t src, uintptr_t dst, uint32_t length);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_LevelCompleteTypeDef level, uint32_t timeout);
+
+// flag [flag0] of stream 0, moved to the stream of [hdma]
+uint32_t SimDmaFlag(DMA_HandleTypeDef *hdma, uint32_t flag0);
+void SimDmaClearFlag(DMA_HandleTypeDef *hdma, uint32_t flag);
+
+#define __HAL_DMA_GET_TC_FLAG_INDEX(H) SimDmaFlag(H, 0x20U)
+#define __HAL_DMA_GET_HT_FLAG_INDEX(H) SimDmaFlag(H, 0x10U)
+#define __HAL_DMA_GET_IT_SOURCE(H, IT) ((H)->Instance->CR & (IT))
+#define __HAL_DMA_CLEAR_FLAG(H, FLAG) SimDmaClearFlag(H, FLAG)
+#define __HAL_DMA_GET_COUNTER(H) ((H)->Instance->NDTR)
+
+#define __HAL_LINKDMA(PARENT, FIELD, DMA) do {  \
+    (PARENT)->FIELD = &(DMA);                   \
+    (DMA).Parent = (PARENT);                    \
+  } while (0)
+
+// HAL: ADC
+
+typedef struct {
+  uint32_t ClockPrescaler, Resolution, DataAlign, ScanConvMode, EOCSelection;
+  uint32_t ContinuousConvMode, NbrOfConversion, DiscontinuousConvMode;
+  uint32_t NbrOfDiscConversion, ExternalTrigConv, ExternalTrigConvEdge;
+  uint32_t DMAContinuousRequests;
+} ADC_InitTypeDef;
+
+typedef struct {
+  uint32_t Channel, Rank, SamplingTime, Offset;
+} ADC_ChannelConfTypeDef;
+
+typedef struct {
+  ADC_TypeDef *Instance;
+  ADC_InitTypeDef Init;
+  DMA_HandleTypeDef *DMA_Handle;
+} ADC_HandleTypeDef;
+
+#define ADC_CHANNEL_0 0U
+#define ADC_CHANNEL_1 1U
+#define ADC_CHANNEL_2 2U
+#define ADC_CHANNEL_3 3U
+#define ADC_CHANNEL_4 4U
+#define ADC_CHANNEL_5 5U
+#define ADC_CHANNEL_6 6U
+#define ADC_CHANNEL_7 7U
+#define ADC_CHANNEL_8 8U
+#define ADC_CHANNEL_9 9U
+#define ADC_CHANNEL_10 10U
+#define ADC_CHANNEL_11 11U
+#define ADC_CHANNEL_12 12U
+#define ADC_CHANNEL_13 13U
+#define ADC_CHANNEL_14 14U
+#define ADC_CHANNEL_15 15U
+#define ADC_REGULAR_RANK_1 1U
+#define ADC_SAMPLETIME_144CYCLES 6U
+#define ADC_CLOCK_SYNC_PCLK_DIV8 0x30000U
+#define ADC_RESOLUTION_12B 0x0U
+#define ADC_DATAALIGN_LEFT 0x800U
+#define ADC_EOC_SEQ_CONV 0x0U
+#define ADC_EXTERNALTRIGCONVEDGE_NONE 0x0U
+#define ADC_SOFTWARE_START 0x0F000001U
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *config);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length);
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc);
+
+// HAL: SPI
+
+typedef struct {
+  uint32_t Mode, Direction, DataSize, CLKPolarity, CLKPhase, NSS;
+  uint32_t BaudRatePrescaler, FirstBit, TIMode, CRCCalculation;
+  uint32_t CRCPolynomial, CRCLength, NSSPMode;
+} SPI_InitTypeDef;
+
+typedef struct {
+  SPI_TypeDef *Instance;
+  SPI_InitTypeDef Init;
+} SPI_HandleTypeDef;
+
+#define SPI_BAUDRATEPRESCALER_2 0x0U
+#define SPI_DIRECTION_2LINES 0x0U
+#define SPI_PHASE_1EDGE 0x0U
+#define SPI_POLARITY_LOW 0x0U
+#define SPI_DATASIZE_16BIT 0xF00U
+#define SPI_FIRSTBIT_MSB 0x0U
+#define SPI_TIMODE_DISABLE 0x0U
+#define SPI_CRCCALCULATION_DISABLE 0x0U
+#define SPI_NSS_HARD_OUTPUT 0x40000U
+#define SPI_NSS_PULSE_ENABLE 0x8U
+#define SPI_MODE_MASTER 0x104U
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+
+// HAL: timers
+
+typedef struct {
+  uint32_t Prescaler, CounterMode, Period, ClockDivision;
+  uint32_t RepetitionCounter, AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct {
+  TIM_TypeDef *Instance;
+  TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+typedef struct {
+  uint32_t OCMode, Pulse, OCPolarity, OCNPolarity, OCFastMode;
+  uint32_t OCIdleState, OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+#define TIM_CHANNEL_1 0x0U
+#define TIM_CHANNEL_2 0x4U
+#define TIM_CHANNEL_3 0x8U
+#define TIM_COUNTERMODE_UP 0x0U
+#define TIM_CLOCKDIVISION_DIV1 0x0U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0x0U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE 0x80U
+#define TIM_OCMODE_PWM1 0x60U
+#define TIM_OCPOLARITY_LOW 0x2U
+#define TIM_OCNPOLARITY_HIGH 0x0U
+#define TIM_OCFAST_DISABLE 0x0U
+#define TIM_OCIDLESTATE_RESET 0x0U
+#define TIM_OCNIDLESTATE_RESET 0x0U
+#define TIM_DMA_UPDATE 0x100U
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *config, uint32_t channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel);
+
+#define __HAL_TIM_ENABLE_DMA(H, DMA) ((H)->Instance->CR2 |= (DMA))
+
+// HAL: SAI
+
+typedef struct {
+  uint32_t AudioMode, Synchro, SynchroExt, OutputDrive, NoDivider;
+  uint32_t FIFOThreshold, AudioFrequency, Mckdiv, MonoStereoMode;
+  uint32_t CompandingMode, TriState;
+} SAI_InitTypeDef;
+
+typedef struct {
+  SAI_Block_TypeDef *Instance;
+  SAI_InitTypeDef Init;
+  DMA_HandleTypeDef *hdmatx;
+} SAI_HandleTypeDef;
+
+#define SAI_MODEMASTER_TX 0x0U
+#define SAI_ASYNCHRONOUS 0x0U
+#define SAI_OUTPUTDRIVE_DISABLE 0x0U
+#define SAI_MASTERDIVIDER_ENABLE 0x0U
+#define SAI_FIFOTHRESHOLD_EMPTY 0x0U
+#define SAI_SYNCEXT_DISABLE 0x0U
+#define SAI_STEREOMODE 0x0U
+#define SAI_NOCOMPANDING 0x0U
+#define SAI_OUTPUT_NOTRELEASED 0x0U
+#define SAI_I2S_STANDARD 0x0U
+#define SAI_PROTOCOL_DATASIZE_24BIT 0x2U
+
+#define IS_SAI_AUDIO_FREQUENCY(F)                                       \
+  ((F) == 192000U || (F) == 96000U || (F) == 48000U || (F) == 44100U || \
+   (F) == 32000U || (F) == 22050U || (F) == 16000U || (F) == 11025U ||  \
+   (F) == 8000U)
+
+HAL_StatusTypeDef HAL_SAI_InitProtocol(SAI_HandleTypeDef *hsai, uint32_t protocol, uint32_t datasize, uint32_t nbslot);
+HAL_StatusTypeDef HAL_SAI_DeInit(SAI_HandleTypeDef *hsai);
+HAL_StatusTypeDef HAL_SAI_Transmit_DMA(SAI_HandleTypeDef *hsai, uint8_t *data, uint16_t size);
+HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai);
+
+// HAL: QSPI
+
+typedef struct {
+  uint32_t ClockPrescaler, FifoThreshold, SampleShifting, FlashSize;
+  uint32_t ChipSelectHighTime, ClockMode, FlashID, DualFlash;
+} QSPI_InitTypeDef;
+
+typedef struct {
+  uint32_t Instruction, Address, AlternateBytes, AddressSize;
+  uint32_t AlternateBytesSize, DummyCycles, InstructionMode, AddressMode;
+  uint32_t AlternateByteMode, DataMode, NbData, DdrMode, DdrHoldHalfCycle;
+  uint32_t SIOOMode;
+} QSPI_CommandTypeDef;
+
+typedef struct {
+  uint32_t Match, Mask, Interval, StatusBytesSize, MatchMode, AutomaticStop;
+} QSPI_AutoPollingTypeDef;
+
+typedef struct {
+  QUADSPI_TypeDef *Instance;
+  QSPI_InitTypeDef Init;
+  QSPI_CommandTypeDef Command;  // the last one sent
+  uint32_t Done;                // what the next interrupt completes
+} QSPI_HandleTypeDef;
+
+#define HAL_QPSI_TIMEOUT_DEFAULT_VALUE 5000U
+#define QSPI_SAMPLE_SHIFTING_HALFCYCLE 0x10U
+#define QSPI_CS_HIGH_TIME_8_CYCLE 0x7U
+#define QSPI_CLOCK_MODE_0 0x0U
+#define QSPI_FLASH_ID_2 0x80U
+#define QSPI_DUALFLASH_DISABLE 0x0U
+#define QSPI_INSTRUCTION_1_LINE 0x100U
+#define QSPI_ADDRESS_NONE 0x0U
+#define QSPI_ADDRESS_1_LINE 0x400U
+#define QSPI_ADDRESS_4_LINES 0xC00U
+#define QSPI_ADDRESS_24_BITS 0x2000U
+#define QSPI_ALTERNATE_BYTES_NONE 0x0U
+#define QSPI_ALTERNATE_BYTES_4_LINES 0xC000U
+#define QSPI_ALTERNATE_BYTES_8_BITS 0x0U
+#define QSPI_DATA_NONE 0x0U
+#define QSPI_DATA_1_LINE 0x1000000U
+#define QSPI_DATA_4_LINES 0x3000000U
+#define QSPI_DDR_MODE_DISABLE 0x0U
+#define QSPI_DDR_HHC_ANALOG_DELAY 0x0U
+#define QSPI_SIOO_INST_EVERY_CMD 0x0U
+#define QSPI_MATCH_MODE_AND 0x0U
+#define QSPI_AUTOMATIC_STOP_ENABLE 0x400000U
+
+HAL_StatusTypeDef HAL_QSPI_Init(QSPI_HandleTypeDef *hqspi);
+HAL_StatusTypeDef HAL_QSPI_DeInit(QSPI_HandleTypeDef *hqspi);
+HAL_StatusTypeDef HAL_QSPI_Command(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, uint32_t timeout);
+HAL_StatusTypeDef HAL_QSPI_Transmit(QSPI_HandleTypeDef *hqspi, uint8_t *data, uint32_t timeout);
+HAL_StatusTypeDef HAL_QSPI_Receive(QSPI_HandleTypeDef *hqspi, uint8_t *data, uint32_t timeout);
+HAL_StatusTypeDef HAL_QSPI_Transmit_IT(QSPI_HandleTypeDef *hqspi, uint8_t *data);
+HAL_StatusTypeDef HAL_QSPI_Receive_IT(QSPI_HandleTypeDef *hqspi, uint8_t *data);
+HAL_StatusTypeDef HAL_QSPI_AutoPolling(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, QSPI_AutoPollingTypeDef *config, uint32_t timeout);
+HAL_StatusTypeDef HAL_QSPI_AutoPolling_IT(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, QSPI_AutoPollingTypeDef *config);
+void HAL_QSPI_IRQHandler(QSPI_HandleTypeDef *hqspi);
+void HAL_QSPI_RxCpltCallback(QSPI_HandleTypeDef *hqspi);
+void HAL_QSPI_TxCpltCallback(QSPI_HandleTypeDef *hqspi);
+void HAL_QSPI_StatusMatchCallback(QSPI_HandleTypeDef *hqspi);
+
+}
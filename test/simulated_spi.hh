@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdlib>
+#include "max11666.hh"
+
+// A simulated SPI peripheral playing the part of TIM7, of the two DMA
+// streams and of the MAX11666: every word sent selects the channel of
+// the conversions to come, the reads shortly after a switch are
+// garbage, and the words received land in the circular buffer while
+// the DMA counter counts down.
+struct SimulatedSpi {
+  using Stream = Max11666Stream;
+
+  // words between a switch command and the first clean read
+  static constexpr int kSettleWords = 5;
+
+  uint16_t tx[Stream::kWords];
+  uint16_t rx[Stream::kWords];
+  uint32_t ndtr = Stream::kWords;       // DMA counter, counts down
+
+  int codes[NUM_SPI_ADC_CHANNELS] = {}; // 12-bit input of each channel
+  int chan = 0, since_switch = 0;
+
+  // the last clean reads of each channel, most recent last
+  int history[NUM_SPI_ADC_CHANNELS][kOversamplingAmount] = {};
+
+  SimulatedSpi() { Stream::Sequence(tx); }
+
+  int position() { return Stream::kWords - ndtr; }
+
+  // one TIM7 update: send a word, receive one
+  void Tick() {
+    int i = position();
+    uint16_t command = tx[i];
+    if (command == MAX11666_SWITCH_TO_CH1) { chan = 0; since_switch = 0; }
+    if (command == MAX11666_SWITCH_TO_CH2) { chan = 1; since_switch = 0; }
+
+    int code = since_switch < kSettleWords ? rand() & 0xFFF : codes[chan];
+    rx[i] = code << 2;
+    if (i % Stream::kGroupWords >= kOversamplingThrowoutReads) {
+      for (int k=0; k<kOversamplingAmount-1; k++)
+        history[chan][k] = history[chan][k+1];
+      history[chan][kOversamplingAmount-1] = code;
+    }
+    since_switch++;
+    if (--ndtr == 0) ndtr = Stream::kWords;
+  }
+
+  // what SpiAdc::get used to return, from the same reads
+  u0_16 expected(int c) {
+    Stream::sum_t sum = Stream::sum_t::of_repr(0);
+    for (int code : history[c]) sum += Stream::sum_t::of_repr(code);
+    return u0_16::wrap(sum);
+  }
+};
@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "simulation.hh"
+#include "main.cc"
+
+// Host simulation of the whole module: the firmware of src/main.cc,
+// unchanged, runs on the peripheral models of test/sim/hal_sim.cc,
+// which stand in for the HAL. A script moves the pots, switches,
+// buttons, CV and gates on a virtual clock; the DAC, SysTick, the
+// gates and the flash interrupt the firmware as on the module. At the
+// end, reports the cost, latency and response time of each interrupt,
+// the load of each context, and the statistics of the firmware itself.
+//
+// Times are those of the host, scaled by the slowdown: calibrate it
+// against the module (e.g. the audio interrupt under gdb, or test/bench
+// on both) to read the report in module time. The maxima also catch
+// the hiccups of the host: run it a few times, on a quiet machine.
+//
+// usage: simulator [-x slowdown] [-t seconds] [-f flash.bin] [script]
+
+static void Report() {
+  auto const& dac = _.overrun_stats();
+  printf("\naudio: %u blocks of %d, %u late, at most %u frames late\n",
+         dac.blocks, _.Dac::block_size(), dac.overruns, dac.max_lateness);
+
+  static char const *stages[] = {"tables", "flash", "dac", "ui", "first block",
+                                 "stored", "bands"};
+  static_assert(sizeof(stages) / sizeof(*stages) == kNumBootStages);
+  printf("boot:");
+  for (int i=0; i<kNumBootStages; i++)
+    printf(" %s %.2f ms%s", stages[i], boot_stamps[i] * 1e3 / SystemCoreClock,
+           i < kNumBootStages-1 ? "," : "\n");
+
+  auto const& g = _.osc().governor().counters();
+  printf("governor: %u blocks, %u overloads, %u degraded, %u steps down, "
+         "%u steps up, max level %u\n", g.blocks, g.overloads,
+         g.degraded_blocks, g.step_downs, g.step_ups, g.max_level);
+
+#ifdef PROFILE
+  static char const *names[] = {
+    "block", "oscillators", "pairs", "bank", "output", "ui poll", "control poll",
+  };
+  static_assert(sizeof(names) / sizeof(*names) == kNumProfileRegions);
+  printf("\n%-14s %10s %10s %10s\n", "region", "count", "avg us", "max us");
+  for (int i=0; i<kNumProfileRegions; i++) {
+    auto& c = profile_table[i];
+    printf("%-14s %10u %10.2f %10.2f\n", names[i], c.count,
+           c.avg() * 1e6 / SystemCoreClock, c.max * 1e6 / double(SystemCoreClock));
+  }
+#endif
+}
+
+// before the static constructors, which run the firmware
+__attribute__((constructor(101)))
+static void Setup(int argc, char **argv) {
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i], "-x") && i+1 < argc) sim_options.slowdown = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-t") && i+1 < argc) sim_options.seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-f") && i+1 < argc) sim_options.flash = argv[++i];
+    else if (argv[i][0] != '-') sim_options.script = argv[i];
+    else {
+      fprintf(stderr, "usage: %s [-x slowdown] [-t seconds] [-f flash.bin] [script]\n",
+              argv[0]);
+      exit(1);
+    }
+  }
+  sim_options.report = Report;
+}
+
+// never reached: the firmware runs from the constructor of Main, and
+// the simulation exits when the script ends
+int main() { return 0; }
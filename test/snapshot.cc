@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <thread>
+#include <atomic>
+#include "snapshot.hh"
+
+// Host test for Snapshot: a writer thread publishes records whose
+// fields all hold the same sequence number, while a reader thread
+// checks that every record it reads is whole and that sequence numbers
+// never go backwards.
+//
+// usage: snapshot [writes]
+
+struct Record {
+  static constexpr int kSize = 32;
+  uint32_t words[kSize];
+
+  void fill(uint32_t seq) { for (auto& w : words) w = seq; }
+  bool whole() const {
+    for (auto w : words) if (w != words[0]) return false;
+    return true;
+  }
+};
+
+int main(int argc, char *argv[]) {
+  uint32_t writes = argc > 1 ? atoi(argv[1]) : 10000000;
+
+  Record init;
+  init.fill(0);
+  static Snapshot<Record> snapshot {init};
+  std::atomic<bool> done {false};
+
+  std::thread writer([&] {
+    Record r;
+    for (uint32_t seq=1; seq<=writes; seq++) {
+      r.fill(seq);
+      snapshot.Write(r);
+    }
+    done = true;
+  });
+
+  uint32_t reads = 0, torn = 0, backwards = 0, updates = 0, last = 0;
+  for (;;) {
+    bool finished = done;
+    Record const& r = snapshot.Read();
+    reads++;
+    if (!r.whole()) torn++;
+    if (r.words[0] < last) backwards++;
+    if (r.words[0] != last) updates++;
+    last = r.words[0];
+    if (finished) break;
+  }
+  writer.join();
+
+  printf("%u writes, %u reads, %u updates seen, %u torn, %u backwards, last %u\n",
+         writes, reads, updates, torn, backwards, last);
+
+  if (torn || backwards || last != writes) {
+    printf("FAIL\n");
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
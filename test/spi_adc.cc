@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <cstdlib>
+#include "simulated_spi.hh"
+#include "check.hh"
+
+// Host test for the DMA acquisition of the MAX11666, against a
+// simulated SPI peripheral (see simulated_spi.hh). The decoder is
+// checked against a plain re-sum of the last reads of each channel,
+// whenever it is called.
+
+using Stream = Max11666Stream;
+
+static bool matches(Stream& s, SimulatedSpi& spi) {
+  return s.get(CV_PITCH).repr() == spi.expected(CV_PITCH).repr() &&
+    s.get(CV_ROOT).repr() == spi.expected(CV_ROOT).repr();
+}
+
+int main() {
+  static SimulatedSpi spi;
+  static Stream stream;
+
+  bool switches = true;
+  for (int i=0; i<Stream::kWords; i++) {
+    bool first = i % Stream::kGroupWords == 0;
+    bool pitch = i % Stream::kFrameWords < Stream::kGroupWords;
+    switches &= spi.tx[i] == (pitch
+                              ? (first ? MAX11666_SWITCH_TO_CH1 : MAX11666_CONTINUE_READING_CH1)
+                              : (first ? MAX11666_SWITCH_TO_CH2 : MAX11666_CONTINUE_READING_CH2));
+  }
+  check(switches, "sequences the channels in the transmit buffer");
+
+  // constant inputs; a whole buffer would look like no word at all
+  spi.codes[CV_PITCH] = 0x123;
+  spi.codes[CV_ROOT] = 0xABC;
+  for (int i=0; i<Stream::kWords - 1; i++) spi.Tick();
+  stream.Process(spi.rx, spi.position());
+  check(matches(stream, spi) &&
+        stream.get(CV_PITCH).repr() == 0x123 << 4 &&
+        stream.get(CV_ROOT).repr() == 0xABC << 4,
+        "averages each channel, without the reads after a switch");
+
+  // moving inputs, read at irregular intervals, as the control blocks
+  // of any size would
+  bool exact = true;
+  for (int n=0; n<100000; n++) {
+    int words = rand() % (Stream::kWords - 1);
+    for (int i=0; i<words; i++) {
+      spi.codes[CV_PITCH] = (spi.codes[CV_PITCH] + 1) & 0xFFF;
+      spi.codes[CV_ROOT] = rand() & 0xFFF;
+      spi.Tick();
+    }
+    stream.Process(spi.rx, spi.position());
+    exact &= matches(stream, spi);
+  }
+  check(exact, "keeps its running sums exact");
+
+  // a reader more than a buffer late sees mixed reads for a while, but
+  // recovers as soon as it has caught up
+  for (int i=0; i<Stream::kWords * 7 / 2; i++) spi.Tick();
+  stream.Process(spi.rx, spi.position());
+  bool bounded = stream.get(CV_PITCH).repr() <= 0xFFF << 4 &&
+    stream.get(CV_ROOT).repr() <= 0xFFF << 4;
+  spi.codes[CV_PITCH] = 0x800;
+  spi.codes[CV_ROOT] = 0x400;
+  for (int i=0; i<Stream::kFrameWords; i++) spi.Tick();
+  stream.Process(spi.rx, spi.position());
+  check(bounded && matches(stream, spi), "recovers from a reader falling behind");
+
+  return report();
+}
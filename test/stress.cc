@@ -0,0 +1,375 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <new>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <tuple>
+#include "parameters.hh"
+#include "dsp.hh"
+#include "data.hh"
+#include "polyptic_oscillator.hh"
+
+// Host worst-case finder: searches the parameter space for the
+// configurations where one call to PolypticOscillator::Process is the
+// most expensive, and reports them with the distribution of their cost
+// per block. The block size is one of the dimensions: the search ranks
+// the cost against the deadline of the block. The report doubles as a regression set: --check re-runs
+// every configuration of a previous report and flags those whose p99
+// went up by more than the tolerance.
+//
+// usage: stress [output.csv] [samples] [seed]
+//        stress --check set.csv [tolerance_pct]
+
+constexpr int kWarmupBlocks = 64;
+constexpr int kSearchBlocks = 512;
+constexpr int kReportBlocks = 20000;
+constexpr int kClimbers = 8;
+constexpr int kClimbSteps = 40;
+constexpr int kReportSize = 10;
+
+static char const *twist_names[] = {"feedback", "pulsar", "crush"};
+static char const *warp_names[] = {"fold", "cheby", "segment"};
+static char const *modulation_names[] = {"one", "two", "three"};
+static char const *scale_names[] = {"twelve", "octave", "free"};
+static char const *split_names[] = {"alternate", "low_high", "lowest_rest"};
+
+// pot ranges, as in control.hh
+constexpr f kRootPotRange = 9_f * 12_f;
+constexpr f kPitchPotRange = 6_f * 12_f;
+constexpr f kSpreadRange = 12_f;
+
+struct Config {
+  int twist, warp, modulation, scale_mode, scale;
+  int numOsc;
+  int block_size;
+  int stereo_mode;
+  bool frozen;
+  bool pre_listen;
+  bool moving;                  // pots swept at every block, as by CV
+  // pot positions, 0..1
+  double twist_pot, warp_pot, modulation_pot;
+  double spread_pot, detune_pot, crossfade_pot, root_pot, pitch_pot;
+};
+
+struct Stats {
+  double p50, p99, max;
+};
+
+// ns
+static double deadline(Config const &c) { return 1e9 * c.block_size / kSampleRate; }
+
+// pot positions scaled like Control::Poll does; [sweep] offsets every
+// pot for moving configurations
+static Parameters parameters(Config const &c, f sweep) {
+  auto pot = [&](double x) { return (f(float(x)) + sweep).clip(0_f, 1_f); };
+
+  f twist = Signal::crop_down(0.01_f, pot(c.twist_pot));
+  twist =
+    c.twist == FEEDBACK ? twist * twist * 0.7_f :
+    c.twist == PULSAR ? Math::fast_exp2(twist * twist * 6_f) :
+    twist * twist * 0.5_f;
+
+  f warp = Signal::crop_down(0.01_f, pot(c.warp_pot));
+  if (c.warp == FOLD) warp = warp * warp * 0.9_f + 0.004_f;
+
+  f mod = Signal::crop_down(0.01_f, pot(c.modulation_pot));
+  mod *= 6_f / f(c.numOsc);
+  mod *= c.modulation == ONE ? 6_f : c.modulation == TWO ? 0.9_f : 4_f;
+
+  f detune = pot(c.detune_pot);
+  detune = (detune * detune) * (detune * detune) * (10_f / f(kMaxNumOsc));
+
+  f crossfade = pot(c.crossfade_pot);
+  crossfade = (1_f - crossfade * crossfade) * 0.5_f;
+
+  return {
+    .balance = 1_f,
+    .root = pot(c.root_pot) * kRootPotRange,
+    .pitch = (pot(c.pitch_pot) - 0.5_f) * kPitchPotRange,
+    .spread = pot(c.spread_pot) * (10_f / f(kMaxNumOsc)) * kSpreadRange,
+    .detune = detune,
+    .modulation = {.mode = ModulationMode(c.modulation), .value = mod},
+    .scale = {.mode = ScaleMode(c.scale_mode), .value = c.scale},
+    .twist = {.mode = TwistMode(c.twist), .value = twist},
+    .warp = {.mode = WarpMode(c.warp), .value = warp},
+    .alt = {
+      .numOsc = c.numOsc,
+      .stereo_mode = SplitMode(c.stereo_mode),
+      .freeze_mode = LOW_HIGH,
+      .crossfade_factor = crossfade,
+    },
+    .new_note = pot(c.root_pot) * kRootPotRange,
+    .fine_tune = 0_f,
+  };
+}
+
+// cost of every block, in ns, sorted
+template<int block_size>
+static std::vector<double> measure(Config const &c, int blocks) {
+  Parameters params = parameters(c, 0_f);
+
+  // on the module, the oscillator lives in zero-initialized static
+  // memory; reproduce this so that results are deterministic
+  using Osc = PolypticOscillator;
+  alignas(Osc) static uint8_t storage[sizeof(Osc)];
+  memset(storage, 0, sizeof(storage));
+  // the compiler may otherwise drop the memset as a dead store before
+  // the constructor (-flifetime-dse)
+  asm volatile("" : : "r"(storage) : "memory");
+  Osc &osc = *new (storage) Osc(params);
+  osc.set_freeze(c.frozen);
+  if (c.pre_listen) {
+    osc.enable_learn();
+    for (int i=0; i<4; i++) osc.new_note(params.scale, params.root + f(i * 5));
+    osc.enable_pre_listen();
+    osc.enable_follow_new_note();
+  }
+
+  Buffer<Frame, block_size> out;
+  static volatile uint32_t sink;
+  std::vector<double> times(blocks);
+
+  for (int i=-kWarmupBlocks; i<blocks; i++) {
+    if (c.moving) {
+      // triangle sweep of +-0.05 over 256 blocks
+      int t = i & 255;
+      f sweep = f(t < 128 ? t : 256 - t) * (0.1_f / 128_f) - 0.05_f;
+      params = parameters(c, sweep);
+    }
+    auto start = std::chrono::steady_clock::now();
+    osc.Process<block_size>(out.data());
+    auto end = std::chrono::steady_clock::now();
+    if (i >= 0) times[i] = std::chrono::duration<double, std::nano>(end - start).count();
+    sink = out[0].l.repr();
+  }
+
+  std::sort(times.begin(), times.end());
+  return times;
+}
+
+static std::vector<double> measure(Config const &c, int blocks) {
+  std::vector<double> times;
+  with_block_size(c.block_size, [&](auto size) {
+    times = measure<decltype(size)::value>(c, blocks);
+  });
+  return times;
+}
+
+static Stats stats(std::vector<double> const &t) {
+  auto pct = [&](double p) { return t[std::min(t.size() - 1, size_t(p * t.size()))]; };
+  return {pct(0.5), pct(0.99), t.back()};
+}
+
+// the search ranks by p99 over the deadline: the maximum of a short
+// run is mostly noise, and larger blocks cost more
+static double score(Config const &c) {
+  return stats(measure(c, kSearchBlocks)).p99 / deadline(c);
+}
+
+static Config random_config(std::mt19937 &rng) {
+  auto pick = [&](int n) { return int(rng() % n); };
+  auto pot = [&]() { return std::uniform_real_distribution<double>(0, 1)(rng); };
+  return {
+    pick(3), pick(3), pick(3), pick(3), pick(10),
+    pick(kMaxNumOsc) + 1,
+    kBlockSizes[pick(std::size(kBlockSizes))],
+    pick(3),
+    bool(pick(2)), pick(4) == 0, bool(pick(2)),
+    pot(), pot(), pot(), pot(), pot(), pot(), pot(), pot(),
+  };
+}
+
+// changes one dimension of [c]
+static Config mutate(Config c, std::mt19937 &rng) {
+  Config r = random_config(rng);
+  auto nudge = [&](double &x) {
+    x = std::clamp(x + std::normal_distribution<double>(0, 0.1)(rng), 0.0, 1.0);
+  };
+  switch (rng() % 19) {
+  case 0: c.twist = r.twist; break;
+  case 1: c.warp = r.warp; break;
+  case 2: c.modulation = r.modulation; break;
+  case 3: c.scale_mode = r.scale_mode; c.scale = r.scale; break;
+  case 4: c.numOsc = std::clamp(c.numOsc + int(rng() % 5) - 2, 1, kMaxNumOsc); break;
+  case 5: c.stereo_mode = r.stereo_mode; break;
+  case 6: c.frozen = !c.frozen; break;
+  case 7: c.pre_listen = !c.pre_listen; break;
+  case 8: c.moving = !c.moving; break;
+  case 9: nudge(c.twist_pot); break;
+  case 10: nudge(c.warp_pot); break;
+  case 11: nudge(c.modulation_pot); break;
+  case 12: nudge(c.spread_pot); break;
+  case 13: nudge(c.detune_pot); break;
+  case 14: nudge(c.crossfade_pot); break;
+  case 15: nudge(c.root_pot); break;
+  case 16: nudge(c.pitch_pot); break;
+  case 17: c.numOsc = r.numOsc; break;
+  case 18: c.block_size = r.block_size; break;
+  }
+  return c;
+}
+
+static auto fields(Config const &c) {
+  return std::tie(c.twist, c.warp, c.modulation, c.scale_mode, c.scale, c.numOsc,
+                  c.block_size, c.stereo_mode, c.frozen, c.pre_listen, c.moving,
+                  c.twist_pot, c.warp_pot, c.modulation_pot, c.spread_pot,
+                  c.detune_pot, c.crossfade_pot, c.root_pot, c.pitch_pot);
+}
+
+static bool same(Config const &a, Config const &b) {
+  return fields(a) == fields(b);
+}
+
+static char const *csv_header =
+  "twist,warp,modulation,scale_mode,scale,num_osc,block_size,stereo_mode,frozen,pre_listen,moving,"
+  "twist_pot,warp_pot,modulation_pot,spread_pot,detune_pot,crossfade_pot,root_pot,pitch_pot,"
+  "p50_ns,p99_ns,max_ns,p99_deadline_pct\n";
+
+static void print(FILE *out, Config const &c, Stats const &s) {
+  fprintf(out, "%s,%s,%s,%s,%d,%d,%d,%s,%d,%d,%d,"
+          "%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,"
+          "%.1f,%.1f,%.1f,%.2f\n",
+          twist_names[c.twist], warp_names[c.warp], modulation_names[c.modulation],
+          scale_names[c.scale_mode], c.scale, c.numOsc, c.block_size,
+          split_names[c.stereo_mode],
+          c.frozen, c.pre_listen, c.moving,
+          c.twist_pot, c.warp_pot, c.modulation_pot, c.spread_pot,
+          c.detune_pot, c.crossfade_pot, c.root_pot, c.pitch_pot,
+          s.p50, s.p99, s.max, 100.0 * s.p99 / deadline(c));
+}
+
+static int lookup(char const *name, char const *const *names, int n) {
+  for (int i=0; i<n; i++)
+    if (strcmp(name, names[i]) == 0) return i;
+  return -1;
+}
+
+static bool parse(char *line, Config &c, Stats &s) {
+  char t[16], w[16], m[16], sm[16], st[16];
+  int frozen, pre_listen, moving;
+  int n = sscanf(line,
+                 "%15[^,],%15[^,],%15[^,],%15[^,],%d,%d,%d,%15[^,],%d,%d,%d,"
+                 "%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf",
+                 t, w, m, sm, &c.scale, &c.numOsc, &c.block_size, st, &frozen, &pre_listen, &moving,
+                 &c.twist_pot, &c.warp_pot, &c.modulation_pot, &c.spread_pot,
+                 &c.detune_pot, &c.crossfade_pot, &c.root_pot, &c.pitch_pot,
+                 &s.p50, &s.p99, &s.max);
+  c.twist = lookup(t, twist_names, 3);
+  c.warp = lookup(w, warp_names, 3);
+  c.modulation = lookup(m, modulation_names, 3);
+  c.scale_mode = lookup(sm, scale_names, 3);
+  c.stereo_mode = lookup(st, split_names, 3);
+  c.frozen = frozen;
+  c.pre_listen = pre_listen;
+  c.moving = moving;
+  return n == 22 && c.twist >= 0 && c.warp >= 0 && c.modulation >= 0 &&
+    c.scale_mode >= 0 && c.stereo_mode >= 0 &&
+    c.numOsc >= 1 && c.numOsc <= kMaxNumOsc &&
+    std::count(std::begin(kBlockSizes), std::end(kBlockSizes), c.block_size);
+}
+
+static int search(FILE *out, int samples, unsigned seed) {
+  std::mt19937 rng(seed);
+  struct Candidate { Config c; double score; };
+  std::vector<Candidate> candidates;
+
+  // random exploration
+  for (int i=0; i<samples; i++) {
+    Config c = random_config(rng);
+    candidates.push_back({c, score(c)});
+  }
+  auto by_score = [](Candidate const &a, Candidate const &b) { return a.score > b.score; };
+  std::sort(candidates.begin(), candidates.end(), by_score);
+
+  // hill climbing from the most expensive ones
+  int climbers = std::min<int>(kClimbers, candidates.size());
+  for (int i=0; i<climbers; i++) {
+    Candidate &best = candidates[i];
+    for (int s=0; s<kClimbSteps; s++) {
+      Config c = mutate(best.c, rng);
+      double x = score(c);
+      if (x > best.score) best = {c, x};
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), by_score);
+
+  // long runs of the distinct winners
+  struct Entry { Config c; Stats s; };
+  std::vector<Entry> report;
+  for (auto &cand : candidates) {
+    if ((int)report.size() == kReportSize) break;
+    if (std::any_of(report.begin(), report.end(),
+                    [&](Entry const &e) { return same(e.c, cand.c); }))
+      continue;
+    report.push_back({cand.c, stats(measure(cand.c, kReportBlocks))});
+  }
+  std::sort(report.begin(), report.end(), [](Entry const &a, Entry const &b) {
+    return a.s.p99 / deadline(a.c) > b.s.p99 / deadline(b.c);
+  });
+
+  fputs(csv_header, out);
+  for (auto &e : report) print(out, e.c, e.s);
+  return 0;
+}
+
+static int check(char const *filename, double tolerance) {
+  FILE *in = fopen(filename, "r");
+  if (in == NULL) {
+    fprintf(stderr, "cannot open %s\n", filename);
+    return 1;
+  }
+
+  char line[512];
+  int failures = 0, count = 0;
+  fgets(line, sizeof(line), in); // header
+  printf("%s", csv_header);
+  while (fgets(line, sizeof(line), in)) {
+    Config c;
+    Stats old;
+    if (!parse(line, c, old)) {
+      fprintf(stderr, "malformed line: %s", line);
+      fclose(in);
+      return 1;
+    }
+    Stats s = stats(measure(c, kReportBlocks));
+    print(stdout, c, s);
+    count++;
+    if (s.p99 > old.p99 * (1.0 + tolerance / 100.0)) {
+      printf("REGRESSION: p99 %.1f ns -> %.1f ns (+%.1f%%), max %.1f ns -> %.1f ns\n",
+             old.p99, s.p99, 100.0 * (s.p99 / old.p99 - 1.0), old.max, s.max);
+      failures++;
+    }
+  }
+  fclose(in);
+
+  printf("%d of %d configurations over tolerance (%.0f%%)\n", failures, count, tolerance);
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+  Math math;
+  DynamicData dynamic_data;
+
+  if (argc > 1 && strcmp(argv[1], "--check") == 0) {
+    if (argc < 3) {
+      fprintf(stderr, "usage: %s --check set.csv [tolerance_pct]\n", argv[0]);
+      return 1;
+    }
+    return check(argv[2], argc > 3 ? atof(argv[3]) : 10.0);
+  }
+
+  FILE *out = argc > 1 ? fopen(argv[1], "w") : stdout;
+  if (out == NULL) {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    return 1;
+  }
+  int samples = argc > 2 ? atoi(argv[2]) : 300;
+  unsigned seed = argc > 3 ? atoi(argv[3]) : 1;
+
+  int result = search(out, samples, seed);
+  if (out != stdout) fclose(out);
+  return result;
+}
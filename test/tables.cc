@@ -0,0 +1,178 @@
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include "dynamic_data.hh"
+#include "check.hh"
+
+// Host test for the DSP tables of DynamicData: whatever their placement
+// and format (see TABLES in the makefile), the tables computed by the
+// compiler and those computed at boot must agree. The fixed-point sine
+// to the bit; the others within one step of their format, or
+// kTolerance in f32, since -ffast-math lets the compiler reorder the
+// boot computation (the compiler's own evaluation is exact IEEE),
+// which moves the folds by a few 1e-6.
+//
+// Then reports the error of the compact formats of cheby and fold
+// against f32, as read by Distortion::warp, over every s1_15 input.
+
+constexpr float kTolerance = 1e-5f;
+
+template<class T, class U>
+static bool same(T const& a, U const& b) {
+  static_assert(sizeof(T) == sizeof(U));
+  return !memcmp(&a, &b, sizeof(T));
+}
+
+static float tolerance(f x) {
+  return kTolerance * std::max(1.0f, std::abs(x.repr()));
+}
+static float tolerance(f16 x) {
+  return std::ldexp(std::max(std::abs(x.to_float().repr()), 0x1p-14f), -10);
+}
+static float tolerance(s1_15) { return 1.0f / 32767.0f; }
+
+template<class T>
+static bool close(T const& a, T const& b, float tolerance) {
+  return std::abs((tables::loaded(a) - tables::loaded(b)).repr()) <= tolerance;
+}
+
+template<class T>
+static bool close(T const& a, T const& b) {
+  return close(a, b, tolerance(a));
+}
+
+// a difference moves with both of its ends, by a step of the value
+template<class T>
+static bool close(std::pair<T, T> const& a, std::pair<T, T> const& b) {
+  float t = tolerance(a.first);
+  return close(a.first, b.first, t) && close(a.second, b.second, 2.0f * t);
+}
+
+template<class T, int N>
+static bool close(Buffer<T, N> const& a, Buffer<T, N> const& b) {
+  for (int i=0; i<N; i++)
+    if (!close(a[i], b[i])) return false;
+  return true;
+}
+
+// computed by the compiler here, whatever the placement of DynamicData
+namespace compiled {
+using namespace tables;
+constexpr auto sine_entries = Generate<SineEntries>([](auto& t) { FillSine(t); });
+constexpr auto cheby_entries = Generate<ChebyEntries>([](auto& t) { FillCheby(t); });
+constexpr auto fold_entries = Generate<FoldEntries>([](auto& t) { FillFold(t); });
+constexpr auto fold_max_entries =
+  Generate<FoldMaxEntries>([](auto& t) { FillFoldMax(t); });
+constexpr auto triangles_entries =
+  Generate<TrianglesEntries>([](auto& t) { FillTriangles(t); });
+
+SineTable const sine = Compile<SineTable>(sine_entries);
+ChebyTable const cheby = Compile<ChebyTable>(cheby_entries);
+FoldTable const fold = Compile<FoldTable>(fold_entries);
+FoldMaxTable const fold_max = Compile<FoldMaxTable>(fold_max_entries);
+TrianglesTable const triangles = Compile<TrianglesTable>(triangles_entries);
+}
+
+// computed at run time
+namespace boot {
+SineTable sine;
+ChebyTable cheby;
+FoldTable fold;
+FoldMaxTable fold_max;
+TrianglesTable triangles;
+}
+
+// all formats, for the report
+template<class T> struct Formats {
+  static ChebyTableOf<T> cheby;
+  static FoldTableOf<T> fold;
+};
+template<class T> ChebyTableOf<T> Formats<T>::cheby;
+template<class T> FoldTableOf<T> Formats<T>::fold;
+
+// as Distortion::warp reads them
+static u0_32 phase(int x) {
+  return u0_32(s1_15::of_repr(int16_t(x)).to_unsigned_scale());
+}
+
+template<class T>
+static f cheby(int n, int x) {
+  return tables::loaded(Formats<T>::cheby[n].interpolate(phase(x)));
+}
+
+template<class T>
+static f fold(int x) {
+  using W = typename Widened<T>::type;
+  return tables::loaded(Formats<T>::fold.template interpolateDiff<W>(phase(x)));
+}
+
+struct Error {
+  double max = 0, sum = 0;
+  int count = 0;
+  void add(f x, f reference) {
+    double e = std::abs(double((x - reference).repr()));
+    max = std::max(max, e);
+    sum += e * e;
+    count++;
+  }
+  double rms() const { return std::sqrt(sum / count); }
+};
+
+template<class T>
+static void report(char const *name, double max_error) {
+  tables::FillCheby(Formats<T>::cheby);
+  tables::FillFold(Formats<T>::fold);
+
+  Error cheby_error, fold_error;
+  for (int x=-32768; x<32768; x++) {
+    for (int n=0; n<cheby_tables; n++)
+      cheby_error.add(cheby<T>(n, x), cheby<f>(n, x));
+    fold_error.add(fold<T>(x), fold<f>(x));
+  }
+
+  printf("%-6s cheby %6zu bytes, error max %.2e rms %.2e (%6.1f dB)\n",
+         name, sizeof(ChebyTableOf<T>), cheby_error.max, cheby_error.rms(),
+         20 * std::log10(cheby_error.rms() + 1e-30));
+  printf("%-6s fold  %6zu bytes, error max %.2e rms %.2e (%6.1f dB)\n",
+         name, sizeof(FoldTableOf<T>), fold_error.max, fold_error.rms(),
+         20 * std::log10(fold_error.rms() + 1e-30));
+  check(cheby_error.max <= max_error && fold_error.max <= max_error,
+        "error within bounds");
+}
+
+int main() {
+  tables::FillSine(boot::sine);
+  tables::FillCheby(boot::cheby);
+  tables::FillFold(boot::fold);
+  tables::FillFoldMax(boot::fold_max);
+  tables::FillTriangles(boot::triangles);
+
+  check(same(compiled::sine, boot::sine), "sine");
+  check(close(compiled::cheby, boot::cheby), "cheby");
+  check(close(compiled::fold, boot::fold), "fold");
+  check(close(compiled::fold_max, boot::fold_max), "fold_max");
+  check(close(compiled::triangles, boot::triangles), "triangles");
+
+  // and the tables in use, placed as configured
+  DynamicData dynamic_data;
+  check(same(DynamicData::sine, boot::sine), "DynamicData::sine");
+  check(close(DynamicData::cheby, boot::cheby), "DynamicData::cheby");
+  check(close(DynamicData::fold, boot::fold), "DynamicData::fold");
+  check(close(DynamicData::fold_max, boot::fold_max), "DynamicData::fold_max");
+  check(close(DynamicData::triangles, boot::triangles), "DynamicData::triangles");
+
+  // a few known values
+  check(close(DynamicData::cheby[0][0], tables::stored<ChebyValue>(-1_f)) &&
+        close(DynamicData::cheby[0][cheby_size-1], tables::stored<ChebyValue>(1_f)),
+        "cheby[1] spans [-1..1]");
+  check(DynamicData::triangles[0][0] == -1_f && DynamicData::triangles[0][8] == 1_f,
+        "first triangle spans [-1..1]");
+
+  printf("\n");
+  report<f>("f32", 0.0);
+  report<f16>("f16", 1e-3);
+  report<s1_15>("s1_15", 2e-4);
+
+  return report();
+}
@@ -32,7 +32,7 @@ struct Main : Math, DynamicData {
       .fine_tune = 0.5_f,
     };
     
-    PolypticOscillator<kBlockSize> osc{params};
+    PolypticOscillator osc{params};
 
     f root = 20_f;
     
@@ -44,7 +44,7 @@ struct Main : Math, DynamicData {
       params.root = root;// + noise;
 
       Buffer<Frame, kBlockSize> buf;
-      osc.Process(buf);
+      osc.Process<kBlockSize>(buf.data());
       // std::cout << buf[0].l.repr() << ", "
       //           << buf[0].r.repr()
       //           << '\n';